@@ -1,14 +1,18 @@
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "hyrise.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/table.hpp"
 #include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
@@ -21,6 +25,8 @@ constexpr auto TABLE_SIZE_SMALL = size_t{1'000};
 constexpr auto TABLE_SIZE_MEDIUM = size_t{100'000};
 constexpr auto TABLE_SIZE_BIG = size_t{10'000'000};
 
+constexpr auto INTERVAL_COUNT = int32_t{20'000};
+
 void clear_cache() {
   std::vector<int> clear = std::vector<int>();
   clear.resize(500 * 1000 * 1000, 42);
@@ -62,15 +68,16 @@ std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
 
 template <class C>
 void bm_join_impl(benchmark::State& state, std::shared_ptr<TableWrapper> table_wrapper_left,
-                  std::shared_ptr<TableWrapper> table_wrapper_right) {
+                  std::shared_ptr<TableWrapper> table_wrapper_right,
+                  const PredicateCondition predicate_condition = PredicateCondition::Equals) {
   clear_cache();
 
   auto warm_up = std::make_shared<C>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
-                                     OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+                                     OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition});
   warm_up->execute();
   for (auto _ : state) {
     auto join = std::make_shared<C>(table_wrapper_left, table_wrapper_right, JoinMode::Inner,
-                                    OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+                                    OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition});
     join->execute();
   }
 
@@ -85,6 +92,15 @@ void BM_Join_SmallAndSmall(benchmark::State& state) {  // NOLINT 1,000 x 1,000
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// Non-equi join, which cannot be executed by the JoinHash.
+template <class C>
+void BM_Join_SmallAndSmall_LessThan(benchmark::State& state) {  // NOLINT 1,000 x 1,000
+  auto table_wrapper_left = generate_table(TABLE_SIZE_SMALL);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_SMALL);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right, PredicateCondition::LessThan);
+}
+
 template <class C>
 void BM_Join_SmallAndBig(benchmark::State& state) {  // NOLINT 1,000 x 10,000,000
   auto table_wrapper_left = generate_table(TABLE_SIZE_SMALL);
@@ -101,7 +117,62 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+// The build side of the JoinHash does not fit into the L2 cache, so that the probe phase is bound by cache misses.
+template <class C>
+void BM_Join_MediumAndBig(benchmark::State& state) {  // NOLINT 100,000 x 10,000,000
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_BIG);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+// Creates a table with the intervals [10 * i, 10 * i + 15) and a table with the timestamps 7 * i.
+std::pair<std::shared_ptr<TableWrapper>, std::shared_ptr<TableWrapper>> generate_interval_tables() {
+  auto starts = pmr_vector<int32_t>(INTERVAL_COUNT);
+  auto ends = pmr_vector<int32_t>(INTERVAL_COUNT);
+  auto timestamps = pmr_vector<int32_t>(INTERVAL_COUNT);
+  for (auto row_id = int32_t{0}; row_id < INTERVAL_COUNT; ++row_id) {
+    starts[row_id] = 10 * row_id;
+    ends[row_id] = 10 * row_id + 15;
+    timestamps[row_id] = 7 * row_id;
+  }
+
+  const auto intervals = std::make_shared<Table>(
+      TableColumnDefinitions{{"start", DataType::Int, false}, {"end", DataType::Int, false}}, TableType::Data);
+  intervals->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(starts)),
+                           std::make_shared<ValueSegment<int32_t>>(std::move(ends))});
+  const auto events = std::make_shared<Table>(TableColumnDefinitions{{"ts", DataType::Int, false}}, TableType::Data);
+  events->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(timestamps))});
+
+  auto table_wrappers =
+      std::make_pair(std::make_shared<TableWrapper>(intervals), std::make_shared<TableWrapper>(events));
+  for (const auto& table_wrapper : {table_wrappers.first, table_wrappers.second}) {
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+  }
+  return table_wrappers;
+}
+
+// Interval join with two inequality predicates: start <= ts AND end > ts.
+template <class C>
+void BM_Join_Intervals(benchmark::State& state) {  // NOLINT 20,000 x 20,000
+  const auto [intervals, events] = generate_interval_tables();
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThanEquals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThan}};
+
+  clear_cache();
+  for (auto _ : state) {
+    auto join = std::make_shared<C>(intervals, events, JoinMode::Inner, primary_predicate, secondary_predicates);
+    join->execute();
+  }
+
+  Hyrise::reset();
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
+BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall_LessThan, JoinNestedLoop);
+BENCHMARK_TEMPLATE(BM_Join_Intervals, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinIndex);
@@ -110,9 +181,14 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndBig, JoinHash);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall_LessThan, JoinSortMerge);
+
+BENCHMARK_TEMPLATE(BM_Join_Intervals, JoinIE);
+BENCHMARK_TEMPLATE(BM_Join_Intervals, JoinSortMerge);
 
 }  // namespace hyrise
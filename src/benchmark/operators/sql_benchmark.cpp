@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "SQLParser.h"
@@ -10,6 +11,7 @@
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "synthetic_table_generator.hpp"
 #include "utils/load_table.hpp"
 
 namespace hyrise {
@@ -26,6 +28,13 @@ class SQLBenchmark : public MicroBenchmarkBasicFixture {
     storage_manager.add_table("customer", load_table("resources/test_data/tbl/tpch/minimal/customer.tbl"));
     storage_manager.add_table("lineitem", load_table("resources/test_data/tbl/tpch/minimal/lineitem.tbl"));
     storage_manager.add_table("orders", load_table("resources/test_data/tbl/tpch/minimal/orders.tbl"));
+
+    // Table with many chunks for the LIMIT benchmarks. Its columns are named column_1 and column_2.
+    const auto column_specifications = std::vector<ColumnSpecification>(
+        2, ColumnSpecification(ColumnDataDistribution::make_uniform_config(0.0, 10'000.0), DataType::Int));
+    const auto limit_table =
+        SyntheticTableGenerator::generate_table(column_specifications, 1'000'000, ChunkOffset{10'000});
+    storage_manager.add_table("limit_table", limit_table);
   }
 
   // Run a benchmark that compiles the given SQL query.
@@ -68,6 +77,21 @@ class SQLBenchmark : public MicroBenchmarkBasicFixture {
     }
   }
 
+  // Run a benchmark that executes the given SQL query, optionally with pipelined execution. Queries with a LIMIT stop
+  // scanning once enough rows are found (see AbstractOperator::set_row_limit).
+  static void BM_ExecuteQuery(benchmark::State& state, const std::string& sql,
+                              const UsePipelinedExecution use_pipelined_execution) {
+    for (auto _ : state) {
+      auto pipeline =
+          SQLPipelineBuilder{sql}.disable_mvcc().with_pipelined_execution(use_pipelined_execution).create_pipeline();
+      pipeline.get_result_table();
+    }
+  }
+
+  const std::string limit_query =
+      "SELECT column_1, column_1 + column_2 FROM limit_table WHERE column_2 < 5000 LIMIT 10;";
+  const std::string no_limit_query = "SELECT column_1, column_1 + column_2 FROM limit_table WHERE column_2 < 5000;";
+
   const std::string query =
       R"(SELECT customer.c_custkey, customer.c_name, COUNT(orderitems.o_orderkey)
         FROM customer
@@ -95,4 +119,16 @@ BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQuery)(benchmark::State& st) {
   BM_QueryPlanCache(st);
 }
 
+BENCHMARK_F(SQLBenchmark, BM_ExecuteQueryWithoutLimit)(benchmark::State& st) {
+  BM_ExecuteQuery(st, no_limit_query, UsePipelinedExecution::No);
+}
+
+BENCHMARK_F(SQLBenchmark, BM_ExecuteQueryWithLimit)(benchmark::State& st) {
+  BM_ExecuteQuery(st, limit_query, UsePipelinedExecution::No);
+}
+
+BENCHMARK_F(SQLBenchmark, BM_ExecuteQueryWithLimitPipelined)(benchmark::State& st) {
+  BM_ExecuteQuery(st, limit_query, UsePipelinedExecution::Yes);
+}
+
 }  // namespace hyrise
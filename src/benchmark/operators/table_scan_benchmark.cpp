@@ -1,10 +1,19 @@
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <random>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "micro_benchmark_utils.hpp"
+#include "operators/index_scan.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
@@ -12,6 +21,70 @@ namespace hyrise {
 
 using namespace expression_functional;  // NOLINT(build/namespaces)
 
+namespace {
+
+constexpr auto RANGE_SCAN_ROW_COUNT = int32_t{1'000'000};
+
+// Creates a dictionary-encoded table with a single column that holds a shuffled permutation of
+// [0, RANGE_SCAN_ROW_COUNT). If `sorted` is set, each chunk is sorted and marked as such, so that the TableScan uses
+// the sorted segment search.
+std::shared_ptr<Table> create_range_scan_table(const bool sorted) {
+  auto values = std::vector<int32_t>(RANGE_SCAN_ROW_COUNT);
+  std::iota(values.begin(), values.end(), 0);
+  auto generator = std::mt19937{17};
+  std::shuffle(values.begin(), values.end(), generator);
+
+  const auto chunk_size = static_cast<size_t>(Chunk::DEFAULT_SIZE);
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  for (auto begin = size_t{0}; begin < values.size(); begin += chunk_size) {
+    const auto end = std::min(begin + chunk_size, values.size());
+    auto chunk_values = pmr_vector<int32_t>(values.cbegin() + begin, values.cbegin() + end);
+    if (sorted) {
+      std::sort(chunk_values.begin(), chunk_values.end());
+    }
+    table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(chunk_values))});
+    table->last_chunk()->finalize();
+  }
+
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  if (sorted) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+    }
+  }
+
+  return table;
+}
+
+std::shared_ptr<TableWrapper> wrap_and_execute(const std::shared_ptr<Table>& table) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+// The benchmark argument is the selectivity of the range predicate in millionths, i.e., the number of qualifying rows
+// per million rows.
+int32_t range_scan_upper_bound(const benchmark::State& state) {
+  return static_cast<int32_t>(int64_t{RANGE_SCAN_ROW_COUNT} * state.range(0) / 1'000'000) - 1;
+}
+
+void benchmark_range_table_scan(benchmark::State& state, const bool sorted) {
+  const auto table_wrapper = wrap_and_execute(create_range_scan_table(sorted));
+  const auto predicate = between_inclusive_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), 0,
+                                            range_scan_upper_bound(state));
+
+  micro_benchmark_clear_cache();
+  for (auto _ : state) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+}
+
+}  // namespace
+
 void benchmark_tablescan_impl(benchmark::State& state, const std::shared_ptr<const AbstractOperator> in,
                               ColumnID left_column_id, const PredicateCondition predicate_condition,
                               const AllParameterVariant right_parameter) {
@@ -84,4 +157,38 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
   }
 }
 
+// The following benchmarks compare the access paths for range predicates with selectivities from 0.001% to 10%.
+void BM_RangeScan_TableScan(benchmark::State& state) {
+  benchmark_range_table_scan(state, false);
+}
+
+void BM_RangeScan_TableScanOnSortedChunks(benchmark::State& state) {
+  benchmark_range_table_scan(state, true);
+}
+
+template <typename Index>
+void BM_RangeScan_IndexScan(benchmark::State& state) {
+  const auto table = create_range_scan_table(false);
+  table->create_chunk_index<Index>({ColumnID{0}});
+  const auto table_wrapper = wrap_and_execute(table);
+
+  const auto index_type = get_chunk_index_type_of<Index>();
+  const auto right_values = std::vector<AllTypeVariant>{int32_t{0}};
+  const auto right_values2 = std::vector<AllTypeVariant>{range_scan_upper_bound(state)};
+
+  micro_benchmark_clear_cache();
+  for (auto _ : state) {
+    const auto index_scan = std::make_shared<IndexScan>(table_wrapper, index_type, std::vector<ColumnID>{ColumnID{0}},
+                                                        PredicateCondition::BetweenInclusive, right_values,
+                                                        right_values2);
+    index_scan->execute();
+  }
+}
+
+BENCHMARK(BM_RangeScan_TableScan)->RangeMultiplier(10)->Range(10, 100'000);
+BENCHMARK(BM_RangeScan_TableScanOnSortedChunks)->RangeMultiplier(10)->Range(10, 100'000);
+BENCHMARK_TEMPLATE(BM_RangeScan_IndexScan, GroupKeyIndex)->RangeMultiplier(10)->Range(10, 100'000);
+BENCHMARK_TEMPLATE(BM_RangeScan_IndexScan, AdaptiveRadixTreeIndex)->RangeMultiplier(10)->Range(10, 100'000);
+BENCHMARK_TEMPLATE(BM_RangeScan_IndexScan, BTreeIndex)->RangeMultiplier(10)->Range(10, 100'000);
+
 }  // namespace hyrise
@@ -4,6 +4,7 @@
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -41,12 +42,14 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("group_commit", "Commit concurrently committing transactions together (see TransactionManager::set_group_commit)", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
   size_t num_warehouses;
   bool consistency_checks;
+  bool group_commit;
 
   // Parse command line args
   const auto cli_parse_result = cli_options.parse(argc, argv);
@@ -57,6 +60,7 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  group_commit = cli_parse_result["group_commit"].as<bool>();
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -68,8 +72,14 @@ int main(int argc, char* argv[]) {
 
   std::cout << "- TPC-C scale factor (number of warehouses) is " << num_warehouses << std::endl;
 
+  if (group_commit) {
+    std::cout << "- Committing concurrent transactions in groups" << std::endl;
+    Hyrise::get().transaction_manager.set_group_commit(true);
+  }
+
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("group_commit", group_commit);
 
   // Run the benchmark
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
@@ -312,4 +312,37 @@ BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_HashSemiProbeRelationLarger)(bench
   }
 }
 
+/**
+ * The following benchmarks execute a single JoinHash on the first column of the materialized TPC-H tables (i.e.,
+ * o_orderkey and l_orderkey) with a memory budget of 10 % of the estimated memory consumption of the join, so that the
+ * JoinHash spills its partitions to disk. They do not execute the TPC-H queries.
+ */
+void benchmark_hash_join_with_memory_budget(benchmark::State& state, const std::shared_ptr<TableWrapper>& left_input,
+                                            const std::shared_ptr<TableWrapper>& right_input,
+                                            const JoinMode join_mode) {
+  const auto memory_consumption = JoinHash::estimate_memory_consumption(left_input->get_output()->row_count(),
+                                                                        right_input->get_output()->row_count());
+  const auto memory_budget_setting = Hyrise::get().settings_manager.get_setting(JoinHash::MEMORY_BUDGET_SETTING);
+  memory_budget_setting->set(std::to_string(memory_consumption / 10));
+
+  for (auto _ : state) {
+    auto join = std::make_shared<JoinHash>(
+        left_input, right_input, join_mode,
+        OperatorJoinPredicate{ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals});
+    join->execute();
+  }
+
+  memory_budget_setting->set(std::to_string(JoinHash::DEFAULT_MEMORY_BUDGET));
+}
+
+BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_HashJoinOrdersLineitemWithMemoryBudget)(benchmark::State& state) {
+  benchmark_hash_join_with_memory_budget(state, _table_wrapper_map.at("orders"), _table_wrapper_map.at("lineitem"),
+                                         JoinMode::Inner);
+}
+
+BENCHMARK_F(TPCHDataMicroBenchmarkFixture, BM_HashSemiJoinLineitemLineitemWithMemoryBudget)(benchmark::State& state) {
+  const auto& lineitem = _table_wrapper_map.at("lineitem");
+  benchmark_hash_join_with_memory_budget(state, lineitem, lineitem, JoinMode::Semi);
+}
+
 }  // namespace hyrise
@@ -12,6 +12,7 @@
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/numa_placement.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/list_directory.hpp"
@@ -218,6 +219,8 @@ void AbstractTableGenerator::generate_and_store() {
         Timer per_table_timer;
         table_info.re_encoded =
             BenchmarkTableEncoder::encode(table_name, table_info.table, _benchmark_config->encoding_config);
+        // On NUMA systems, distribute the encoded chunks across the nodes (does nothing for a single node).
+        place_chunks_on_numa_nodes(table_info.table);
         auto output = std::stringstream{};
         output << "-  Processing '" + table_name << "' - "
                << (table_info.re_encoded ? "encoding applied" : "no encoding necessary") << " ("
@@ -317,6 +320,7 @@ void AbstractTableGenerator::generate_and_store() {
    */
   if (_benchmark_config->table_indexes) {
     _create_table_indexes(table_info_by_name);
+    _create_key_hash_indexes(table_info_by_name);
   } else {
     std::cout << "- No table indexes created as --table_indexes was not specified or set to false" << std::endl;
   }
@@ -401,6 +405,30 @@ void AbstractTableGenerator::_create_table_indexes(
   std::cout << "- Creating table indexes done (" << format_duration(metrics.table_index_duration) << ")" << std::endl;
 }
 
+void AbstractTableGenerator::_create_key_hash_indexes(
+    std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) {
+  Timer timer;
+  std::cout << "- Creating key hash indexes" << std::endl;
+  for (const auto& [table_name, table_info] : table_info_by_name) {
+    const auto& table = table_info.table;
+    for (const auto& key_constraint : table->soft_key_constraints()) {
+      std::cout << "-  Creating a key hash index on table " << table_name << " [ ";
+      for (const auto column_id : key_constraint.columns()) {
+        std::cout << table->column_name(column_id) << " ";
+      }
+      std::cout << "] " << std::flush;
+
+      Timer per_index_timer;
+      table->create_key_hash_index(key_constraint);
+
+      std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
+    }
+  }
+  const auto key_hash_index_duration = timer.lap();
+  metrics.table_index_duration += key_hash_index_duration;
+  std::cout << "- Creating key hash indexes done (" << format_duration(key_hash_index_duration) << ")" << std::endl;
+}
+
 AbstractTableGenerator::IndexesByTable AbstractTableGenerator::_indexes_by_table() const {
   // Indexes can be specified in a derived concrete class by overriding this function.
   return {};
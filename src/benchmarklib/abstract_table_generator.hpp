@@ -71,6 +71,9 @@ class AbstractTableGenerator {
   // Creates table indexes. Expects the table to have been added to the StorageManager and, if requested, encoded.
   void _create_table_indexes(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name);
 
+  // Creates a KeyHashIndex for every key constraint, which Insert maintains. Expects the constraints to be added.
+  void _create_key_hash_indexes(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name);
+
   // Returns a set of index specifications.
   using IndexesByTable = std::map<std::string, std::vector<std::vector<std::string>>>;
   virtual IndexesByTable _indexes_by_table() const;
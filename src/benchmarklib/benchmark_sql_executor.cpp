@@ -65,15 +65,16 @@ BenchmarkSQLExecutor::~BenchmarkSQLExecutor() {
   }
 }
 
-void BenchmarkSQLExecutor::commit() {
+bool BenchmarkSQLExecutor::commit() {
   Assert(transaction_context && !transaction_context->is_auto_commit(),
          "Can only explicitly commit transaction if auto-commit is disabled");
   Assert(transaction_context->phase() == TransactionPhase::Active, "Expected transaction to be active");
-  transaction_context->commit();
+  const auto committed = transaction_context->commit();
   if (_sqlite_connection) {
     _sqlite_transaction_open = false;
-    _sqlite_connection->raw_execute_query("COMMIT TRANSACTION");
+    _sqlite_connection->raw_execute_query(committed ? "COMMIT TRANSACTION" : "ROLLBACK TRANSACTION");
   }
+  return committed;
 }
 
 void BenchmarkSQLExecutor::rollback() {
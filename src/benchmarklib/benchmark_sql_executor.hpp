@@ -25,8 +25,9 @@ class BenchmarkSQLExecutor {
   std::pair<SQLPipelineStatus, std::shared_ptr<const Table>> execute(
       const std::string& sql, const std::shared_ptr<const Table>& expected_result_table = nullptr);
 
-  // If auto-commit is disabled, explicitly commit / roll back the transaction
-  void commit();
+  // If auto-commit is disabled, explicitly commit / roll back the transaction. Committing returns false if the
+  // transaction was rolled back because it violates a key constraint.
+  [[nodiscard]] bool commit();
   void rollback();
 
   // Contains one entry per executed SQLPipeline
@@ -81,8 +81,7 @@ bool TPCCDelivery::_on_execute() {
   }
 
   // TPC-C would allow us to use one transaction per order. We did not yet measure if this would give us an advantage.
-  _sql_executor.commit();
-  return true;
+  return _sql_executor.commit();
 }
 
 }  // namespace hyrise
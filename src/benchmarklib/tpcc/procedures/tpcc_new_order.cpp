@@ -185,8 +185,7 @@ bool TPCCNewOrder::_on_execute() {
     Assert(order_line_insert_pair.first == SQLPipelineStatus::Success, "INSERT should not fail");
   }
 
-  _sql_executor.commit();
-  return true;
+  return _sql_executor.commit();
 }
 
 }  // namespace hyrise
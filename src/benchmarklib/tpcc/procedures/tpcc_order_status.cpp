@@ -74,8 +74,7 @@ bool TPCCOrderStatus::_on_execute() {
     ol_quantity_sum += *order_line_table->get_value<int32_t>(ColumnID{2}, row);
   }
 
-  _sql_executor.commit();
-  return true;
+  return _sql_executor.commit();
 }
 
 }  // namespace hyrise
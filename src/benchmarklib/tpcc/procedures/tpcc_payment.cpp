@@ -149,8 +149,7 @@ bool TPCCPayment::_on_execute() {
       std::to_string(h_date) + "', " + std::to_string(h_amount) + ")"});
   Assert(history_insert_pair.first == SQLPipelineStatus::Success, "INSERT should not fail");
 
-  _sql_executor.commit();
-  return true;
+  return _sql_executor.commit();
 }
 
 }  // namespace hyrise
@@ -15,10 +15,9 @@ TransactionContext::TransactionContext(const TransactionID transaction_id, const
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
       _is_auto_commit{is_auto_commit},
+      _snapshot_slot{Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id)},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {
-  Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
-}
+      _num_active_operators{0} {}
 
 TransactionContext::~TransactionContext() {
   DebugAssert(([this]() {
@@ -51,7 +50,7 @@ TransactionContext::~TransactionContext() {
    * Tell the TransactionManager, which keeps track of active snapshot-commit-ids,
    * that this transaction has finished.
    */
-  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id);
+  Hyrise::get().transaction_manager._deregister_transaction(_snapshot_commit_id, _snapshot_slot);
 }
 
 TransactionID TransactionContext::transaction_id() const {
@@ -96,32 +95,61 @@ void TransactionContext::rollback(RollbackReason rollback_reason) {
   _mark_as_rolled_back(rollback_reason);
 }
 
-void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+bool TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  return _commit(callback, false);
+}
+
+bool TransactionContext::_commit(const std::function<void(TransactionID)>& callback, const bool wait_for_group) {
+  // Validate optimistically instead of holding locks while the operators execute. As the validation happens before
+  // the commit ID is acquired, the commits of other transactions are not delayed.
+  for (const auto& op : _read_write_operators) {
+    if (!op->validate_commit()) {
+      rollback(RollbackReason::Conflict);
+      return false;
+    }
+  }
+
   _prepare_commit();
 
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  if (transaction_manager.group_commit()) {
+    // The leader of the group commit acquires the commit ID and commits the records (see
+    // TransactionManager::_group_commit).
+    transaction_manager._group_commit(shared_from_this(), callback, wait_for_group);
+    return true;
+  }
+
+  _commit_context = transaction_manager._new_commit_context();
+
   for (const auto& op : _read_write_operators) {
     op->commit_records(commit_id());
   }
 
   _mark_as_pending_and_try_commit(callback);
+  return true;
 }
 
-void TransactionContext::commit() {
+bool TransactionContext::commit() {
   Assert(_phase == TransactionPhase::Active, "TransactionContext must be active to be committed.");
 
   // No modifications made, nothing to commit, no need to acquire a commit ID
   if (_read_write_operators.empty()) {
     _transition(TransactionPhase::Active, TransactionPhase::Committed);
-    return;
+    return true;
   }
 
   auto committed = std::promise<void>{};
   const auto committed_future = committed.get_future();
   const auto callback = [&committed](TransactionID /*unused*/) { committed.set_value(); };
 
-  commit_async(callback);
+  // With group commit, the calling thread waits for its batch in the TransactionManager, so that it can take over the
+  // leadership of the group commits while waiting.
+  if (!_commit(callback, true)) {
+    return false;
+  }
 
   committed_future.wait();
+  return true;
 }
 
 void TransactionContext::_mark_as_conflicted() {
@@ -163,8 +191,18 @@ void TransactionContext::_prepare_commit() {
   _transition(TransactionPhase::Active, TransactionPhase::Committing);
 
   _wait_for_active_operators_to_finish();
+}
+
+void TransactionContext::_rollback_failed_commit() {
+  _transition(TransactionPhase::Committing, TransactionPhase::Conflicted);
+
+  for (const auto& op : _read_write_operators) {
+    if (op->state() == ReadWriteOperatorState::Executed) {
+      op->rollback_records();
+    }
+  }
 
-  _commit_context = Hyrise::get().transaction_manager._new_commit_context();
+  _transition(TransactionPhase::Conflicted, TransactionPhase::RolledBackAfterConflict);
 }
 
 void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback) {
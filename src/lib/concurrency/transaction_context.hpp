@@ -109,16 +109,24 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * @param callback called when transaction is actually committed
+   * Before a commit ID is assigned, the read-write operators validate their changes (e.g., Insert checks the key
+   * constraints that are enforced by a KeyHashIndex). If the validation fails, the transaction is rolled back as
+   * conflicted, false is returned, and the callback is not called.
+   *
+   * @param callback called when transaction is actually committed. With group commit, it is also called if the
+   *                 records of the transaction could not be committed. The transaction is rolled back in that case
+   *                 (i.e., its phase is RolledBackAfterConflict).
    */
-  void commit_async(const std::function<void(TransactionID)>& callback);
+  [[nodiscard]] bool commit_async(const std::function<void(TransactionID)>& callback);
 
   /**
    * Commits the transaction.
    *
-   * Blocks until transaction is actually committed.
+   * Blocks until transaction is actually committed. Returns false if the transaction was rolled back instead because
+   * it violates a constraint (see commit_async). With group commit, the exception is rethrown if the records of the
+   * transaction could not be committed, after the transaction was rolled back.
    */
-  void commit();
+  [[nodiscard]] bool commit();
 
   /**
    * Add an operator to the list of read-write operators.
@@ -168,13 +176,21 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Sets transaction phase to Committing.
-   * Creates a new commit context and assigns a new commit id.
    * All operators within this context must be finished and
    * none of the registered operators should have failed when
-   * calling this function.
+   * calling this function. The commit context with the new commit id
+   * is created afterwards, either for this transaction only or for
+   * a group commit.
    */
   void _prepare_commit();
 
+  /**
+   * Rolls back a transaction in the Committing phase whose records could not be committed during a group commit and
+   * sets its phase to RolledBackAfterConflict. Operators that already committed their records keep them, as there is
+   * no way to revert committed records.
+   */
+  void _rollback_failed_commit();
+
   /**
    * Sets transaction phase to Pending.
    * Tries to commit transaction and all following
@@ -188,6 +204,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**@}*/
 
+  // Implements commit_async() and commit(). See TransactionManager::_group_commit for `wait_for_group`.
+  bool _commit(const std::function<void(TransactionID)>& callback, const bool wait_for_group);
+
   void _wait_for_active_operators_to_finish() const;
 
   /**
@@ -200,6 +219,9 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const CommitID _snapshot_commit_id;
   const AutoCommit _is_auto_commit;
 
+  // Slot in which the TransactionManager tracks the snapshot_commit_id while the transaction is active.
+  const size_t _snapshot_slot;
+
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
 
   std::atomic<TransactionPhase> _phase;
@@ -1,10 +1,29 @@
 #include "transaction_manager.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 #include "commit_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// The slot that the current thread registered its last transaction in. Initialized to spread the threads across the
+// slots.
+thread_local auto preferred_snapshot_slot = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+}  // namespace
+
 namespace hyrise {
 
 TransactionManager::TransactionManager()
@@ -13,7 +32,7 @@ TransactionManager::TransactionManager()
       _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(!get_lowest_active_snapshot_commit_id(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
@@ -21,7 +40,13 @@ TransactionManager& TransactionManager::operator=(TransactionManager&& transacti
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
   _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _group_commit_enabled = transaction_manager._group_commit_enabled.load();
+  for (auto slot_index = size_t{0}; slot_index < SNAPSHOT_SLOT_COUNT; ++slot_index) {
+    _snapshot_slots[slot_index].snapshot_commit_id =
+        transaction_manager._snapshot_slots[slot_index].snapshot_commit_id.load();
+  }
+  _overflow_snapshot_commit_id_count = transaction_manager._overflow_snapshot_commit_id_count.load();
+  _overflow_snapshot_commit_ids = transaction_manager._overflow_snapshot_commit_ids;
   return *this;
 }
 
@@ -34,36 +59,78 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(TransactionID{_next_transaction_id++}, snapshot_commit_id, auto_commit);
 }
 
-void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
-}
+size_t TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  DebugAssert(snapshot_commit_id != UNUSED_SNAPSHOT_SLOT, "Invalid snapshot commit ID.");
 
-void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  for (auto probe_count = size_t{0}; probe_count < SNAPSHOT_SLOT_COUNT; ++probe_count) {
+    const auto slot_index = (preferred_snapshot_slot + probe_count) % SNAPSHOT_SLOT_COUNT;
+    auto& slot = _snapshot_slots[slot_index].snapshot_commit_id;
 
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+    // Skip occupied slots without writing to their cache lines.
+    auto expected_commit_id = UNUSED_SNAPSHOT_SLOT;
+    if (slot.load(std::memory_order_relaxed) == UNUSED_SNAPSHOT_SLOT &&
+        slot.compare_exchange_strong(expected_commit_id, snapshot_commit_id)) {
+      preferred_snapshot_slot = slot_index;
+      return slot_index;
+    }
+  }
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
+  const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+  _overflow_snapshot_commit_ids.insert(snapshot_commit_id);
+  ++_overflow_snapshot_commit_id_count;
+  return OVERFLOW_SNAPSHOT_SLOT;
+}
+
+void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id, const size_t snapshot_slot) {
+  if (snapshot_slot != OVERFLOW_SNAPSHOT_SLOT) {
+    Assert(snapshot_slot < SNAPSHOT_SLOT_COUNT, "Invalid snapshot slot.");
+    auto expected_commit_id = snapshot_commit_id;
+    const auto success =
+        _snapshot_slots[snapshot_slot].snapshot_commit_id.compare_exchange_strong(expected_commit_id,
+                                                                                  UNUSED_SNAPSHOT_SLOT);
+    Assert(success, "Snapshot slot does not hold the snapshot_commit_id of the transaction that is deregistered.");
     return;
   }
 
-  Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
-      "failed and the function should not have been called.");
+  const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+
+  const auto it = _overflow_snapshot_commit_ids.find(snapshot_commit_id);
+  Assert(it != _overflow_snapshot_commit_ids.end(),
+         "Could not find snapshot_commit_id in TransactionManager's _overflow_snapshot_commit_ids. Therefore, the "
+         "removal failed and the function should not have been called.");
+
+  _overflow_snapshot_commit_ids.erase(it);
+  --_overflow_snapshot_commit_id_count;
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  const auto lock = std::lock_guard<std::mutex>{_active_snapshot_commit_ids_mutex};
+  auto lowest_snapshot_commit_id = UNUSED_SNAPSHOT_SLOT;
+  for (const auto& slot : _snapshot_slots) {
+    lowest_snapshot_commit_id = std::min(lowest_snapshot_commit_id, slot.snapshot_commit_id.load());
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
+  if (_overflow_snapshot_commit_id_count > 0) {
+    const auto lock = std::lock_guard<std::mutex>{_overflow_snapshot_commit_ids_mutex};
+    if (!_overflow_snapshot_commit_ids.empty()) {
+      lowest_snapshot_commit_id = std::min(
+          lowest_snapshot_commit_id,
+          *std::min_element(_overflow_snapshot_commit_ids.cbegin(), _overflow_snapshot_commit_ids.cend()));
+    }
+  }
+
+  if (lowest_snapshot_commit_id == UNUSED_SNAPSHOT_SLOT) {
     return std::nullopt;
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  return lowest_snapshot_commit_id;
+}
+
+void TransactionManager::set_group_commit(const bool group_commit) {
+  _group_commit_enabled = group_commit;
+}
+
+bool TransactionManager::group_commit() const {
+  return _group_commit_enabled;
 }
 
 /**
@@ -128,4 +195,160 @@ void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<Com
   }
 }
 
+void TransactionManager::_group_commit(const std::shared_ptr<TransactionContext>& transaction_context,
+                                       const std::function<void(TransactionID)>& callback, const bool wait_for_group) {
+  auto lock = std::unique_lock<std::mutex>{_group_commit_mutex};
+  _group_commit_queue.emplace_back(GroupCommitEntry{transaction_context, callback, wait_for_group});
+  const auto batch = _group_commit_started_batch_count;
+  if (wait_for_group) {
+    ++_group_commit_queued_waiter_count;
+  }
+
+  while (true) {
+    if (!_group_commit_leader_active) {
+      _lead_group_commits(lock);
+    }
+
+    if (!wait_for_group) {
+      return;
+    }
+
+    if (_group_commit_committed_batch_count > batch) {
+      break;
+    }
+
+    _group_commit_cv.wait(lock);
+  }
+
+  // If the records of the transaction could not be committed, the leader rolled it back and left the exception for us.
+  const auto failure = _group_commit_failures.find(transaction_context.get());
+  if (failure != _group_commit_failures.end()) {
+    const auto exception = failure->second;
+    _group_commit_failures.erase(failure);
+    std::rethrow_exception(exception);
+  }
+}
+
+void TransactionManager::_lead_group_commits(std::unique_lock<std::mutex>& lock) {
+  DebugAssert(lock.owns_lock() && !_group_commit_leader_active, "Expected to hold the lock without a leader.");
+  _group_commit_leader_active = true;
+
+  while (!_group_commit_queue.empty()) {
+    const auto group = std::make_shared<std::vector<GroupCommitEntry>>();
+    std::swap(*group, _group_commit_queue);
+    ++_group_commit_started_batch_count;
+    for (const auto& entry : *group) {
+      if (entry.is_waiting) {
+        --_group_commit_queued_waiter_count;
+      }
+    }
+
+    lock.unlock();
+    try {
+      _commit_group(group);
+    } catch (...) {
+      // Committing the batch failed as a whole (failures of single transactions are handled by _commit_group). All of
+      // its transactions that have not been committed fail.
+      for (auto& entry : *group) {
+        if (!entry.exception && entry.transaction_context->phase() == TransactionPhase::Committing) {
+          entry.exception = std::current_exception();
+        }
+      }
+    }
+
+    // Transactions whose records could not be committed are rolled back. Committers that wait for the batch observe
+    // the failure in _group_commit, the others are notified by their callback (see TransactionContext::commit_async).
+    for (const auto& entry : *group) {
+      if (!entry.exception) {
+        continue;
+      }
+
+      entry.transaction_context->_rollback_failed_commit();
+      if (!entry.is_waiting && entry.callback) {
+        entry.callback(entry.transaction_context->transaction_id());
+      }
+    }
+    lock.lock();
+
+    for (const auto& entry : *group) {
+      if (entry.exception && entry.is_waiting) {
+        _group_commit_failures.emplace(entry.transaction_context.get(), entry.exception);
+      }
+    }
+    ++_group_commit_committed_batch_count;
+
+    // Hand off the leadership to a committer that waits for the next batch anyway.
+    if (_group_commit_queued_waiter_count > 0) {
+      break;
+    }
+  }
+
+  _group_commit_leader_active = false;
+  _group_commit_cv.notify_all();
+}
+
+void TransactionManager::_commit_group(const std::shared_ptr<std::vector<GroupCommitEntry>>& group) {
+  const auto commit_context = _new_commit_context();
+  const auto commit_id = commit_context->commit_id();
+
+  // A failing commit only affects the transaction whose records could not be committed. The other transactions of the
+  // group are committed nonetheless, as they cannot have modified the same rows.
+  const auto commit_records = [&](GroupCommitEntry& entry) {
+    entry.transaction_context->_commit_context = commit_context;
+    try {
+      for (const auto& op : entry.transaction_context->read_write_operators()) {
+        op->commit_records(commit_id);
+      }
+    } catch (...) {
+      entry.exception = std::current_exception();
+    }
+  };
+
+  // Write the commit ID to the MVCC data of the transactions in parallel. We only do so on a worker thread: While
+  // waiting, a worker executes the jobs itself, even if all other workers are blocked in TransactionContext::commit()
+  // waiting for this group.
+  if (group->size() > 1 && Worker::get_this_thread_worker()) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(group->size());
+    for (auto& entry : *group) {
+      jobs.emplace_back(std::make_shared<JobTask>([&commit_records, &entry]() { commit_records(entry); }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  } else {
+    for (auto& entry : *group) {
+      commit_records(entry);
+    }
+  }
+
+  // As in TransactionContext::_mark_as_pending_and_try_commit, the callback only holds weak pointers to the
+  // transaction contexts, because the commit context might outlive them.
+  auto committed_transactions =
+      std::vector<std::tuple<std::weak_ptr<TransactionContext>, TransactionID, std::function<void(TransactionID)>>>{};
+  committed_transactions.reserve(group->size());
+  for (const auto& entry : *group) {
+    if (entry.exception) {
+      continue;
+    }
+
+    committed_transactions.emplace_back(entry.transaction_context, entry.transaction_context->transaction_id(),
+                                        entry.callback);
+  }
+
+  // A single publication of the commit ID makes the changes of all transactions in the group visible.
+  commit_context->make_pending(TransactionID{0}, [committed_transactions = std::move(committed_transactions)](
+                                                     const TransactionID /*transaction_id*/) {
+    for (const auto& [context_weak_ptr, transaction_id, callback] : committed_transactions) {
+      if (const auto context_ptr = context_weak_ptr.lock()) {
+        context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
+      }
+
+      if (callback) {
+        callback(transaction_id);
+      }
+    }
+  });
+
+  _try_increment_last_commit_id(commit_context);
+}
+
 }  // namespace hyrise
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "types.hpp"
 
@@ -34,6 +40,10 @@
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
  * a new commit ID that is used to make its changes visible to others.
+ *
+ * With group commit enabled, transactions that commit concurrently share a CommitContext and thus a commit ID. This
+ * is valid because transactions that commit concurrently cannot have modified the same rows (the row locks of the
+ * MVCC data prevent that). See TransactionManager::_group_commit.
  */
 
 namespace hyrise {
@@ -62,10 +72,21 @@ class TransactionManager : public Noncopyable {
   std::shared_ptr<TransactionContext> new_transaction_context(const AutoCommit auto_commit);
 
   /**
-   * Returns the lowest snapshot-commit-id currently used by a transaction.
+   * Returns the lowest snapshot-commit-id currently used by a transaction. Scans the snapshot slots (see below) and is
+   * meant to be called rarely (e.g., by the MvccDeletePlugin), not per transaction.
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
+  /**
+   * Enables or disables group commit (disabled by default). Instead of acquiring one commit ID per transaction and
+   * publishing them one after another, concurrently committing transactions are batched: One of them, the leader,
+   * acquires a single commit ID for the whole batch, writes it to the MVCC data of all transactions in parallel, and
+   * publishes it with a single update of the last commit ID. Transactions that commit while the leader is busy form
+   * the next batch.
+   */
+  void set_group_commit(const bool group_commit);
+  bool group_commit() const;
+
  private:
   TransactionManager();
   ~TransactionManager();
@@ -79,13 +100,47 @@ class TransactionManager : public Noncopyable {
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
   /**
-   * The TransactionManager keeps track of issued snapshot-commit-ids,
-   * which are in use by unfinished transactions.
-   * The following two functions are used to keep the multiset of active
-   * snapshot-commit-ids up to date.
+   * Adds a transaction in the Committing phase to the next group commit. If no other transaction is currently leading
+   * the group commits, the calling thread becomes the leader (see _lead_group_commits). The callback is called once the
+   * transaction's batch is committed. If `wait_for_group` is set, the call only returns after the batch of the
+   * transaction has been committed. While waiting, the thread takes over the leadership if it is handed off. If the
+   * records of the transaction could not be committed, the transaction is rolled back and, if `wait_for_group` is set,
+   * the exception is rethrown. Otherwise, the callback is called nonetheless.
+   */
+  void _group_commit(const std::shared_ptr<TransactionContext>& transaction_context,
+                     const std::function<void(TransactionID)>& callback, const bool wait_for_group);
+
+  struct GroupCommitEntry {
+    std::shared_ptr<TransactionContext> transaction_context;
+    std::function<void(TransactionID)> callback;
+    bool is_waiting{false};
+    // Set if the records of the transaction could not be committed.
+    std::exception_ptr exception{};
+  };
+
+  /**
+   * Commits the queued batches as the leader. Expects `lock` to hold _group_commit_mutex and releases it while
+   * committing. To not keep a committing thread busy forever under sustained load, the leader hands off the leadership
+   * to a waiting committer after each batch. Only if no queued committer waits (i.e., all used commit_async), the
+   * leader continues until the queue is empty. If committing a batch throws, the transactions of the batch that were
+   * not committed are rolled back. The leader continues, so that later commits are not queued without a leader.
+   */
+  void _lead_group_commits(std::unique_lock<std::mutex>& lock);
+
+  void _commit_group(const std::shared_ptr<std::vector<GroupCommitEntry>>& group);
+
+  /**
+   * The TransactionManager keeps track of issued snapshot-commit-ids, which are in use by unfinished transactions.
+   * Instead of a single mutex-protected set, which becomes a bottleneck with many short transactions on many cores,
+   * each transaction claims one of the cache-line-sized snapshot slots with a single compare-and-swap. Threads start
+   * probing at the slot they used last, so a thread usually finds its own, uncontended slot. Only if all slots are
+   * taken, the snapshot-commit-id is stored in the mutex-protected overflow multiset.
+   *
+   * _register_transaction returns the slot that has to be passed to _deregister_transaction. Registration and
+   * deregistration may happen on different threads.
    */
-  void _register_transaction(CommitID snapshot_commit_id);
-  void _deregister_transaction(CommitID snapshot_commit_id);
+  size_t _register_transaction(CommitID snapshot_commit_id);
+  void _deregister_transaction(CommitID snapshot_commit_id, size_t snapshot_slot);
 
   // We use the base type here, as `_next_transaction_id` is not passed further around and atomic operations such as
   // `++_next_transactions_id` are not directly possible with an `std::atomic<TransactionID>`.
@@ -98,7 +153,36 @@ class TransactionManager : public Noncopyable {
 
   std::shared_ptr<CommitContext> _last_commit_context;
 
-  mutable std::mutex _active_snapshot_commit_ids_mutex;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  std::atomic_bool _group_commit_enabled{false};
+  std::mutex _group_commit_mutex;
+  // Notifies waiting committers that a batch was committed or that the leadership was handed off.
+  std::condition_variable _group_commit_cv;
+  std::vector<GroupCommitEntry> _group_commit_queue;
+  bool _group_commit_leader_active{false};
+  // Number of entries in _group_commit_queue whose committers wait for their batch.
+  size_t _group_commit_queued_waiter_count{0};
+  // Batches are numbered in the order in which they are taken from the queue. The entries that are currently queued
+  // form batch _group_commit_started_batch_count. As batches are committed one after another, all batches with a lower
+  // number than _group_commit_committed_batch_count are committed.
+  uint64_t _group_commit_started_batch_count{0};
+  uint64_t _group_commit_committed_batch_count{0};
+  // Exceptions of waiting committers whose transactions could not be committed, rethrown by _group_commit.
+  std::unordered_map<const TransactionContext*, std::exception_ptr> _group_commit_failures;
+
+  static constexpr auto SNAPSHOT_SLOT_COUNT = size_t{1024};
+  // Returned by _register_transaction if the snapshot-commit-id was stored in the overflow multiset.
+  static constexpr auto OVERFLOW_SNAPSHOT_SLOT = SNAPSHOT_SLOT_COUNT;
+  static constexpr auto UNUSED_SNAPSHOT_SLOT = CommitID{std::numeric_limits<CommitID::base_type>::max()};
+
+  // Padded to a cache line so that transactions on different cores do not invalidate each other's slots.
+  struct alignas(64) SnapshotSlot {
+    std::atomic<CommitID> snapshot_commit_id{UNUSED_SNAPSHOT_SLOT};
+  };
+
+  std::array<SnapshotSlot, SNAPSHOT_SLOT_COUNT> _snapshot_slots;
+
+  std::atomic_size_t _overflow_snapshot_commit_id_count{0};
+  mutable std::mutex _overflow_snapshot_commit_ids_mutex;
+  std::unordered_multiset<CommitID> _overflow_snapshot_commit_ids;
 };
 }  // namespace hyrise
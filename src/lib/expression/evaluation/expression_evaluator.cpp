@@ -1,8 +1,11 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
+#include <unordered_map>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/apply_visitor.hpp>
 
@@ -66,6 +69,29 @@ void resolve_binary_predicate_evaluator(const PredicateCondition predicate_condi
   // clang-format on
 }
 
+// Number of distinct parameter combinations for which the copies of a correlated subquery are scheduled at once.
+constexpr auto CORRELATED_SUBQUERY_BATCH_SIZE = size_t{64};
+
+// Hashes and compares the parameter values of a correlated subquery. Other than the comparison of AllTypeVariants, two
+// NULLs are considered equal here, as they lead to the same subquery result.
+struct SubqueryParameterValuesHash {
+  size_t operator()(const std::vector<AllTypeVariant>& parameter_values) const {
+    auto hash = size_t{0};
+    for (const auto& value : parameter_values) {
+      boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+    }
+    return hash;
+  }
+};
+
+struct SubqueryParameterValuesEqual {
+  bool operator()(const std::vector<AllTypeVariant>& lhs, const std::vector<AllTypeVariant>& rhs) const {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const auto& lhs_value, const auto& rhs_value) {
+      return variant_is_null(lhs_value) ? variant_is_null(rhs_value) : lhs_value == rhs_value;
+    });
+  }
+};
+
 std::shared_ptr<AbstractExpression> rewrite_between_expression(const AbstractExpression& expression) {
   // `a BETWEEN b AND c` --> `a >= b AND a <= c`
   //
@@ -328,11 +354,11 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
     // E.g., `a LIKE '%hello%'` -- A single matcher for all rows
     const auto like_matcher = LikeMatcher{right_results->values.front()};
 
-    for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-      like_matcher.resolve(invert_results, [&](const auto& matcher) {
+    like_matcher.resolve(invert_results, [&](const auto& matcher) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
         result_values[row_idx] = matcher(left_results->values[row_idx]);
-      });
-    }
+      }
+    });
   } else {
     // E.g., `'hello' LIKE b` -- A new matcher for each row but the value to check is constant
     for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
@@ -938,54 +964,84 @@ std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_subquer
     return {expression.pqp->get_output()};
   }
 
+  Assert(_chunk, "Sub-SELECT references external Columns but Expression doesn't operate on a Table/Chunk");
+
   // Make sure all columns (i.e., segments) that are parameters are materialized.
   for (const auto& parameter : expression.parameters) {
     _materialize_segment_if_not_yet_materialized(parameter.second);
   }
 
-  auto results = std::vector<std::shared_ptr<const Table>>{_output_row_count};
+  // Correlated subqueries are only executed once per distinct combination of parameter values. Rows with the same
+  // parameter values (e.g., the same foreign key) share the result of a single execution.
+  const auto parameter_count = expression.parameters.size();
+  auto distinct_parameter_values = std::vector<std::vector<AllTypeVariant>>{};
+  auto parameter_values_indexes = std::unordered_map<std::vector<AllTypeVariant>, size_t, SubqueryParameterValuesHash,
+                                                     SubqueryParameterValuesEqual>{};
+  auto row_parameter_values_indexes = std::vector<size_t>(_output_row_count);
 
   for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
-    results[chunk_offset] = _evaluate_subquery_expression_for_row(expression, chunk_offset);
-  }
+    auto parameter_values = std::vector<AllTypeVariant>{};
+    parameter_values.reserve(parameter_count);
+    for (const auto& [_, column_id] : expression.parameters) {
+      parameter_values.emplace_back(_segment_materializations[column_id]->value_as_variant(chunk_offset));
+    }
 
-  return results;
-}
+    const auto [iter, inserted] =
+        parameter_values_indexes.try_emplace(std::move(parameter_values), distinct_parameter_values.size());
+    if (inserted) {
+      distinct_parameter_values.emplace_back(iter->first);
+    }
+    row_parameter_values_indexes[chunk_offset] = iter->second;
+  }
 
-std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_for_row(
-    const PQPSubqueryExpression& expression, const ChunkOffset chunk_offset) {
-  Assert(expression.parameters.empty() || _chunk,
-         "Sub-SELECT references external Columns but Expression doesn't operate on a Table/Chunk");
+  const auto distinct_results = _evaluate_correlated_subquery_expression(expression, distinct_parameter_values);
 
-  const auto expression_parameter_count = expression.parameters.size();
-  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
-  parameters.reserve(expression_parameter_count);
+  auto results = std::vector<std::shared_ptr<const Table>>(_output_row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count); ++chunk_offset) {
+    results[chunk_offset] = distinct_results[row_parameter_values_indexes[chunk_offset]];
+  }
 
-  for (auto parameter_idx = size_t{0}; parameter_idx < expression_parameter_count; ++parameter_idx) {
-    const auto& parameter_id_column_id = expression.parameters[parameter_idx];
-    const auto parameter_id = parameter_id_column_id.first;
-    const auto column_id = parameter_id_column_id.second;
+  return results;
+}
 
-    const auto value = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+std::vector<std::shared_ptr<const Table>> ExpressionEvaluator::_evaluate_correlated_subquery_expression(
+    const PQPSubqueryExpression& expression, const std::vector<std::vector<AllTypeVariant>>& parameter_values) {
+  const auto parameter_values_count = parameter_values.size();
+  const auto parameter_count = expression.parameters.size();
+  auto results = std::vector<std::shared_ptr<const Table>>(parameter_values_count);
+
+  // Operators cache results which we cannot reuse in correlated subqueries due to changing parameters. Therefore, PQPs
+  // are deep-copied to ensure that we start without cached results. Instead of executing the copies one after another,
+  // we schedule the tasks of a batch of copies together so that the scheduler can execute them concurrently.
+  for (auto batch_begin = size_t{0}; batch_begin < parameter_values_count;
+       batch_begin += CORRELATED_SUBQUERY_BATCH_SIZE) {
+    const auto batch_end = std::min(batch_begin + CORRELATED_SUBQUERY_BATCH_SIZE, parameter_values_count);
+
+    auto pqps = std::vector<std::shared_ptr<AbstractOperator>>{};
+    pqps.reserve(batch_end - batch_begin);
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+    for (auto values_idx = batch_begin; values_idx < batch_end; ++values_idx) {
+      auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+      parameters.reserve(parameter_count);
+      for (auto parameter_idx = size_t{0}; parameter_idx < parameter_count; ++parameter_idx) {
+        parameters.emplace(expression.parameters[parameter_idx].first, parameter_values[values_idx][parameter_idx]);
+      }
 
-    parameters.emplace(parameter_id, value);
-  }
+      const auto& pqp = pqps.emplace_back(expression.pqp->deep_copy());
+      pqp->set_parameters(parameters);
+      const auto& [pqp_tasks, _] = OperatorTask::make_tasks_from_operator(pqp);
+      tasks.insert(tasks.end(), pqp_tasks.begin(), pqp_tasks.end());
+    }
 
-  auto row_pqp = expression.pqp;
-  if (expression.is_correlated()) {
-    // Operators cache results which we cannot reuse in correlated subqueries due to changing parameters.
-    // Therefore, PQPs are deep-copied to ensure that we start without cached results.
-    row_pqp = expression.pqp->deep_copy();
-    row_pqp->set_parameters(parameters);
-    const auto& [tasks, _] = OperatorTask::make_tasks_from_operator(row_pqp);
     Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
-  } else {
-    // Uncorrelated subqueries should have been scheduled and executed just like regular input operators.
-    Assert(row_pqp->state() == OperatorState::ExecutedAndAvailable,
-           "Uncorrelated subquery was not executed or has already been cleared.");
+
+    for (auto values_idx = batch_begin; values_idx < batch_end; ++values_idx) {
+      results[values_idx] = pqps[values_idx - batch_begin]->get_output();
+    }
   }
 
-  return row_pqp->get_output();
+  return results;
 }
 
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
@@ -96,8 +96,10 @@ class ExpressionEvaluator final {
   std::vector<std::shared_ptr<const Table>> _evaluate_subquery_expression_to_tables(
       const PQPSubqueryExpression& expression);
 
-  std::shared_ptr<const Table> _evaluate_subquery_expression_for_row(const PQPSubqueryExpression& expression,
-                                                                     const ChunkOffset chunk_offset);
+  // Executes a correlated subquery once for each of the given combinations of parameter values. The values are ordered
+  // like expression.parameters.
+  static std::vector<std::shared_ptr<const Table>> _evaluate_correlated_subquery_expression(
+      const PQPSubqueryExpression& expression, const std::vector<std::vector<AllTypeVariant>>& parameter_values);
 
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_column_expression(const PQPColumnExpression& column_expression);
@@ -0,0 +1,1043 @@
+#include "expression_program.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/arithmetic_expression.hpp"
+#include "expression/between_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/is_null_expression.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "expression/unary_minus_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+// The registers and selections of the program currently executed on a thread. They are allocated once per thread and
+// reused by all programs (see thread_state()).
+struct ExpressionProgramState {
+  struct RegisterView {
+    const void* values{};
+
+    // nullptr if none of the selected rows is NULL
+    const uint8_t* nulls{};
+  };
+
+  // Either the rows [0, size) of the batch (dense) or the rows listed in `offsets`
+  struct Selection {
+    const uint16_t* offsets{};
+    size_t size{};
+    bool is_dense{};
+  };
+
+  std::vector<RegisterView> registers;
+
+  // Memory for the registers written by instructions and for literals. One byte per row for NULL flags (instead of
+  // a bitmap) keeps the kernels simple enough to be vectorized by the compiler.
+  std::vector<std::vector<std::byte>> value_buffers;
+  std::vector<std::vector<uint8_t>> null_buffers;
+
+  // Input columns of the current chunk. Columns stored in ValueSegments are not copied, but only their NULL flags.
+  std::vector<std::vector<std::byte>> column_value_buffers;
+  std::vector<std::vector<uint8_t>> column_null_buffers;
+  std::vector<const std::byte*> column_values;
+  std::vector<const uint8_t*> column_nulls;
+  std::vector<size_t> column_value_sizes;
+
+  std::vector<Selection> selections;
+  std::vector<std::vector<uint16_t>> selection_buffers;
+  size_t selection_depth{};
+
+  std::vector<uint8_t> no_nulls;
+
+  bool in_use{};
+};
+
+}  // namespace hyrise
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+using Instruction = ExpressionProgramInstruction;
+using State = ExpressionProgramState;
+
+constexpr auto BATCH_SIZE = ExpressionProgram::BATCH_SIZE;
+static_assert(BATCH_SIZE <= size_t{std::numeric_limits<uint16_t>::max()} + 1, "Selections store uint16_t offsets");
+
+// Large enough for all numeric data types
+constexpr auto REGISTER_BUFFER_SIZE = BATCH_SIZE * sizeof(double);
+
+// The buffers of a thread's state are kept for later programs unless they exceed this size in total (e.g., after a
+// program with many registers or after materializing many input columns of large chunks).
+constexpr auto MAX_RETAINED_STATE_SIZE = size_t{8 * 1024 * 1024};
+
+State& thread_state() {
+  thread_local auto state = State{};
+  return state;
+}
+
+size_t retained_size(const State& state) {
+  auto size = size_t{0};
+  for (const auto* buffers : {&state.value_buffers, &state.column_value_buffers}) {
+    for (const auto& buffer : *buffers) {
+      size += buffer.capacity();
+    }
+  }
+  for (const auto* buffers : {&state.null_buffers, &state.column_null_buffers}) {
+    for (const auto& buffer : *buffers) {
+      size += buffer.capacity();
+    }
+  }
+  for (const auto& buffer : state.selection_buffers) {
+    size += buffer.capacity() * sizeof(uint16_t);
+  }
+  return size;
+}
+
+// Marks the state of the current thread as in use for its lifetime. The state is released on scope exit even if
+// executing the program throws (e.g., in a Fail()), so that later programs on this thread are not rejected. If the
+// buffers of the state grew beyond MAX_RETAINED_STATE_SIZE, they are freed.
+class StateUsageGuard : public Noncopyable {
+ public:
+  explicit StateUsageGuard(State& state) : _state(state) {
+    Assert(!_state.in_use, "ExpressionPrograms cannot be executed recursively on the same thread");
+    _state.in_use = true;
+  }
+
+  ~StateUsageGuard() {
+    if (retained_size(_state) > MAX_RETAINED_STATE_SIZE) {
+      _state = State{};
+    }
+    _state.in_use = false;
+  }
+
+ private:
+  State& _state;
+};
+
+template <typename Functor>
+void resolve_numeric_data_type(const DataType data_type, const Functor& functor) {
+  // clang-format off
+  switch (data_type) {
+    case DataType::Int:    functor(boost::hana::type<int32_t>{}); break;
+    case DataType::Long:   functor(boost::hana::type<int64_t>{}); break;
+    case DataType::Float:  functor(boost::hana::type<float>{});   break;
+    case DataType::Double: functor(boost::hana::type<double>{});  break;
+    default: Fail("Expected numeric data type");
+  }
+  // clang-format on
+}
+
+bool is_numeric_data_type(const DataType data_type) {
+  return data_type == DataType::Int || data_type == DataType::Long || data_type == DataType::Float ||
+         data_type == DataType::Double;
+}
+
+// The type in which C++ (and thus the ExpressionEvaluator, see STLArithmeticFunctorWrapper) computes `left op right`.
+// This is not always the same as expression_common_type(), e.g., long + float is computed as float.
+DataType computation_data_type(const DataType left, const DataType right) {
+  auto data_type = DataType::Null;
+  resolve_numeric_data_type(left, [&](const auto left_data_type_t) {
+    using LeftDataType = typename decltype(left_data_type_t)::type;
+    resolve_numeric_data_type(right, [&](const auto right_data_type_t) {
+      using RightDataType = typename decltype(right_data_type_t)::type;
+      data_type = data_type_from_type<std::common_type_t<LeftDataType, RightDataType>>();
+    });
+  });
+  return data_type;
+}
+
+const State::Selection& current_selection(const State& state) {
+  return state.selections[state.selection_depth];
+}
+
+template <typename Functor>
+void for_each_selected(const State::Selection& selection, const Functor& functor) {
+  if (selection.is_dense) {
+    for (auto offset = size_t{0}; offset < selection.size; ++offset) {
+      functor(offset);
+    }
+  } else {
+    for (auto index = size_t{0}; index < selection.size; ++index) {
+      functor(size_t{selection.offsets[index]});
+    }
+  }
+}
+
+template <typename T>
+const T* input_values(const State& state, const size_t register_id) {
+  return static_cast<const T*>(state.registers[register_id].values);
+}
+
+const uint8_t* input_nulls(const State& state, const size_t register_id) {
+  const auto* nulls = state.registers[register_id].nulls;
+  return nulls ? nulls : state.no_nulls.data();
+}
+
+template <typename T>
+T* output_values(State& state, const size_t register_id) {
+  return reinterpret_cast<T*>(state.value_buffers[register_id].data());
+}
+
+uint8_t* output_nulls(State& state, const size_t register_id) {
+  auto* nulls = state.null_buffers[register_id].data();
+  state.registers[register_id].nulls = nulls;
+  return nulls;
+}
+
+// The result is NULL if any operand is NULL (cf. ExpressionEvaluator::_evaluate_default_null_logic())
+void propagate_nulls(const Instruction& instruction, State& state) {
+  const auto* left_nulls = state.registers[instruction.operand_registers[0]].nulls;
+  const auto* right_nulls = state.registers[instruction.operand_registers[1]].nulls;
+
+  if (!left_nulls || !right_nulls) {
+    // Each register is written only once per batch, so the result can share the NULL flags of the nullable operand.
+    state.registers[instruction.result_register].nulls = left_nulls ? left_nulls : right_nulls;
+    return;
+  }
+
+  auto* result_nulls = output_nulls(state, instruction.result_register);
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    result_nulls[offset] = static_cast<uint8_t>(left_nulls[offset] | right_nulls[offset]);
+  });
+}
+
+/**
+ * Kernels
+ */
+
+template <typename T, typename Result, typename Operator>
+bool binary_kernel(const Instruction& instruction, State& state) {
+  const auto* left = input_values<T>(state, instruction.operand_registers[0]);
+  const auto* right = input_values<T>(state, instruction.operand_registers[1]);
+  auto* result = output_values<Result>(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    result[offset] = static_cast<Result>(Operator{}(left[offset], right[offset]));
+  });
+
+  propagate_nulls(instruction, state);
+  return true;
+}
+
+struct DivisionOperator {
+  template <typename T>
+  T operator()(const T dividend, const T divisor) const {
+    return dividend / divisor;
+  }
+};
+
+struct ModuloOperator {
+  template <typename T>
+  T operator()(const T dividend, const T divisor) const {
+    if constexpr (std::is_integral_v<T>) {
+      return dividend % divisor;
+    } else {
+      return std::fmod(dividend, divisor);
+    }
+  }
+};
+
+// Division and modulo are NULL if the divisor is zero (see DivisionEvaluator and ModuloEvaluator)
+template <typename T, typename Operator>
+bool division_kernel(const Instruction& instruction, State& state) {
+  const auto* left = input_values<T>(state, instruction.operand_registers[0]);
+  const auto* right = input_values<T>(state, instruction.operand_registers[1]);
+  const auto* left_nulls = input_nulls(state, instruction.operand_registers[0]);
+  const auto* right_nulls = input_nulls(state, instruction.operand_registers[1]);
+  auto* result = output_values<T>(state, instruction.result_register);
+  auto* result_nulls = output_nulls(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    const auto divisor_is_zero = right[offset] == T{0};
+    // Rows with a zero divisor are NULL. Dividing by one instead avoids undefined behavior for integers.
+    const auto divisor = divisor_is_zero ? T{1} : right[offset];
+    result[offset] = divisor_is_zero ? T{0} : Operator{}(left[offset], divisor);
+    result_nulls[offset] = static_cast<uint8_t>(left_nulls[offset] | right_nulls[offset] | divisor_is_zero);
+  });
+
+  return true;
+}
+
+template <typename Source, typename Result>
+bool cast_kernel(const Instruction& instruction, State& state) {
+  const auto* argument = input_values<Source>(state, instruction.operand_registers[0]);
+  auto* result = output_values<Result>(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    result[offset] = static_cast<Result>(argument[offset]);
+  });
+
+  state.registers[instruction.result_register].nulls = state.registers[instruction.operand_registers[0]].nulls;
+  return true;
+}
+
+template <typename T>
+bool unary_minus_kernel(const Instruction& instruction, State& state) {
+  const auto* argument = input_values<T>(state, instruction.operand_registers[0]);
+  auto* result = output_values<T>(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    result[offset] = -argument[offset];
+  });
+
+  state.registers[instruction.result_register].nulls = state.registers[instruction.operand_registers[0]].nulls;
+  return true;
+}
+
+template <bool is_not_null>
+bool is_null_kernel(const Instruction& instruction, State& state) {
+  const auto* argument_nulls = input_nulls(state, instruction.operand_registers[0]);
+  auto* result = output_values<int32_t>(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    result[offset] = static_cast<int32_t>((argument_nulls[offset] != 0) != is_not_null);
+  });
+
+  state.registers[instruction.result_register].nulls = nullptr;
+  return true;
+}
+
+// SQL's ternary AND and OR (see TernaryAndEvaluator and TernaryOrEvaluator). If the left side decides the result, the
+// right side was not evaluated for that row (see narrow_selection_kernel()). Its values are arbitrary then, but do not
+// influence the result.
+template <LogicalOperator logical_operator>
+bool logical_kernel(const Instruction& instruction, State& state) {
+  const auto* left = input_values<int32_t>(state, instruction.operand_registers[0]);
+  const auto* right = input_values<int32_t>(state, instruction.operand_registers[1]);
+  const auto* left_nulls = input_nulls(state, instruction.operand_registers[0]);
+  const auto* right_nulls = input_nulls(state, instruction.operand_registers[1]);
+  auto* result = output_values<int32_t>(state, instruction.result_register);
+  auto* result_nulls = output_nulls(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    const auto left_is_null = left_nulls[offset] != 0;
+    const auto right_is_null = right_nulls[offset] != 0;
+    const auto left_is_true = !left_is_null && left[offset] != 0;
+    const auto right_is_true = !right_is_null && right[offset] != 0;
+
+    if constexpr (logical_operator == LogicalOperator::And) {
+      result[offset] = left_is_true && right_is_true;
+      result_nulls[offset] = (left_is_null && right_is_null) || (left[offset] != 0 && right_is_null) ||
+                             (right[offset] != 0 && left_is_null);
+    } else {
+      result[offset] = left_is_true || right_is_true;
+      result_nulls[offset] = (left_is_null || right_is_null) && !(left_is_true || right_is_true);
+    }
+  });
+
+  return true;
+}
+
+struct KeepNotFalse {
+  bool operator()(const int32_t value, const bool is_null) const {
+    return is_null || value != 0;
+  }
+};
+
+struct KeepNotTrue {
+  bool operator()(const int32_t value, const bool is_null) const {
+    return is_null || value == 0;
+  }
+};
+
+struct KeepTrue {
+  bool operator()(const int32_t value, const bool is_null) const {
+    return !is_null && value != 0;
+  }
+};
+
+// Pushes a selection of the currently selected rows for which `Predicate` holds on the condition register.
+template <typename Predicate>
+bool narrow_selection_kernel(const Instruction& instruction, State& state) {
+  const auto* condition = input_values<int32_t>(state, instruction.operand_registers[0]);
+  const auto* condition_nulls = input_nulls(state, instruction.operand_registers[0]);
+  const auto& outer_selection = current_selection(state);
+  auto* offsets = state.selection_buffers[state.selection_depth + 1].data();
+
+  // Branch-free compaction: Every offset is written, but only kept if the predicate holds.
+  auto size = size_t{0};
+  for_each_selected(outer_selection, [&](const auto offset) {
+    offsets[size] = static_cast<uint16_t>(offset);
+    size += static_cast<size_t>(Predicate{}(condition[offset], condition_nulls[offset] != 0));
+  });
+
+  ++state.selection_depth;
+  if (size == outer_selection.size) {
+    // Nothing was filtered. Keeping the outer selection keeps it dense, if it was.
+    state.selections[state.selection_depth] = outer_selection;
+  } else {
+    state.selections[state.selection_depth] = State::Selection{offsets, size, false};
+  }
+
+  return size > 0;
+}
+
+bool pop_selection_kernel(const Instruction& /*instruction*/, State& state) {
+  DebugAssert(state.selection_depth > 0, "No selection to pop");
+  --state.selection_depth;
+  return true;
+}
+
+// Used for CASE. THEN and ELSE were evaluated only for the rows where the condition is TRUE and where it is not.
+template <typename T>
+bool blend_kernel(const Instruction& instruction, State& state) {
+  const auto* condition = input_values<int32_t>(state, instruction.operand_registers[0]);
+  const auto* then_values = input_values<T>(state, instruction.operand_registers[1]);
+  const auto* else_values = input_values<T>(state, instruction.operand_registers[2]);
+  const auto* condition_nulls = input_nulls(state, instruction.operand_registers[0]);
+  const auto* then_nulls = input_nulls(state, instruction.operand_registers[1]);
+  const auto* else_nulls = input_nulls(state, instruction.operand_registers[2]);
+  auto* result = output_values<T>(state, instruction.result_register);
+  auto* result_nulls = output_nulls(state, instruction.result_register);
+
+  for_each_selected(current_selection(state), [&](const auto offset) {
+    const auto condition_is_true = condition_nulls[offset] == 0 && condition[offset] != 0;
+    result[offset] = condition_is_true ? then_values[offset] : else_values[offset];
+    result_nulls[offset] = condition_is_true ? then_nulls[offset] : else_nulls[offset];
+  });
+
+  return true;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+class ExpressionProgram::Compiler {
+ public:
+  struct Operand {
+    size_t register_id{};
+    DataType data_type{};
+    bool nullable{};
+  };
+
+  Compiler(ExpressionProgram& program, const Table& table) : _program(program), _table(table) {
+    _available_results.emplace_back();
+  }
+
+  std::optional<Operand> compile(const std::shared_ptr<const AbstractExpression>& expression) {
+    // Reuse the result of an equal sub-expression if it was computed in the current selection or in one enclosing it.
+    for (auto level = _available_results.size(); level > 0; --level) {
+      const auto& available_results = _available_results[level - 1];
+      const auto available_result_iter = available_results.find(expression);
+      if (available_result_iter != available_results.end()) {
+        return available_result_iter->second;
+      }
+    }
+
+    auto operand = std::optional<Operand>{};
+    // Columns and literals are not computed by instructions and are thus valid in all selections.
+    auto level = _available_results.size() - 1;
+
+    switch (expression->type) {
+      case ExpressionType::PQPColumn:
+        operand = _compile_column(static_cast<const PQPColumnExpression&>(*expression));
+        level = 0;
+        break;
+
+      case ExpressionType::Value:
+        operand = _compile_value(static_cast<const ValueExpression&>(*expression));
+        level = 0;
+        break;
+
+      case ExpressionType::Arithmetic:
+        operand = _compile_arithmetic(static_cast<const ArithmeticExpression&>(*expression));
+        break;
+
+      case ExpressionType::Predicate:
+        operand = _compile_predicate(static_cast<const AbstractPredicateExpression&>(*expression));
+        break;
+
+      case ExpressionType::Logical:
+        operand = _compile_logical(static_cast<const LogicalExpression&>(*expression));
+        break;
+
+      case ExpressionType::Case:
+        operand = _compile_case(static_cast<const CaseExpression&>(*expression));
+        break;
+
+      case ExpressionType::UnaryMinus:
+        operand = _compile_unary_minus(static_cast<const UnaryMinusExpression&>(*expression));
+        break;
+
+      default:
+        break;
+    }
+
+    if (operand) {
+      _available_results[level].emplace(expression, *operand);
+    }
+
+    return operand;
+  }
+
+ private:
+  std::optional<Operand> _compile_column(const PQPColumnExpression& column_expression) {
+    const auto data_type = column_expression.data_type();
+    if (!is_numeric_data_type(data_type) || _table.column_data_type(column_expression.column_id) != data_type) {
+      return std::nullopt;
+    }
+
+    return Operand{_add_register(data_type, column_expression.column_id), data_type,
+                   _table.column_is_nullable(column_expression.column_id)};
+  }
+
+  std::optional<Operand> _compile_value(const ValueExpression& value_expression) {
+    const auto& value = value_expression.value;
+    if (variant_is_null(value)) {
+      // NULLs are represented as Ints. As Int is the narrowest numeric type, they do not widen the other operand.
+      return Operand{_add_register(DataType::Int, std::nullopt, value), DataType::Int, true};
+    }
+
+    const auto data_type = data_type_from_all_type_variant(value);
+    if (!is_numeric_data_type(data_type)) {
+      return std::nullopt;
+    }
+
+    return Operand{_add_register(data_type, std::nullopt, value), data_type, false};
+  }
+
+  std::optional<Operand> _compile_arithmetic(const ArithmeticExpression& arithmetic_expression) {
+    const auto left = compile(arithmetic_expression.left_operand());
+    const auto right = compile(arithmetic_expression.right_operand());
+    const auto result_data_type = arithmetic_expression.data_type();
+    if (!left || !right || !is_numeric_data_type(result_data_type)) {
+      return std::nullopt;
+    }
+
+    // Mirror the types in which the functors of the ExpressionEvaluator compute their results.
+    const auto arithmetic_operator = arithmetic_expression.arithmetic_operator;
+    auto computation_type = computation_data_type(left->data_type, right->data_type);
+    if (arithmetic_operator == ArithmeticOperator::Division) {
+      computation_type = result_data_type;
+    } else if (arithmetic_operator == ArithmeticOperator::Modulo && is_floating_point_data_type(computation_type)) {
+      // std::fmod() computes in double unless both operands are floats.
+      computation_type = left->data_type == DataType::Float && right->data_type == DataType::Float ? DataType::Float
+                                                                                                   : DataType::Double;
+    }
+
+    auto kernel = Instruction::Kernel{};
+    resolve_numeric_data_type(computation_type, [&](const auto data_type_t) {
+      using ComputationType = typename decltype(data_type_t)::type;
+
+      switch (arithmetic_operator) {
+        case ArithmeticOperator::Addition:
+          kernel = &binary_kernel<ComputationType, ComputationType, std::plus<ComputationType>>;
+          break;
+        case ArithmeticOperator::Subtraction:
+          kernel = &binary_kernel<ComputationType, ComputationType, std::minus<ComputationType>>;
+          break;
+        case ArithmeticOperator::Multiplication:
+          kernel = &binary_kernel<ComputationType, ComputationType, std::multiplies<ComputationType>>;
+          break;
+        case ArithmeticOperator::Division:
+          kernel = &division_kernel<ComputationType, DivisionOperator>;
+          break;
+        case ArithmeticOperator::Modulo:
+          kernel = &division_kernel<ComputationType, ModuloOperator>;
+          break;
+      }
+    });
+
+    // Division and modulo are NULL if the divisor is zero, which can only be ruled out for literals.
+    const auto is_division = arithmetic_operator == ArithmeticOperator::Division ||
+                             arithmetic_operator == ArithmeticOperator::Modulo;
+    const auto nullable = left->nullable || right->nullable || (is_division && !_is_non_zero_literal(*right));
+    const auto result = _emit(kernel, computation_type, nullable,
+                              {_emit_cast(*left, computation_type), _emit_cast(*right, computation_type)});
+    return _emit_cast(result, result_data_type);
+  }
+
+  std::optional<Operand> _compile_predicate(const AbstractPredicateExpression& predicate_expression) {
+    const auto predicate_condition = predicate_expression.predicate_condition;
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+      case PredicateCondition::NotEquals:
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals: {
+        const auto left = compile(predicate_expression.arguments[0]);
+        const auto right = compile(predicate_expression.arguments[1]);
+        if (!left || !right) {
+          return std::nullopt;
+        }
+        return _emit_comparison(predicate_condition, *left, *right);
+      }
+
+      case PredicateCondition::BetweenInclusive:
+      case PredicateCondition::BetweenLowerExclusive:
+      case PredicateCondition::BetweenUpperExclusive:
+      case PredicateCondition::BetweenExclusive: {
+        // `a BETWEEN b AND c` is evaluated as `a >= b AND a <= c`, with `a` being evaluated only once.
+        const auto& between_expression = static_cast<const BetweenExpression&>(predicate_expression);
+        const auto operand = compile(between_expression.operand());
+        const auto lower_bound = compile(between_expression.lower_bound());
+        if (!operand || !lower_bound) {
+          return std::nullopt;
+        }
+
+        const auto lower_predicate_condition = is_lower_inclusive_between(predicate_condition)
+                                                   ? PredicateCondition::GreaterThanEquals
+                                                   : PredicateCondition::GreaterThan;
+        const auto upper_predicate_condition = is_upper_inclusive_between(predicate_condition)
+                                                   ? PredicateCondition::LessThanEquals
+                                                   : PredicateCondition::LessThan;
+
+        const auto lower_result = _emit_comparison(lower_predicate_condition, *operand, *lower_bound);
+        return _emit_lazy_logical(LogicalOperator::And, lower_result, [&]() -> std::optional<Operand> {
+          const auto upper_bound = compile(between_expression.upper_bound());
+          if (!upper_bound) {
+            return std::nullopt;
+          }
+          return _emit_comparison(upper_predicate_condition, *operand, *upper_bound);
+        });
+      }
+
+      case PredicateCondition::IsNull:
+      case PredicateCondition::IsNotNull: {
+        const auto argument = compile(static_cast<const IsNullExpression&>(predicate_expression).operand());
+        if (!argument) {
+          return std::nullopt;
+        }
+
+        const auto kernel =
+            predicate_condition == PredicateCondition::IsNull ? &is_null_kernel<false> : &is_null_kernel<true>;
+        return _emit(kernel, DataType::Int, false, {*argument});
+      }
+
+      default:
+        return std::nullopt;
+    }
+  }
+
+  std::optional<Operand> _compile_logical(const LogicalExpression& logical_expression) {
+    const auto left = compile(logical_expression.left_operand());
+    if (!left) {
+      return std::nullopt;
+    }
+
+    return _emit_lazy_logical(logical_expression.logical_operator, *left,
+                              [&]() { return compile(logical_expression.right_operand()); });
+  }
+
+  std::optional<Operand> _compile_case(const CaseExpression& case_expression) {
+    const auto condition = compile(case_expression.when());
+    const auto result_data_type = case_expression.data_type();
+    if (!condition || condition->data_type != DataType::Int || !is_numeric_data_type(result_data_type)) {
+      return std::nullopt;
+    }
+
+    // THEN is evaluated for the rows where the condition is TRUE, ELSE for all others.
+    const auto compile_branch = [&](const auto narrow_kernel, const auto& expression) -> std::optional<Operand> {
+      const auto narrow_instruction_id = _push_selection(narrow_kernel, *condition);
+      const auto branch = compile(expression);
+      const auto result = branch ? std::optional<Operand>{_emit_cast(*branch, result_data_type)} : std::nullopt;
+      _pop_selection(narrow_instruction_id);
+      return result;
+    };
+
+    const auto then_result = compile_branch(&narrow_selection_kernel<KeepTrue>, case_expression.then());
+    const auto else_result = compile_branch(&narrow_selection_kernel<KeepNotTrue>, case_expression.otherwise());
+    if (!then_result || !else_result) {
+      return std::nullopt;
+    }
+
+    auto kernel = Instruction::Kernel{};
+    resolve_numeric_data_type(result_data_type, [&](const auto data_type_t) {
+      kernel = &blend_kernel<typename decltype(data_type_t)::type>;
+    });
+
+    // A NULL condition selects ELSE, so only the branches determine whether the result can be NULL.
+    return _emit(kernel, result_data_type, then_result->nullable || else_result->nullable,
+                 {*condition, *then_result, *else_result});
+  }
+
+  std::optional<Operand> _compile_unary_minus(const UnaryMinusExpression& unary_minus_expression) {
+    const auto argument = compile(unary_minus_expression.argument());
+    if (!argument || unary_minus_expression.data_type() != argument->data_type) {
+      return std::nullopt;
+    }
+
+    auto kernel = Instruction::Kernel{};
+    resolve_numeric_data_type(argument->data_type, [&](const auto data_type_t) {
+      kernel = &unary_minus_kernel<typename decltype(data_type_t)::type>;
+    });
+
+    return _emit(kernel, argument->data_type, argument->nullable, {*argument});
+  }
+
+  Operand _emit_comparison(const PredicateCondition predicate_condition, const Operand& left, const Operand& right) {
+    // As in the ExpressionEvaluator, > and >= are flipped to reduce the number of kernels.
+    const auto flip = predicate_condition == PredicateCondition::GreaterThan ||
+                      predicate_condition == PredicateCondition::GreaterThanEquals;
+    const auto flipped_predicate_condition = flip ? flip_predicate_condition(predicate_condition) : predicate_condition;
+    const auto& flipped_left = flip ? right : left;
+    const auto& flipped_right = flip ? left : right;
+
+    const auto computation_type = computation_data_type(left.data_type, right.data_type);
+
+    auto kernel = Instruction::Kernel{};
+    resolve_numeric_data_type(computation_type, [&](const auto data_type_t) {
+      using ComputationType = typename decltype(data_type_t)::type;
+
+      switch (flipped_predicate_condition) {
+        case PredicateCondition::Equals:
+          kernel = &binary_kernel<ComputationType, int32_t, std::equal_to<ComputationType>>;
+          break;
+        case PredicateCondition::NotEquals:
+          kernel = &binary_kernel<ComputationType, int32_t, std::not_equal_to<ComputationType>>;
+          break;
+        case PredicateCondition::LessThan:
+          kernel = &binary_kernel<ComputationType, int32_t, std::less<ComputationType>>;
+          break;
+        case PredicateCondition::LessThanEquals:
+          kernel = &binary_kernel<ComputationType, int32_t, std::less_equal<ComputationType>>;
+          break;
+        default:
+          Fail("Unexpected PredicateCondition");
+      }
+    });
+
+    return _emit(kernel, DataType::Int, left.nullable || right.nullable,
+                 {_emit_cast(flipped_left, computation_type), _emit_cast(flipped_right, computation_type)});
+  }
+
+  template <typename CompileRight>
+  std::optional<Operand> _emit_lazy_logical(const LogicalOperator logical_operator, const Operand& left,
+                                            const CompileRight& compile_right) {
+    if (left.data_type != DataType::Int) {
+      return std::nullopt;
+    }
+
+    // The right side is only evaluated for the rows where the left side does not decide the result.
+    const auto narrow_kernel = logical_operator == LogicalOperator::And ? &narrow_selection_kernel<KeepNotFalse>
+                                                                        : &narrow_selection_kernel<KeepNotTrue>;
+    const auto narrow_instruction_id = _push_selection(narrow_kernel, left);
+    const auto right = compile_right();
+    _pop_selection(narrow_instruction_id);
+
+    if (!right || right->data_type != DataType::Int) {
+      return std::nullopt;
+    }
+
+    const auto kernel = logical_operator == LogicalOperator::And ? &logical_kernel<LogicalOperator::And>
+                                                                 : &logical_kernel<LogicalOperator::Or>;
+    // The result can only be NULL if one of the sides can be NULL.
+    return _emit(kernel, DataType::Int, left.nullable || right->nullable, {left, *right});
+  }
+
+  Operand _emit_cast(const Operand& operand, const DataType data_type) {
+    if (operand.data_type == data_type) {
+      return operand;
+    }
+
+    auto kernel = Instruction::Kernel{};
+    resolve_numeric_data_type(operand.data_type, [&](const auto source_data_type_t) {
+      resolve_numeric_data_type(data_type, [&](const auto result_data_type_t) {
+        kernel = &cast_kernel<typename decltype(source_data_type_t)::type, typename decltype(result_data_type_t)::type>;
+      });
+    });
+
+    return _emit(kernel, data_type, operand.nullable, {operand});
+  }
+
+  Operand _emit(const Instruction::Kernel kernel, const DataType data_type, const bool nullable,
+                const std::initializer_list<Operand> operands) {
+    DebugAssert(operands.size() <= std::tuple_size_v<decltype(Instruction::operand_registers)>, "Too many operands");
+
+    auto instruction = Instruction{};
+    instruction.kernel = kernel;
+    instruction.result_register = _add_register(data_type);
+    auto operand_idx = size_t{0};
+    for (const auto& operand : operands) {
+      instruction.operand_registers[operand_idx] = operand.register_id;
+      ++operand_idx;
+    }
+    _program._instructions.emplace_back(instruction);
+
+    return Operand{instruction.result_register, data_type, nullable};
+  }
+
+  // Emits an instruction that narrows the selection to the rows for which the kernel's predicate holds on `condition`.
+  // Results computed until the matching _pop_selection() are only valid within that selection.
+  size_t _push_selection(const Instruction::Kernel narrow_kernel, const Operand& condition) {
+    auto instruction = Instruction{};
+    instruction.kernel = narrow_kernel;
+    instruction.operand_registers[0] = condition.register_id;
+    _program._instructions.emplace_back(instruction);
+
+    _available_results.emplace_back();
+    _program._max_selection_depth = std::max(_program._max_selection_depth, _available_results.size() - 1);
+
+    return _program._instructions.size() - 1;
+  }
+
+  void _pop_selection(const size_t narrow_instruction_id) {
+    auto instruction = Instruction{};
+    instruction.kernel = &pop_selection_kernel;
+    _program._instructions.emplace_back(instruction);
+
+    // If the narrowed selection is empty, execution continues with popping it.
+    _program._instructions[narrow_instruction_id].jump_target = _program._instructions.size() - 1;
+    _available_results.pop_back();
+  }
+
+  bool _is_non_zero_literal(const Operand& operand) const {
+    const auto& literal = _program._registers[operand.register_id].literal;
+    if (!literal || variant_is_null(*literal)) {
+      return false;
+    }
+
+    auto is_non_zero = false;
+    resolve_numeric_data_type(operand.data_type, [&](const auto data_type_t) {
+      using LiteralDataType = typename decltype(data_type_t)::type;
+      is_non_zero = boost::get<LiteralDataType>(*literal) != LiteralDataType{0};
+    });
+    return is_non_zero;
+  }
+
+  size_t _add_register(const DataType data_type, const std::optional<ColumnID> column_id = std::nullopt,
+                       const std::optional<AllTypeVariant>& literal = std::nullopt) {
+    _program._registers.emplace_back(Register{data_type, column_id, literal});
+    return _program._registers.size() - 1;
+  }
+
+  ExpressionProgram& _program;
+  const Table& _table;
+
+  // Results of the sub-expressions compiled so far, per nested selection (see _push_selection()).
+  std::vector<ConstExpressionUnorderedMap<Operand>> _available_results;
+};
+
+std::shared_ptr<const ExpressionProgram> ExpressionProgram::compile(
+    const std::shared_ptr<const AbstractExpression>& expression, const Table& table) {
+  if (!is_numeric_data_type(expression->data_type())) {
+    return nullptr;
+  }
+
+  auto program = std::make_shared<ExpressionProgram>();
+  auto compiler = Compiler{*program, table};
+  const auto result = compiler.compile(expression);
+  if (!result) {
+    return nullptr;
+  }
+
+  program->_result_register = result->register_id;
+  program->_result_is_nullable = result->nullable;
+  return program;
+}
+
+DataType ExpressionProgram::result_data_type() const {
+  return _registers[_result_register].data_type;
+}
+
+bool ExpressionProgram::result_is_nullable() const {
+  return _result_is_nullable;
+}
+
+size_t ExpressionProgram::instruction_count() const {
+  return _instructions.size();
+}
+
+std::shared_ptr<BaseValueSegment> ExpressionProgram::evaluate_to_segment(const Chunk& chunk) const {
+  auto segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_numeric_data_type(result_data_type(), [&](const auto data_type_t) {
+    using ResultDataType = typename decltype(data_type_t)::type;
+
+    const auto row_count = static_cast<size_t>(chunk.size());
+    auto values = pmr_vector<ResultDataType>(row_count);
+    auto nulls = pmr_vector<bool>(_result_is_nullable ? row_count : 0);
+
+    _execute(chunk, [&](const auto& state, const auto batch_begin, const auto batch_size) {
+      const auto* batch_values = input_values<ResultDataType>(state, _result_register);
+      std::copy_n(batch_values, batch_size, values.begin() + static_cast<std::ptrdiff_t>(batch_begin));
+
+      const auto* batch_nulls = state.registers[_result_register].nulls;
+      if (_result_is_nullable && batch_nulls) {
+        for (auto offset = size_t{0}; offset < batch_size; ++offset) {
+          nulls[batch_begin + offset] = batch_nulls[offset] != 0;
+        }
+      }
+    });
+
+    if (_result_is_nullable) {
+      segment = std::make_shared<ValueSegment<ResultDataType>>(std::move(values), std::move(nulls));
+    } else {
+      segment = std::make_shared<ValueSegment<ResultDataType>>(std::move(values));
+    }
+  });
+
+  return segment;
+}
+
+RowIDPosList ExpressionProgram::evaluate_to_pos_list(const Chunk& chunk, const ChunkID chunk_id) const {
+  Assert(result_data_type() == DataType::Int, "Only programs returning a Bool can be evaluated to a PosList");
+
+  auto pos_list = RowIDPosList{};
+
+  _execute(chunk, [&](const auto& state, const auto batch_begin, const auto batch_size) {
+    const auto* values = input_values<int32_t>(state, _result_register);
+    const auto* nulls = input_nulls(state, _result_register);
+
+    for (auto offset = size_t{0}; offset < batch_size; ++offset) {
+      if (values[offset] != 0 && nulls[offset] == 0) {
+        pos_list.emplace_back(chunk_id, ChunkOffset{static_cast<ChunkOffset::base_type>(batch_begin + offset)});
+      }
+    }
+  });
+
+  return pos_list;
+}
+
+template <typename BatchFunctor>
+void ExpressionProgram::_execute(const Chunk& chunk, const BatchFunctor& batch_functor) const {
+  auto& state = thread_state();
+
+  // Programs do not call into other operators, so a worker cannot start executing another program while this one is
+  // running.
+  const auto state_usage_guard = StateUsageGuard{state};
+
+  // Allocate registers and selections. Buffers are kept for later programs (see StateUsageGuard).
+  const auto register_count = _registers.size();
+  if (state.registers.size() < register_count) {
+    state.registers.resize(register_count);
+    state.value_buffers.resize(register_count);
+    state.null_buffers.resize(register_count);
+    state.column_value_buffers.resize(register_count);
+    state.column_null_buffers.resize(register_count);
+    state.column_values.resize(register_count);
+    state.column_nulls.resize(register_count);
+    state.column_value_sizes.resize(register_count);
+  }
+
+  for (auto register_id = size_t{0}; register_id < register_count; ++register_id) {
+    if (state.value_buffers[register_id].empty()) {
+      state.value_buffers[register_id].resize(REGISTER_BUFFER_SIZE);
+      state.null_buffers[register_id].resize(BATCH_SIZE);
+    }
+  }
+
+  if (state.selections.size() < _max_selection_depth + 1) {
+    state.selections.resize(_max_selection_depth + 1);
+    state.selection_buffers.resize(_max_selection_depth + 1, std::vector<uint16_t>(BATCH_SIZE));
+  }
+
+  state.no_nulls.resize(BATCH_SIZE);
+
+  // Broadcast literals and materialize input columns.
+  const auto row_count = static_cast<size_t>(chunk.size());
+
+  for (auto register_id = size_t{0}; register_id < register_count; ++register_id) {
+    const auto& program_register = _registers[register_id];
+    auto& register_view = state.registers[register_id];
+    register_view = State::RegisterView{state.value_buffers[register_id].data(), nullptr};
+
+    resolve_numeric_data_type(program_register.data_type, [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      if (program_register.literal) {
+        auto* values = output_values<ColumnDataType>(state, register_id);
+        if (variant_is_null(*program_register.literal)) {
+          std::fill_n(values, BATCH_SIZE, ColumnDataType{});
+          std::fill_n(output_nulls(state, register_id), BATCH_SIZE, uint8_t{1});
+        } else {
+          std::fill_n(values, BATCH_SIZE, boost::get<ColumnDataType>(*program_register.literal));
+        }
+        return;
+      }
+
+      if (!program_register.column_id) {
+        return;
+      }
+
+      const auto& segment = *chunk.get_segment(*program_register.column_id);
+      auto& value_buffer = state.column_value_buffers[register_id];
+      auto& null_buffer = state.column_null_buffers[register_id];
+      auto contains_nulls = false;
+      state.column_value_sizes[register_id] = sizeof(ColumnDataType);
+
+      if (const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+        // Shortcut: Values are read directly from the segment.
+        state.column_values[register_id] = reinterpret_cast<const std::byte*>(value_segment->values().data());
+        if (value_segment->is_nullable()) {
+          const auto& null_values = value_segment->null_values();
+          null_buffer.resize(row_count);
+          for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+            null_buffer[chunk_offset] = null_values[chunk_offset];
+            contains_nulls |= null_values[chunk_offset];
+          }
+        }
+      } else {
+        value_buffer.resize(row_count * sizeof(ColumnDataType));
+        null_buffer.resize(row_count);
+        auto* values = reinterpret_cast<ColumnDataType*>(value_buffer.data());
+        auto chunk_offset = size_t{0};
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          const auto is_null = position.is_null();
+          values[chunk_offset] = is_null ? ColumnDataType{} : position.value();
+          null_buffer[chunk_offset] = is_null;
+          contains_nulls |= is_null;
+          ++chunk_offset;
+        });
+        state.column_values[register_id] = value_buffer.data();
+      }
+
+      state.column_nulls[register_id] = contains_nulls ? null_buffer.data() : nullptr;
+    });
+  }
+
+  // Execute the instructions batch by batch.
+  for (auto batch_begin = size_t{0}; batch_begin < row_count; batch_begin += BATCH_SIZE) {
+    const auto batch_size = std::min(BATCH_SIZE, row_count - batch_begin);
+
+    for (auto register_id = size_t{0}; register_id < register_count; ++register_id) {
+      const auto& program_register = _registers[register_id];
+      if (program_register.literal) {
+        continue;
+      }
+
+      auto& register_view = state.registers[register_id];
+      if (program_register.column_id) {
+        const auto* column_nulls = state.column_nulls[register_id];
+        register_view.values = state.column_values[register_id] + batch_begin * state.column_value_sizes[register_id];
+        register_view.nulls = column_nulls ? column_nulls + batch_begin : nullptr;
+      } else {
+        register_view.nulls = nullptr;
+      }
+    }
+
+    state.selection_depth = 0;
+    state.selections[0] = State::Selection{nullptr, batch_size, true};
+
+    const auto instruction_count = _instructions.size();
+    auto instruction_id = size_t{0};
+    while (instruction_id < instruction_count) {
+      const auto& instruction = _instructions[instruction_id];
+      instruction_id = instruction.kernel(instruction, state) ? instruction_id + 1 : instruction.jump_target;
+    }
+    DebugAssert(state.selection_depth == 0, "Selections were not popped");
+
+    batch_functor(state, batch_begin, batch_size);
+  }
+}
+
+}  // namespace hyrise
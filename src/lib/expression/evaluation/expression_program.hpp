@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractExpression;
+class BaseValueSegment;
+class Chunk;
+class Table;
+struct ExpressionProgramState;
+
+struct ExpressionProgramInstruction {
+  // Executes the instruction for the rows currently selected in `state`. Instructions that narrow the selection (see
+  // ExpressionProgram) return false if no row remains selected. Execution then continues at `jump_target`.
+  using Kernel = bool (*)(const ExpressionProgramInstruction& instruction, ExpressionProgramState& state);
+
+  Kernel kernel{};
+  size_t result_register{};
+  std::array<size_t, 3> operand_registers{};
+  size_t jump_target{};
+};
+
+/**
+ * An alternative to the ExpressionEvaluator for a subset of expressions. The ExpressionEvaluator evaluates an
+ * expression tree recursively and allocates an ExpressionResult for every node and chunk. An ExpressionProgram instead
+ * compiles the tree once into a flat list of typed instructions. These operate on registers of BATCH_SIZE rows that
+ * are allocated per thread and reused for all batches, chunks, and programs (up to a maximum size).
+ *
+ * Supported are numeric (int, long, float, double) columns and literals, NULL literals, arithmetics, comparisons,
+ * BETWEEN, AND, OR, IS [NOT] NULL, CASE, and unary minus. compile() returns nullptr for all other expressions, and
+ * callers fall back to the ExpressionEvaluator. The results (including their types) are the same as those of the
+ * ExpressionEvaluator. The nullability of the result is derived from the operands. Unlike the ExpressionEvaluator,
+ * which makes the results of CASE, AND, OR, division, and modulo nullable in any case, a program's result is only
+ * nullable if it can actually contain NULLs.
+ *
+ * Operands are cast to a common type by separate instructions, so that each kernel is only instantiated for a single
+ * data type. Equal sub-expressions are evaluated only once.
+ *
+ * AND, OR, and CASE are evaluated lazily: An instruction narrows the selection of rows that the following instructions
+ * process to the rows where the result is not yet known (e.g., the rows where the left side of an AND is not FALSE),
+ * and these are evaluated for the right side only. If no row remains, the instructions of the right side are skipped.
+ * Because of this, a register only holds valid values for the rows in the selection it was written in. Instructions
+ * that combine the results of different selections (AND, OR, and CASE) only read those rows.
+ */
+class ExpressionProgram final {
+ public:
+  static constexpr auto BATCH_SIZE = size_t{1024};
+
+  // Returns nullptr if the expression (or one of its arguments) is not supported.
+  static std::shared_ptr<const ExpressionProgram> compile(const std::shared_ptr<const AbstractExpression>& expression,
+                                                          const Table& table);
+
+  DataType result_data_type() const;
+  bool result_is_nullable() const;
+
+  size_t instruction_count() const;
+
+  // Same result as ExpressionEvaluator::evaluate_expression_to_segment()
+  std::shared_ptr<BaseValueSegment> evaluate_to_segment(const Chunk& chunk) const;
+
+  // Same result as ExpressionEvaluator::evaluate_expression_to_pos_list(). Only for programs returning a Bool.
+  RowIDPosList evaluate_to_pos_list(const Chunk& chunk, const ChunkID chunk_id) const;
+
+ private:
+  class Compiler;
+
+  struct Register {
+    DataType data_type{};
+
+    // Set for registers that hold (a batch of) an input column. These are not written by instructions.
+    std::optional<ColumnID> column_id;
+
+    // Set for registers that hold a literal (which may be NULL). These are not written by instructions.
+    std::optional<AllTypeVariant> literal;
+  };
+
+  // Calls `batch_functor(state, batch_begin, batch_size)` after the instructions were executed for each batch of
+  // `chunk`.
+  template <typename BatchFunctor>
+  void _execute(const Chunk& chunk, const BatchFunctor& batch_functor) const;
+
+  std::vector<ExpressionProgramInstruction> _instructions;
+  std::vector<Register> _registers;
+  size_t _result_register{};
+  bool _result_is_nullable{};
+
+  // Number of nested selections, e.g., one for `a AND b`
+  size_t _max_selection_depth{};
+};
+
+}  // namespace hyrise
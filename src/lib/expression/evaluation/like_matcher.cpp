@@ -1,16 +1,53 @@
 #include "like_matcher.hpp"
 
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
 #include <optional>
+#include <string_view>
 #include <utility>
 
-#include <boost/algorithm/string/replace.hpp>
-
 #include "utils/assert.hpp"
 
+namespace {
+
+// Portable vector type (GCC/clang vector extension). Depending on the target, operations on it are compiled to SSE,
+// AVX2, or NEON instructions, or split into several of them.
+constexpr auto SEARCH_BLOCK_SIZE = size_t{32};
+using SearchBlock = char __attribute__((vector_size(SEARCH_BLOCK_SIZE)));
+
+// SearchBlocks are passed by reference, as passing them by value depends on the instruction set (-Wpsabi).
+void broadcast(SearchBlock& block, const char character) {
+  for (auto index = size_t{0}; index < SEARCH_BLOCK_SIZE; ++index) {
+    block[index] = character;
+  }
+}
+
+void load_block(SearchBlock& block, const char* data) {
+  std::memcpy(&block, data, SEARCH_BLOCK_SIZE);
+}
+
+// Whether `part` (which might contain '_') matches `string` starting at `position`. The caller guarantees that `string`
+// is long enough.
+bool part_matches_at(const std::string_view string, const size_t position, const std::string_view part) {
+  const auto part_size = part.size();
+  for (auto index = size_t{0}; index < part_size; ++index) {
+    if (part[index] != '_' && part[index] != string[position + index]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 namespace hyrise {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) {
-  _pattern_variant = pattern_string_to_pattern_variant(pattern);
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
+
+const LikeMatcher::AllPatternVariant& LikeMatcher::pattern_variant() const {
+  return _pattern_variant;
 }
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
@@ -69,6 +106,113 @@ std::optional<std::pair<pmr_string, pmr_string>> LikeMatcher::bounds(const pmr_s
   return std::pair<pmr_string, pmr_string>(lower_bound, upper_bound);
 }
 
+size_t LikeMatcher::find(const std::string_view string, const std::string_view substring, const size_t offset) {
+  const auto string_size = string.size();
+  const auto substring_size = substring.size();
+  if (offset > string_size || substring_size > string_size - offset) {
+    return std::string_view::npos;
+  }
+
+  if (substring_size <= 1) {
+    // std::string_view::find for a single character uses memchr, which is already vectorized.
+    return substring_size == 0 ? offset : string.find(substring.front(), offset);
+  }
+
+  // Positions at which `substring` might start. At each position, we compare the first and the last character of
+  // `substring`. Only if both match, the characters in between are compared. For a block of SEARCH_BLOCK_SIZE
+  // positions, the candidates are determined by two vector comparisons (see http://0x80.pl/articles/simd-strfind.html).
+  const auto position_end = string_size - substring_size + 1;
+  const auto last_character_offset = substring_size - 1;
+  const auto* const data = string.data();
+
+  auto first_characters = SearchBlock{};
+  auto last_characters = SearchBlock{};
+  broadcast(first_characters, substring.front());
+  broadcast(last_characters, substring.back());
+
+  auto first_block = SearchBlock{};
+  auto last_block = SearchBlock{};
+  auto position = offset;
+  for (; position + SEARCH_BLOCK_SIZE <= position_end; position += SEARCH_BLOCK_SIZE) {
+    load_block(first_block, data + position);
+    load_block(last_block, data + position + last_character_offset);
+    const auto candidates = (first_block == first_characters) & (last_block == last_characters);
+
+    // Each byte of `candidates` is either 0x00 or 0xFF. We look at them in 64-bit words to find the set bytes. As we
+    // only support little-endian architectures, the lowest set bit belongs to the first candidate.
+    auto words = std::array<uint64_t, SEARCH_BLOCK_SIZE / sizeof(uint64_t)>{};
+    std::memcpy(words.data(), &candidates, SEARCH_BLOCK_SIZE);
+    for (auto word_idx = size_t{0}; word_idx < words.size(); ++word_idx) {
+      auto word = words[word_idx];
+      while (word != 0) {
+        const auto byte_idx = static_cast<size_t>(std::countr_zero(word)) / 8;
+        const auto candidate = position + word_idx * sizeof(uint64_t) + byte_idx;
+        if (std::memcmp(data + candidate + 1, substring.data() + 1, substring_size - 2) == 0) {
+          return candidate;
+        }
+        word &= ~(uint64_t{0xFF} << (byte_idx * 8));
+      }
+    }
+  }
+
+  for (; position < position_end; ++position) {
+    if (data[position] == substring.front() && data[position + last_character_offset] == substring.back() &&
+        std::memcmp(data + position + 1, substring.data() + 1, substring_size - 2) == 0) {
+      return position;
+    }
+  }
+
+  return std::string_view::npos;
+}
+
+bool LikeMatcher::GlobPattern::matches(const std::string_view string) const {
+  const auto string_size = string.size();
+  if (string_size < min_size) {
+    return false;
+  }
+
+  const auto part_count = parts.size();
+  const auto& first_part = parts.front().string;
+  if (part_count == 1) {
+    // No '%' in the pattern.
+    return string_size == first_part.size() && part_matches_at(string, 0, first_part);
+  }
+
+  const auto& last_part = parts.back().string;
+  const auto last_part_position = string_size - last_part.size();
+  if (!part_matches_at(string, 0, first_part) || !part_matches_at(string, last_part_position, last_part)) {
+    return false;
+  }
+
+  // The parts in between have to occur in order between the first and the last part, without overlapping.
+  auto position = first_part.size();
+  for (auto part_idx = size_t{1}; part_idx < part_count - 1; ++part_idx) {
+    const auto& part = parts[part_idx];
+    const auto part_size = part.string.size();
+
+    if (!part.contains_single_char_wildcard) {
+      position = find(string.substr(0, last_part_position), part.string, position);
+      if (position == std::string_view::npos) {
+        return false;
+      }
+    } else {
+      while (true) {
+        if (position + part_size > last_part_position) {
+          return false;
+        }
+        if (part_matches_at(string, position, part.string)) {
+          break;
+        }
+        ++position;
+      }
+    }
+
+    position += part_size;
+  }
+
+  return true;
+}
+
 LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(const pmr_string& pattern) {
   const auto tokens = pattern_string_to_tokens(pattern);
 
@@ -92,12 +236,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
 
   /**
    * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or we fall back to
-   * using a regex matcher.
+   * using a GlobPattern.
    *
    * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
    */
 
-  // Pick ContainsMultiple or Regex
+  // Pick ContainsMultiple or Glob
   auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
   auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
   auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
@@ -120,36 +264,27 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
     expect_any_chars = !expect_any_chars;
   }
 
-  if (pattern_is_contains_multiple) {
+  // The pattern has to end with '%' (i.e., we expect a string next), otherwise the last string has to be at the end.
+  if (pattern_is_contains_multiple && !expect_any_chars) {
     return MultipleContainsPattern{strings};
   }
 
-  return std::regex(sql_like_to_regex(pattern));
-}
+  auto glob_pattern = GlobPattern{};
+  auto part_begin = size_t{0};
+  while (true) {
+    const auto part_end = pattern.find('%', part_begin);
+    auto part = pattern.substr(part_begin, part_end == pmr_string::npos ? pmr_string::npos : part_end - part_begin);
+    const auto contains_single_char_wildcard = part.find('_') != pmr_string::npos;
+    glob_pattern.min_size += part.size();
+    glob_pattern.parts.emplace_back(GlobPattern::Part{std::move(part), contains_single_char_wildcard});
+
+    if (part_end == pmr_string::npos) {
+      break;
+    }
+    part_begin = part_end + 1;
+  }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
-  }
-
-  return std::string{"^" + sql_like + "$"};
+  return glob_pattern;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
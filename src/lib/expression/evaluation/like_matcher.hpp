@@ -1,9 +1,8 @@
 #pragma once
 
-#include <experimental/functional>
 #include <optional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -17,22 +16,10 @@ namespace hyrise {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are matched by a glob-style matcher that does not need to backtrack (see GlobPattern).
  */
 class LikeMatcher {
-  // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
-#ifdef __GLIBCXX__
-  using Searcher = std::boyer_moore_searcher<pmr_string::const_iterator>;
-#else
-  using Searcher = std::experimental::boyer_moore_searcher<pmr_string::const_iterator>;
-#endif
-
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -57,9 +44,17 @@ class LikeMatcher {
   // {test, tesu} | nullopt | nullopt   | {test, test\0}  | {'', '\0'}
   static std::optional<std::pair<pmr_string, pmr_string>> bounds(const pmr_string& pattern);
 
+  /**
+   * Returns the position of the first occurrence of `substring` in `string` that starts at or after `offset`, or
+   * std::string_view::npos. Used instead of std::search, as it first filters candidate positions by comparing the first
+   * and the last character of `substring` for a block of positions at once, which the compiler turns into SIMD
+   * instructions. Wildcards are not interpreted.
+   */
+  static size_t find(const std::string_view string, const std::string_view substring, const size_t offset = 0);
+
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern will fall back to GlobPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -81,15 +76,35 @@ class LikeMatcher {
     std::vector<pmr_string> strings;
   };
 
+  // Any other pattern, e.g., 'H_llo%' or 'a%b_%c'. The pattern is split at each '%' into parts, in which '_' matches
+  // any single character (e.g., 'H_llo%W%ld' becomes {"H_llo", "W", "ld"}). The first part has to match at the
+  // beginning of a string and the last part at its end. As all parts have a fixed length, it suffices to search for
+  // the first occurrence of each part in between after the end of the previous part. Thus, no backtracking is needed.
+  struct GlobPattern final {
+    struct Part final {
+      pmr_string string;
+      bool contains_single_char_wildcard{false};
+    };
+
+    std::vector<Part> parts;
+
+    // Sum of the sizes of all parts, i.e., the minimum size of a matching string
+    size_t min_size{0};
+
+    bool matches(const std::string_view string) const;
+  };
+
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to GlobPattern for a
    * general pattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GlobPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
+  const AllPatternVariant& pattern_variant() const;
+
   /**
    * The functor will be called with a concrete matcher.
    * Usage example:
@@ -119,39 +134,27 @@ class LikeMatcher {
 
     } else if (std::holds_alternative<ContainsPattern>(_pattern_variant)) {
       const auto& contains_str = std::get<ContainsPattern>(_pattern_variant).string;
-      // It's really hard to store the searcher in the pattern as it only holds iterators into the string that easily
-      // get invalidated when the pattern is passed around.
-      const auto searcher = Searcher{contains_str.begin(), contains_str.end()};
       functor([&](const auto& string) -> bool {
-        return (std::search(string.begin(), string.end(), searcher) != string.end()) ^ invert_results;
+        return (find(string, contains_str) != std::string_view::npos) ^ invert_results;
       });
 
     } else if (std::holds_alternative<MultipleContainsPattern>(_pattern_variant)) {
       const auto& contains_strs = std::get<MultipleContainsPattern>(_pattern_variant).strings;
-      std::vector<Searcher> searchers;
-      searchers.reserve(contains_strs.size());
-      for (const auto& contains_str : contains_strs) {
-        searchers.emplace_back(Searcher(contains_str.begin(), contains_str.end()));
-      }
-
       functor([&](const auto& string) -> bool {
-        auto current_position = string.begin();
-        for (auto searcher_idx = size_t{0}; searcher_idx < searchers.size(); ++searcher_idx) {
-          current_position = std::search(current_position, string.end(), searchers[searcher_idx]);
-          if (current_position == string.end()) {
+        auto current_position = size_t{0};
+        for (const auto& contains_str : contains_strs) {
+          current_position = find(string, contains_str, current_position);
+          if (current_position == std::string_view::npos) {
             return invert_results;
           }
-          current_position += contains_strs[searcher_idx].size();
+          current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
-
-      functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
-      });
+    } else if (std::holds_alternative<GlobPattern>(_pattern_variant)) {
+      const auto& glob_pattern = std::get<GlobPattern>(_pattern_variant);
+      functor([&](const auto& string) -> bool { return glob_pattern.matches(string) ^ invert_results; });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
@@ -1,5 +1,10 @@
 #include "hyrise.hpp"
 
+#include "operators/join_hash.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "utils/settings/unsigned_integer_setting.hpp"
+
 namespace hyrise {
 
 Hyrise::Hyrise() {
@@ -18,11 +23,30 @@ Hyrise::Hyrise() {
   transaction_manager = TransactionManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
+  _register_builtin_settings();
   log_manager = LogManager{};
   topology = Topology{};
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
+void Hyrise::_register_builtin_settings() {
+  // Optimizer rules and operators are instantiated per query, so their settings are owned by the Hyrise instance. We
+  // cannot use AbstractSetting::register_at_settings_manager() here, as Hyrise::get() still refers to the previous
+  // instance during reset().
+  settings_manager._add(std::make_shared<UnsignedIntegerSetting>(
+      JoinOrderingRule::DP_VERTEX_THRESHOLD_SETTING,
+      "Join graphs with fewer vertices are ordered exhaustively with DpCcp, larger ones with DpHyp or greedily.",
+      JoinOrderingRule::DEFAULT_DP_VERTEX_THRESHOLD));
+  settings_manager._add(std::make_shared<UnsignedIntegerSetting>(
+      JoinOrderingRule::MAX_CSG_CMP_PAIRS_SETTING,
+      "Number of join candidates evaluated by DpHyp before it falls back to iterative dynamic programming.",
+      DpHyp::DEFAULT_MAX_CSG_CMP_PAIR_COUNT));
+  settings_manager._add(std::make_shared<UnsignedIntegerSetting>(
+      JoinHash::MEMORY_BUDGET_SETTING,
+      "Memory budget in bytes per hash join. Joins exceeding it spill their partitions to disk (0 = unlimited).",
+      JoinHash::DEFAULT_MEMORY_BUDGET));
+}
+
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
   get() = Hyrise{};
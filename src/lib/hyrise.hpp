@@ -61,6 +61,8 @@ class Hyrise : public Singleton<Hyrise> {
   Hyrise();
   friend class Singleton;
 
+  void _register_builtin_settings();
+
   // (Re-)setting the scheduler requires more than just replacing the pointer. To make sure that set_scheduler is used,
   // the scheduler is private.
   std::shared_ptr<AbstractScheduler> _scheduler;
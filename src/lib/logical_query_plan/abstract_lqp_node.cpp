@@ -1,6 +1,7 @@
 #include "abstract_lqp_node.hpp"
 
 #include <algorithm>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -180,6 +181,7 @@ LQPInputSide AbstractLQPNode::get_input_side(const std::shared_ptr<AbstractLQPNo
 }
 
 std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   std::vector<LQPInputSide> input_sides;
   input_sides.reserve(_outputs.size());
 
@@ -193,6 +195,7 @@ std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
 }
 
 std::vector<std::shared_ptr<AbstractLQPNode>> AbstractLQPNode::outputs() const {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   std::vector<std::shared_ptr<AbstractLQPNode>> outputs;
   outputs.reserve(_outputs.size());
 
@@ -214,10 +217,8 @@ void AbstractLQPNode::remove_output(const std::shared_ptr<AbstractLQPNode>& outp
 }
 
 void AbstractLQPNode::clear_outputs() {
-  // Don't use for-each loop here, as remove_output manipulates the _outputs vector
-  while (!_outputs.empty()) {
-    auto output = _outputs.front().lock();
-    DebugAssert(output, "Failed to lock output");
+  // Don't iterate over _outputs here, as remove_output manipulates the _outputs vector
+  for (const auto& output : outputs()) {
     remove_output(output);
   }
 }
@@ -237,6 +238,7 @@ std::vector<LQPOutputRelation> AbstractLQPNode::output_relations() const {
 }
 
 size_t AbstractLQPNode::output_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   return _outputs.size();
 }
 
@@ -388,6 +390,7 @@ std::shared_ptr<AbstractLQPNode> AbstractLQPNode::_shallow_copy(LQPNodeMapping&
 }
 
 void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   const auto iter = std::find_if(_outputs.begin(), _outputs.end(), [&](const auto& other) {
     /**
      * HACK!
@@ -415,6 +418,7 @@ void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
 
 void AbstractLQPNode::_add_output_pointer(const std::shared_ptr<AbstractLQPNode>& output) {
   // Having the same output multiple times is allowed, e.g. for self joins
+  const auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   _outputs.emplace_back(output);
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -279,7 +280,10 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
   void _remove_output_pointer(const AbstractLQPNode& output);
   /** @} */
 
+  // Plans sharing the same inputs may be built concurrently (e.g., by the parallel search in DpHyp), and building a
+  // node registers it as an output of its inputs. Thus, the outputs are guarded by a mutex.
   std::vector<std::weak_ptr<AbstractLQPNode>> _outputs;
+  mutable std::mutex _outputs_mutex;
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
 };
 
@@ -46,6 +46,10 @@ std::string JoinNode::description(const DescriptionMode mode) const {
     stream << " [" << predicate->description(expression_mode) << "]";
   }
 
+  if (use_runtime_filter) {
+    stream << " (Runtime Filter)";
+  }
+
   return stream.str();
 }
 
@@ -301,6 +305,10 @@ std::shared_ptr<JoinNode> JoinNode::get_or_find_reduced_join_node() const {
 size_t JoinNode::_on_shallow_hash() const {
   size_t hash = boost::hash_value(join_mode);
   boost::hash_combine(hash, _is_semi_reduction);
+  if (index_side) {
+    boost::hash_combine(hash, *index_side);
+  }
+  boost::hash_combine(hash, use_runtime_filter);
   return hash;
 }
 
@@ -312,12 +320,15 @@ std::shared_ptr<AbstractLQPNode> JoinNode::_on_shallow_copy(LQPNodeMapping& node
   const auto copied_join_node =
       JoinNode::make(join_mode, expressions_copy_and_adapt_to_different_lqp(join_predicates(), node_mapping));
   copied_join_node->_is_semi_reduction = _is_semi_reduction;
+  copied_join_node->index_side = index_side;
+  copied_join_node->use_runtime_filter = use_runtime_filter;
   return copied_join_node;
 }
 
 bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& join_node = static_cast<const JoinNode&>(rhs);
-  if (join_mode != join_node.join_mode || _is_semi_reduction != join_node._is_semi_reduction) {
+  if (join_mode != join_node.join_mode || _is_semi_reduction != join_node._is_semi_reduction ||
+      index_side != join_node.index_side || use_runtime_filter != join_node.use_runtime_filter) {
     return false;
   }
   return expressions_equal_to_expressions_in_different_lqp(join_predicates(), join_node.join_predicates(),
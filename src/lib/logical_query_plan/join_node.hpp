@@ -89,6 +89,15 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
 
   JoinMode join_mode;
 
+  // Set by the IndexJoinRule if the input on this side is a StoredTableNode with a table-level index on the join
+  // column. The LQPTranslator then creates a JoinIndex that looks up the values of the other input in this index.
+  std::optional<LQPInputSide> index_side;
+
+  // Set by the SemiJoinReductionRule for semi join reductions that only pay off if they are cheap. Instead of a semi
+  // join, the LQPTranslator creates a TableScan that filters the left input using a RuntimeFilter built from the right
+  // input (see TableScan).
+  bool use_runtime_filter{false};
+
  protected:
   /**
    * The following data members are only relevant for semi joins added by the SemiJoinReductionRule. For details,
@@ -1,5 +1,6 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -21,7 +22,10 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -43,8 +47,11 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/key_index_lookup.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -62,6 +69,7 @@
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "optimizer/strategy/index_scan_rule.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "sort_node.hpp"
@@ -167,14 +175,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_node = node->left_input();
-  const auto input_operator = translate_node(input_node);
   const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
-      return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
+      return _translate_predicate_node_to_table_scan(predicate_node, translate_node(input_node));
     case ScanType::IndexScan:
-      return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+      return _translate_predicate_node_to_index_scan(predicate_node, translate_node(input_node));
+    case ScanType::KeyIndexLookup:
+      // KeyIndexLookups replace the GetTable of their input StoredTableNode.
+      return _translate_predicate_node_to_key_index_lookup(predicate_node);
   }
 
   Fail("Invalid enum value");
@@ -225,6 +235,19 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   DebugAssert(std::is_sorted(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend()),
               "Expected sorted vector of ColumnIDs");
 
+  // Use the first ordered index on the column, which is also the one the IndexScanRule based its decision on.
+  const auto indexes_statistics = stored_table_node->chunk_indexes_statistics();
+  const auto index_statistics_iter =
+      std::find_if(indexes_statistics.cbegin(), indexes_statistics.cend(), [&](const auto& index_statistics) {
+        return index_statistics.column_ids == column_ids && IndexScanRule::is_ordered_index_type(index_statistics.type);
+      });
+  Assert(index_statistics_iter != indexes_statistics.cend(), "Expected an ordered index on the scanned column.");
+  const auto index_type = index_statistics_iter->type;
+
+  // The chunks of the stored table are indexed by the original, i.e., non-pruned, ColumnID.
+  const auto& column_expression = static_cast<const LQPColumnExpression&>(*predicate->arguments[0]);
+  const auto original_column_ids = std::vector<ColumnID>{column_expression.original_column_id};
+
   const auto table_name = stored_table_node->table_name;
   const auto table = Hyrise::get().storage_manager.get_table(table_name);
   std::vector<ChunkID> indexed_chunks;
@@ -232,7 +255,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto pruned_table_chunk_id = ChunkID{0};
   auto pruned_chunk_ids_iter = pruned_chunk_ids.cbegin();
 
-  // Create a vector of chunk ids that have a GroupKey index and are not pruned.
+  // Create a vector of chunk ids that have an index of the chosen type and are not pruned.
   const auto chunk_count = table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     // Check if chunk is pruned
@@ -240,9 +263,9 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
       ++pruned_chunk_ids_iter;
       continue;
     }
-    // Check if chunk has GroupKey index
+    // Check if chunk has the index
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk && chunk->get_index(ChunkIndexType::GroupKey, column_ids)) {
+    if (chunk && chunk->get_index(index_type, original_column_ids)) {
       indexed_chunks.emplace_back(pruned_table_chunk_id);
     }
     ++pruned_table_chunk_id;
@@ -250,8 +273,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, ChunkIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -265,6 +288,32 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_key_index_lookup(
+    const std::shared_ptr<PredicateNode>& node) const {
+  Assert(node->left_input()->type == LQPNodeType::StoredTable, "KeyIndexLookup must follow a StoredTableNode.");
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+
+  // The IndexScanRule creates a conjunction of `column = value` predicates, one per key column.
+  auto key_column_ids = std::vector<ColumnID>{};
+  auto key_values = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& predicate : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+    Assert(binary_predicate && binary_predicate->predicate_condition == PredicateCondition::Equals,
+           "Expected equality predicates for KeyIndexLookup.");
+
+    const auto column_is_left = binary_predicate->left_operand()->type == ExpressionType::LQPColumn;
+    const auto& column = column_is_left ? binary_predicate->left_operand() : binary_predicate->right_operand();
+    const auto& value = column_is_left ? binary_predicate->right_operand() : binary_predicate->left_operand();
+    Assert(column->type == ExpressionType::LQPColumn, "Expected column as operand of KeyIndexLookup predicate.");
+
+    key_column_ids.emplace_back(static_cast<const LQPColumnExpression&>(*column).original_column_id);
+    key_values.emplace_back(value);
+  }
+
+  return std::make_shared<KeyIndexLookup>(stored_table_node->table_name, stored_table_node->pruned_column_ids(),
+                                          key_column_ids, _translate_expressions(key_values, stored_table_node));
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input(),
@@ -329,11 +378,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+
+  // Semi join reductions that the SemiJoinReductionRule marked to use a runtime filter are not executed as joins.
+  if (join_node->use_runtime_filter) {
+    return _translate_join_node_to_runtime_filter_scan(join_node);
+  }
+
   const auto left_input_operator = translate_node(node->left_input());
   const auto right_input_operator = translate_node(node->right_input());
 
-  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
-
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
     return std::make_shared<Product>(left_input_operator, right_input_operator);
@@ -356,11 +410,38 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
+  // The IndexJoinRule chose to look up the values of one input in a table-level index of the other input.
+  if (join_node->index_side) {
+    Assert(secondary_join_predicates.empty(), "Index joins with multiple predicates are not supported.");
+    const auto index_side = *join_node->index_side == LQPInputSide::Left ? IndexSide::Left : IndexSide::Right;
+    return std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                       primary_join_predicate, secondary_join_predicates, index_side);
+  }
+
   auto join_operator = std::shared_ptr<AbstractOperator>{};
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
+  // Joins with two inequality predicates (e.g., band joins or interval joins) are executed using the IEJoin, which
+  // avoids the near-quadratic work of the JoinSortMerge and the JoinNestedLoop for such joins. The second inequality
+  // predicate is passed as first secondary predicate.
+  if (JoinIE::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
+                        right_data_type, !secondary_join_predicates.empty()})) {
+    const auto secondary_predicate_count = secondary_join_predicates.size();
+    for (auto predicate_idx = size_t{0}; predicate_idx < secondary_predicate_count; ++predicate_idx) {
+      const auto& predicate_expression = *join_node->join_predicates()[predicate_idx + 1];
+      if (!is_inequality_predicate_condition(secondary_join_predicates[predicate_idx].predicate_condition) ||
+          predicate_expression.arguments[0]->data_type() != predicate_expression.arguments[1]->data_type()) {
+        continue;
+      }
+
+      std::swap(secondary_join_predicates.front(), secondary_join_predicates[predicate_idx]);
+      return std::make_shared<JoinIE>(left_input_operator, right_input_operator, join_node->join_mode,
+                                      primary_join_predicate, secondary_join_predicates);
+    }
+  }
+
   // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
   // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
   constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
@@ -387,6 +468,47 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+std::shared_ptr<TableScan> LQPTranslator::_translate_join_node_to_runtime_filter_scan(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  Assert(join_node->is_semi_reduction() && join_node->join_predicates().size() == 1,
+         "Runtime filters are only used for semi join reductions with a single predicate.");
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+
+  const auto join_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicates().front(), *left_input, *right_input);
+  Assert(join_predicate && join_predicate->predicate_condition == PredicateCondition::Equals,
+         "Runtime filters require an equi-join predicate.");
+
+  // The right input (i.e., the reducer) becomes the right input of the TableScan. As such, the scheduler executes the
+  // TableScan only after the reducer, so that the scan never waits for the filter.
+  const auto right_input_operator = translate_node(right_input);
+
+  // If the left input is a predicate that is executed as a TableScan, that TableScan applies the filter. Doing so, we
+  // can prune chunks of a stored table before they are scanned. We only do this if the semi join reduction is the only
+  // consumer of the predicate. Otherwise, the translated operator is shared with other parts of the PQP, where the
+  // filter must not be applied, regardless of whether these parts have already been translated.
+  if (left_input->type == LQPNodeType::Predicate && left_input->output_count() == 1) {
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(left_input);
+    if (predicate_node->scan_type == ScanType::TableScan) {
+      const auto& predicate_input = predicate_node->left_input();
+      return std::make_shared<TableScan>(
+          translate_node(predicate_input),
+          _translate_expression(predicate_node->predicate(), predicate_input, predicate_input->output_expressions()),
+          right_input_operator, join_predicate->column_ids);
+    }
+  }
+
+  // Otherwise, we add a TableScan that applies the filter. Its predicate removes NULL values, which never find a join
+  // partner in the semi join that we replace.
+  const auto& left_output_expressions = left_input->output_expressions();
+  const auto not_null_predicate =
+      expression_functional::is_not_null_(left_output_expressions[join_predicate->column_ids.first]);
+  return std::make_shared<TableScan>(translate_node(left_input),
+                                     _translate_expression(not_null_predicate, left_input, left_output_expressions),
+                                     right_input_operator, join_predicate->column_ids);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
@@ -611,7 +733,7 @@ std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
        *     with _operator_by_lqp_node.
        *
        *  b) In contrast to uncorrelated subqueries, correlated subqueries cannot share identical parts with outer
-       *     queries because ExpressionEvaluator::_evaluate_subquery_expression_for_row always deep-copies the whole PQP
+       *     queries because ExpressionEvaluator::_evaluate_correlated_subquery_expression deep-copies the whole PQP
        *     at evaluation time. The deep copy includes both correlated and uncorrelated parts.
        *     Consequently, a new LQPTranslator instance is used for correlated subqueries to avoid deduplication
        *     with outer queries. This prevents correlated subqueries from increasing the consumer count of
@@ -13,7 +13,9 @@ namespace hyrise {
 
 class AbstractExpression;
 
-enum class ScanType { TableScan, IndexScan };
+// KeyIndexLookup predicates are conjunctions of equality predicates on all columns of a KeyHashIndex. They directly
+// follow a StoredTableNode (see IndexScanRule).
+enum class ScanType { TableScan, IndexScan, KeyIndexLookup };
 
 /**
  * This node type represents a filter.
@@ -0,0 +1,102 @@
+#include "arena_memory_resource.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<uint64_t> next_arena_id{1};
+
+// Caches the region of the arena that the thread used last, so that subsequent allocations do not need to lock the
+// arena's mutex.
+struct CachedThreadLocalRegion {
+  uint64_t arena_id{0};
+  void* region{nullptr};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local auto cached_thread_local_region = CachedThreadLocalRegion{};
+
+}  // namespace
+
+ArenaMemoryResource::ArenaMemoryResource(boost::container::pmr::memory_resource* upstream_resource)
+    : _upstream_resource(upstream_resource), _arena_id(next_arena_id++) {
+  Assert(_upstream_resource, "ArenaMemoryResource requires an upstream resource.");
+}
+
+ArenaMemoryResource::~ArenaMemoryResource() {
+  for (const auto& region : _regions) {
+    _upstream_resource->deallocate(region.begin, region.size, alignof(std::max_align_t));
+  }
+}
+
+size_t ArenaMemoryResource::region_bytes() const {
+  return _region_bytes.load();
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes >= LARGE_ALLOCATION_THRESHOLD) {
+    return _upstream_resource->allocate(bytes, alignment);
+  }
+
+  auto& thread_local_region = _thread_local_region();
+  auto available_bytes = static_cast<size_t>(thread_local_region.end - thread_local_region.current);
+  auto* pointer = static_cast<void*>(thread_local_region.current);
+  if (!pointer || !std::align(alignment, bytes, pointer, available_bytes)) {
+    _add_region(thread_local_region, bytes + alignment);
+    available_bytes = static_cast<size_t>(thread_local_region.end - thread_local_region.current);
+    pointer = thread_local_region.current;
+    [[maybe_unused]] const auto* const aligned_pointer = std::align(alignment, bytes, pointer, available_bytes);
+    DebugAssert(aligned_pointer, "New region is too small for the allocation.");
+  }
+
+  thread_local_region.current = static_cast<std::byte*>(pointer) + bytes;
+  return pointer;
+}
+
+void ArenaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  // Memory in regions is released when the arena is destroyed.
+  if (bytes >= LARGE_ALLOCATION_THRESHOLD) {
+    _upstream_resource->deallocate(pointer, bytes, alignment);
+  }
+}
+
+bool ArenaMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+ArenaMemoryResource::ThreadLocalRegion& ArenaMemoryResource::_thread_local_region() {
+  if (cached_thread_local_region.arena_id == _arena_id) {
+    return *static_cast<ThreadLocalRegion*>(cached_thread_local_region.region);
+  }
+
+  // References to elements of an std::unordered_map stay valid when the map is rehashed.
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  auto& thread_local_region = _thread_local_regions[std::this_thread::get_id()];
+  cached_thread_local_region = CachedThreadLocalRegion{_arena_id, &thread_local_region};
+  return thread_local_region;
+}
+
+void ArenaMemoryResource::_add_region(ThreadLocalRegion& thread_local_region, const size_t min_size) {
+  const auto region_size = std::max(thread_local_region.next_region_size, min_size);
+  auto* const region_begin =
+      static_cast<std::byte*>(_upstream_resource->allocate(region_size, alignof(std::max_align_t)));
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _regions.emplace_back(Region{region_begin, region_size});
+  }
+  _region_bytes += region_size;
+
+  // The remainder of the previous region is abandoned. Regions grow geometrically to limit their number.
+  thread_local_region.current = region_begin;
+  thread_local_region.end = region_begin + region_size;
+  thread_local_region.next_region_size = std::min(region_size * 2, MAX_REGION_SIZE);
+}
+
+}  // namespace hyrise
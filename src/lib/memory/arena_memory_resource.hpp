@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * A memory resource for short-lived allocations of a single query (e.g., the hash tables of a JoinHash). Each thread
+ * bumps a pointer through its own regions, so allocations neither call into malloc nor synchronize with other threads.
+ * Deallocations are no-ops. All regions are returned to the upstream resource at once when the arena is destroyed.
+ *
+ * Allocations of at least LARGE_ALLOCATION_THRESHOLD bytes are forwarded to the upstream resource and are freed on
+ * deallocation. Thus, operators that allocate and free large buffers during the query do not accumulate them.
+ *
+ * The arena must outlive all data allocated from it. The SQLPipelineStatement creates one arena per statement and
+ * releases it once the statement's operators have been executed (see AbstractOperator::memory_resource()).
+ */
+class ArenaMemoryResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static constexpr auto INITIAL_REGION_SIZE = size_t{64 * 1024};
+  static constexpr auto MAX_REGION_SIZE = size_t{4 * 1024 * 1024};
+  static constexpr auto LARGE_ALLOCATION_THRESHOLD = size_t{256 * 1024};
+
+  explicit ArenaMemoryResource(
+      boost::container::pmr::memory_resource* upstream_resource = boost::container::pmr::get_default_resource());
+  ~ArenaMemoryResource() override;
+
+  // Number of bytes requested from the upstream resource for regions (i.e., excluding large allocations).
+  size_t region_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  struct Region {
+    std::byte* begin;
+    size_t size;
+  };
+
+  // The unused part of the current region of a thread and the size of the next region to request.
+  struct ThreadLocalRegion {
+    std::byte* current{nullptr};
+    std::byte* end{nullptr};
+    size_t next_region_size{INITIAL_REGION_SIZE};
+  };
+
+  ThreadLocalRegion& _thread_local_region();
+  void _add_region(ThreadLocalRegion& thread_local_region, const size_t min_size);
+
+  boost::container::pmr::memory_resource* const _upstream_resource;
+
+  // Identifies the arena in the per-thread cache of _thread_local_region(). In contrast to the arena's address, it is
+  // not reused by arenas created later.
+  const uint64_t _arena_id;
+
+  std::mutex _mutex;
+  std::vector<Region> _regions;
+  std::unordered_map<std::thread::id, ThreadLocalRegion> _thread_local_regions;
+  std::atomic<size_t> _region_bytes{0};
+};
+
+}  // namespace hyrise
@@ -0,0 +1,82 @@
+#include "numa_memory_resource.hpp"
+
+#if HYRISE_NUMA_SUPPORT
+
+#include <numa.h>
+
+#endif
+
+#include <mutex>
+#include <unordered_map>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/synchronized_pool_resource.hpp>
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+namespace {
+
+bool node_is_available_in_libnuma(const NodeID node_id) {
+#if HYRISE_NUMA_SUPPORT
+  return numa_available() >= 0 && static_cast<int>(node_id) <= numa_max_node();
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+NumaMemoryResource::NumaMemoryResource(const NodeID node_id)
+    : _node_id(node_id), _use_libnuma(node_is_available_in_libnuma(node_id)) {
+  Assert(node_id != INVALID_NODE_ID && node_id != CURRENT_NODE_ID, "Expected a valid NUMA node.");
+}
+
+NodeID NumaMemoryResource::node_id() const {
+  return _node_id;
+}
+
+boost::container::pmr::memory_resource* NumaMemoryResource::get(const NodeID node_id) {
+  static auto mutex = std::mutex{};
+  static auto memory_resources = std::unordered_map<NodeID, boost::container::pmr::memory_resource*>{};
+
+  const auto lock = std::lock_guard<std::mutex>{mutex};
+  auto& memory_resource = memory_resources[node_id];
+  if (!memory_resource) {
+    // Yes, this leaks (see above).
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+    memory_resource = new boost::container::pmr::synchronized_pool_resource(new NumaMemoryResource(node_id));
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+  }
+  return memory_resource;
+}
+
+void* NumaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (_use_libnuma) {
+    // numa_alloc_onnode() returns page-aligned memory, which satisfies all alignments we use.
+    auto* const pointer = numa_alloc_onnode(bytes, static_cast<int>(_node_id));
+    Assert(pointer, "Could not allocate memory on NUMA node " + std::to_string(_node_id) + ".");
+    return pointer;
+  }
+#endif
+  return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+}
+
+void NumaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+#if HYRISE_NUMA_SUPPORT
+  if (_use_libnuma) {
+    numa_free(pointer, bytes);
+    return;
+  }
+#endif
+  boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool NumaMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  const auto* const other_numa_memory_resource = dynamic_cast<const NumaMemoryResource*>(&other);
+  return other_numa_memory_resource && other_numa_memory_resource->_node_id == _node_id;
+}
+
+}  // namespace hyrise
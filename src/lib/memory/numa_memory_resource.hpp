@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * A memory resource that binds its allocations to a NUMA node. With NUMA support on a NUMA system, memory is allocated
+ * using libnuma. As libnuma allocates whole pages, use get() to obtain a pooled resource for small allocations.
+ * Otherwise (e.g., with a fake NUMA topology), allocations are forwarded to the default resource, so that the placement
+ * of chunks and the scheduling of their jobs can still be tested.
+ */
+class NumaMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit NumaMemoryResource(const NodeID node_id);
+
+  NodeID node_id() const;
+
+  // Returns a pooled memory resource that allocates on the given node. Similar to the default resource (see
+  // boost_default_memory_resource.cpp), these resources are never destroyed, as the data allocated by them may live
+  // until the very end of the program.
+  static boost::container::pmr::memory_resource* get(const NodeID node_id);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  const NodeID _node_id;
+  // Only read with NUMA support.
+  [[maybe_unused]] const bool _use_libnuma;
+};
+
+}  // namespace hyrise
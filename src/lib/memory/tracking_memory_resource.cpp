@@ -0,0 +1,41 @@
+#include "tracking_memory_resource.hpp"
+
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+TrackingMemoryResource::TrackingMemoryResource(boost::container::pmr::memory_resource* upstream_resource)
+    : _upstream_resource(upstream_resource) {
+  Assert(_upstream_resource, "TrackingMemoryResource requires an upstream resource.");
+}
+
+size_t TrackingMemoryResource::allocated_bytes() const {
+  return _allocated_bytes.load();
+}
+
+size_t TrackingMemoryResource::peak_allocated_bytes() const {
+  return _peak_allocated_bytes.load();
+}
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  auto* const pointer = _upstream_resource->allocate(bytes, alignment);
+
+  const auto allocated_bytes = _allocated_bytes.fetch_add(bytes) + bytes;
+  auto peak_allocated_bytes = _peak_allocated_bytes.load();
+  while (allocated_bytes > peak_allocated_bytes &&
+         !_peak_allocated_bytes.compare_exchange_weak(peak_allocated_bytes, allocated_bytes)) {}
+
+  return pointer;
+}
+
+void TrackingMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  DebugAssert(_allocated_bytes.load() >= bytes, "Deallocating more bytes than were allocated.");
+  _upstream_resource->deallocate(pointer, bytes, alignment);
+  _allocated_bytes -= bytes;
+}
+
+bool TrackingMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+}  // namespace hyrise
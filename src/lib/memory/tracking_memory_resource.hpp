@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include <boost/container/pmr/global_resource.hpp>
+#include <boost/container/pmr/memory_resource.hpp>
+
+namespace hyrise {
+
+/**
+ * A memory resource that forwards all (de)allocations to an upstream resource and keeps track of the number of bytes
+ * that are currently allocated as well as of the peak allocation. It is used to account for the memory consumption of
+ * operator-internal data structures (e.g., the hash tables of the JoinHash), which can then be compared to a memory
+ * budget. The counters are atomic, so the resource can be shared between the jobs of an operator.
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit TrackingMemoryResource(
+      boost::container::pmr::memory_resource* upstream_resource = boost::container::pmr::get_default_resource());
+
+  size_t allocated_bytes() const;
+  size_t peak_allocated_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+ private:
+  boost::container::pmr::memory_resource* const _upstream_resource;
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _peak_allocated_bytes{0};
+};
+
+}  // namespace hyrise
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include <boost/container/pmr/global_resource.hpp>
+
 #include "concurrency/transaction_context.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_subquery_expression.hpp"
@@ -222,7 +224,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
 
   /**
    * Set the transaction context so that we can execute the copied plan in the current transaction
-   * (see, e.g., ExpressionEvaluator::_evaluate_subquery_expression_for_row)
+   * (see, e.g., ExpressionEvaluator::_evaluate_correlated_subquery_expression)
    */
   if (_transaction_context) {
     copied_op->set_transaction_context(*_transaction_context);
@@ -302,6 +304,33 @@ void AbstractOperator::set_transaction_context_recursively(
   }
 }
 
+boost::container::pmr::memory_resource* AbstractOperator::memory_resource() const {
+  if (!_memory_resource) {
+    return boost::container::pmr::get_default_resource();
+  }
+
+  // The SQLPipelineStatement owns the memory resource while the operators are executed. Handing out an expired
+  // resource would cause a use-after-free, so we check this in release builds as well.
+  const auto memory_resource = _memory_resource->lock();
+  Assert(memory_resource,
+         "Memory resource is expired, but SQLPipelineStatement should still own it (Operator: " + name() + ")");
+  return memory_resource.get();
+}
+
+void AbstractOperator::set_memory_resource_recursively(
+    const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource) {
+  Assert(_state == OperatorState::Created, "Setting the memory resource is allowed for OperatorState::Created only.");
+  _memory_resource = memory_resource;
+
+  if (_left_input) {
+    mutable_left_input()->set_memory_resource_recursively(memory_resource);
+  }
+
+  if (_right_input) {
+    mutable_right_input()->set_memory_resource_recursively(memory_resource);
+  }
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_left_input() const {
   return std::const_pointer_cast<AbstractOperator>(_left_input);
 }
@@ -333,6 +362,15 @@ void AbstractOperator::set_parameters(const std::unordered_map<ParameterID, AllT
   }
 }
 
+void AbstractOperator::set_row_limit(const size_t row_limit) {
+  Assert(_state == OperatorState::Created, "Setting the row limit is allowed for OperatorState::Created only.");
+  _row_limit = row_limit;
+}
+
+std::optional<size_t> AbstractOperator::row_limit() const {
+  return _row_limit;
+}
+
 OperatorState AbstractOperator::state() const {
   return _state;
 }
@@ -3,10 +3,13 @@
 #include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include <boost/container/pmr/memory_resource.hpp>
+
 #include "all_parameter_variant.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "operator_performance_data.hpp"
@@ -36,11 +39,14 @@ enum class OperatorType {
   IndexScan,
   Insert,
   JoinHash,
+  JoinIE,
   JoinIndex,
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
+  KeyIndexLookup,
   Limit,
+  MorselPipeline,
   Print,
   Product,
   Projection,
@@ -160,6 +166,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * Memory resource for allocations that do not outlive the execution of the operator (e.g., hash tables). The
+   * SQLPipelineStatement sets a per-statement ArenaMemoryResource that it releases after the execution. Returns the
+   * default resource if none is set. Not copied by deep_copy(), as it is bound to the execution of a statement.
+   */
+  boost::container::pmr::memory_resource* memory_resource() const;
+
+  // Calls set_memory_resource on itself and both input operators recursively.
+  void set_memory_resource_recursively(const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource);
+
   /**
    * Recursively copies the input operators and
    * @returns a new instance of the same operator with the same configuration. Deduplication of operator plans will be
@@ -204,6 +220,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  /**
+   * Hint that the consumers of this operator only read the first `row_limit` rows of its output, e.g., because the
+   * only consumer is a Limit (see OperatorTask::make_tasks_from_operator). Operators that support the hint (TableScan,
+   * Validate, Projection, UnionAll, and MorselPipeline) stop processing their input as soon as enough rows have been
+   * produced. Their output is then a prefix (in chunk order) of the complete output with at least `row_limit` rows (if
+   * the complete output has as many). All other operators ignore the hint.
+   */
+  void set_row_limit(const size_t row_limit);
+  std::optional<size_t> row_limit() const;
+
   OperatorState state() const;
 
   /**
@@ -262,6 +288,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  // See set_row_limit(). Not copied by deep_copy(), as it depends on the consumers of the operator.
+  std::optional<size_t> _row_limit;
+
+  // Weak pointer, as cached plans should not keep the memory resource of a statement alive.
+  std::optional<std::weak_ptr<boost::container::pmr::memory_resource>> _memory_resource;
+
   // Some operators, e.g., TableScans or Projections, have predicates with uncorrelated subqueries. We store these
   // subqueries in AbstractOperator to create their tasks.
   std::vector<std::shared_ptr<PQPSubqueryExpression>> _uncorrelated_subquery_expressions;
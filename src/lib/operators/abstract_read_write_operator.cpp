@@ -36,6 +36,13 @@ void AbstractReadWriteOperator::execute() {
   _rw_state = ReadWriteOperatorState::Executed;
 }
 
+bool AbstractReadWriteOperator::validate_commit() const {
+  Assert(_rw_state == ReadWriteOperatorState::Executed,
+         "Operator needs to have state Executed in order to be validated.");
+
+  return _on_validate_commit();
+}
+
 void AbstractReadWriteOperator::commit_records(const CommitID commit_id) {
   Assert(_rw_state == ReadWriteOperatorState::Executed,
          "Operator needs to have state Executed in order to be committed.");
@@ -61,6 +68,10 @@ ReadWriteOperatorState AbstractReadWriteOperator::state() const {
   return _rw_state;
 }
 
+bool AbstractReadWriteOperator::_on_validate_commit() const {
+  return true;
+}
+
 void AbstractReadWriteOperator::_mark_as_failed() {
   Assert(_rw_state == ReadWriteOperatorState::Pending, "Operator can only be marked as failed if pending.");
 
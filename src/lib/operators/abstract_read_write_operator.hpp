@@ -36,6 +36,13 @@ class AbstractReadWriteOperator : public AbstractOperator {
 
   void execute() override;
 
+  /**
+   * Checks whether the operator's changes can be committed without violating a constraint of the modified table.
+   * Called by TransactionContext::commit before a commit ID is assigned. If it returns false, the transaction is
+   * rolled back.
+   */
+  bool validate_commit() const;
+
   /**
    * Commits the operator and triggers any potential work following commits.
    */
@@ -75,6 +82,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_commit_records(const CommitID commit_id) = 0;
 
+  /**
+   * Called by validate_commit. Operators that cannot violate constraints do not need to override it.
+   */
+  virtual bool _on_validate_commit() const;
+
   /**
    * Called by rollback_records.
    */
@@ -13,6 +13,7 @@
 #include "aggregate/aggregate_traits.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/arena_memory_resource.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -409,8 +410,14 @@ KeysPerChunk<AggregateKey> AggregateHash::_partition_by_groupby_keys() {
 
             // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
             // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
-            // allocate a bit too much.
-            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
+            // allocate a bit too much. If the operator allocates from an arena, the initial buffer stays below the
+            // arena's threshold for large allocations, so that it is served from the arena's regions instead of being
+            // forwarded to the upstream resource.
+            auto* const upstream_resource = memory_resource();
+            const auto initial_buffer_size = dynamic_cast<ArenaMemoryResource*>(upstream_resource)
+                                                 ? ArenaMemoryResource::LARGE_ALLOCATION_THRESHOLD / 2
+                                                 : size_t{1'000'000};
+            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(initial_buffer_size, upstream_resource);
             auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
 
             auto id_map = tsl::robin_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>, std::equal_to<>,
@@ -1,8 +1,10 @@
 #include "delete.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "operators/validate.hpp"
@@ -10,6 +12,51 @@
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+/**
+ * Calls `functor(referenced_chunk, begin, end)` for each run of RowIDs of the chunk that reference the same chunk of
+ * the referenced table. PosLists that reference a single chunk form one run. The RowIDs of other PosLists are sorted
+ * first, so that each referenced chunk is looked up once and its MvccData is accessed in order. The order of the runs
+ * (and of the rows within) is deterministic, which _on_commit_records and _on_rollback_records rely on.
+ */
+template <typename Functor>
+void for_each_referenced_chunk(const Chunk& referencing_chunk, const Functor& functor) {
+  const auto referencing_segment =
+      std::static_pointer_cast<const ReferenceSegment>(referencing_chunk.get_segment(ColumnID{0}));
+  const auto& referenced_table = referencing_segment->referenced_table();
+  const auto& pos_list = referencing_segment->pos_list();
+  if (pos_list->empty()) {
+    return;
+  }
+
+  if (pos_list->references_single_chunk()) {
+    const auto referenced_chunk = referenced_table->get_chunk(pos_list->common_chunk_id());
+    Assert(referenced_chunk, "Referenced chunks are not allowed to be null pointers");
+    functor(referenced_chunk, pos_list->begin(), pos_list->end());
+    return;
+  }
+
+  auto sorted_row_ids = std::vector<RowID>(pos_list->begin(), pos_list->end());
+  std::sort(sorted_row_ids.begin(), sorted_row_ids.end());
+
+  auto run_begin = sorted_row_ids.cbegin();
+  while (run_begin != sorted_row_ids.cend()) {
+    const auto chunk_id = run_begin->chunk_id;
+    const auto run_end = std::find_if(run_begin, sorted_row_ids.cend(),
+                                      [&](const auto& row_id) { return row_id.chunk_id != chunk_id; });
+
+    const auto referenced_chunk = referenced_table->get_chunk(chunk_id);
+    Assert(referenced_chunk, "Referenced chunks are not allowed to be null pointers");
+    functor(referenced_chunk, run_begin, run_end);
+    run_begin = run_end;
+  }
+}
+
+}  // namespace
+
 namespace hyrise {
 
 Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
@@ -36,10 +83,9 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
     DebugAssert(chunk->references_exactly_one_table(),
                 "All segments in _referencing_table must reference the same table");
 
-    const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
-    const auto pos_list = first_segment->pos_list();
-
     if constexpr (HYRISE_DEBUG) {
+      const auto pos_list =
+          std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}))->pos_list();
       for (auto column_id = ColumnID{0}; column_id < _referencing_table->column_count(); ++column_id) {
         const auto segment = chunk->get_segment(column_id);
         const auto segment_pos_list = std::dynamic_pointer_cast<const ReferenceSegment>(segment)->pos_list();
@@ -49,40 +95,58 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
-    for (const auto row_id : *pos_list) {
-      const auto referenced_chunk = first_segment->referenced_table()->get_chunk(row_id.chunk_id);
-      Assert(referenced_chunk, "Referenced chunks are not allowed to be null pointers");
+    auto success = true;
+    for_each_referenced_chunk(*chunk, [&](const auto& referenced_chunk, const auto begin, const auto end) {
+      if (!success) {
+        return;
+      }
+
+      const auto& mvcc_data = referenced_chunk->mvcc_data();
+      DebugAssert(mvcc_data, "Delete cannot operate on a table without MVCC data");
+
+      // Track whether the run covers each row of the chunk exactly once, i.e., if its offsets are 0, 1, 2, ...
+      auto expected_chunk_offset = ChunkOffset{0};
+      auto is_sequential = true;
 
-      // Scope for the lock on the MVCC data
-      {
-        auto mvcc_data = referenced_chunk->mvcc_data();
-        DebugAssert(mvcc_data, "Delete cannot operate on a table without MVCC data");
+      for (auto iter = begin; iter != end; ++iter) {
+        const auto chunk_offset = (*iter).chunk_offset;
+        is_sequential &= chunk_offset == expected_chunk_offset;
+        ++expected_chunk_offset;
 
-        DebugAssert(
-            Validate::is_row_visible(
-                context->transaction_id(), context->snapshot_commit_id(), mvcc_data->get_tid(row_id.chunk_offset),
-                mvcc_data->get_begin_cid(row_id.chunk_offset), mvcc_data->get_end_cid(row_id.chunk_offset)),
-            "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
+        DebugAssert(Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
+                                             mvcc_data->get_tid(chunk_offset), mvcc_data->get_begin_cid(chunk_offset),
+                                             mvcc_data->get_end_cid(chunk_offset)),
+                    "Trying to delete a row that is not visible to the current transaction. Has the input been "
+                    "validated?");
 
         // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
         const auto expected = TransactionID{0};
-        const auto success = mvcc_data->compare_exchange_tid(row_id.chunk_offset, expected, _transaction_id);
-
-        if (!success) {
-          // If the row has a set TID, it might be a row that our TX inserted
-          // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
-          // change this row from the initial tid
-
-          if (mvcc_data->get_tid(row_id.chunk_offset) == _transaction_id) {
-            // Make sure that even we don't see it anymore
-            mvcc_data->set_tid(row_id.chunk_offset, INVALID_TRANSACTION_ID);
-          } else {
-            // the row is already locked by someone else and the transaction needs to be rolled back
-            _mark_as_failed();
-            return nullptr;
-          }
+        if (mvcc_data->compare_exchange_tid(chunk_offset, expected, _transaction_id)) {
+          continue;
         }
+
+        // If the row has a set TID, it might be a row that our TX inserted
+        // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
+        // change this row from the initial tid
+        if (mvcc_data->get_tid(chunk_offset) == _transaction_id) {
+          // Make sure that even we don't see it anymore
+          mvcc_data->set_tid(chunk_offset, INVALID_TRANSACTION_ID);
+        } else {
+          // the row is already locked by someone else and the transaction needs to be rolled back
+          success = false;
+          return;
+        }
+      }
+
+      // As the chunk is immutable and all of its rows were visible to us, no other row can become visible later.
+      if (!referenced_chunk->is_mutable() && is_sequential && expected_chunk_offset == referenced_chunk->size()) {
+        _entirely_deleted_chunks.emplace(referenced_chunk.get());
       }
+    });
+
+    if (!success) {
+      _mark_as_failed();
+      return nullptr;
     }
   }
 
@@ -93,44 +157,39 @@ void Delete::_on_commit_records(const CommitID commit_id) {
   const auto chunk_count = _referencing_table->chunk_count();
   for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
     const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
-    const auto referencing_segment =
-        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
-    const auto referenced_table = referencing_segment->referenced_table();
 
-    for (const auto row_id : *referencing_segment->pos_list()) {
-      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    for_each_referenced_chunk(*referencing_chunk, [&](const auto& referenced_chunk, const auto begin, const auto end) {
+      const auto& mvcc_data = referenced_chunk->mvcc_data();
+      const auto row_count = static_cast<ChunkOffset::base_type>(std::distance(begin, end));
+
+      if (_entirely_deleted_chunks.contains(referenced_chunk.get())) {
+        mvcc_data->set_chunk_end_cid(commit_id);
+      } else {
+        for (auto iter = begin; iter != end; ++iter) {
+          mvcc_data->set_end_cid((*iter).chunk_offset, commit_id);
+        }
+      }
 
-      referenced_chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, commit_id);
-      referenced_chunk->increase_invalid_row_count(ChunkOffset{1});
+      referenced_chunk->increase_invalid_row_count(ChunkOffset{row_count});
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
-    }
+    });
   }
 }
 
 void Delete::_on_rollback_records() {
+  // Unlock all rows locked in _on_execute. Rows that were not locked by us (e.g., the row that is locked by another
+  // transaction and was the reason for the rollback, and all rows after it) are left untouched by the
+  // compare-and-swap.
   const auto chunk_count = _referencing_table->chunk_count();
   for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
     const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
-    const auto referencing_segment =
-        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
-    const auto referenced_table = referencing_segment->referenced_table();
-
-    for (const auto row_id : *referencing_segment->pos_list()) {
-      auto expected = _transaction_id;
-
-      const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-      // unlock all rows locked in _on_execute
-      const auto result =
-          referenced_chunk->mvcc_data()->compare_exchange_tid(row_id.chunk_offset, expected, TransactionID{0});
-
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) {
-        return;
+    for_each_referenced_chunk(*referencing_chunk, [&](const auto& referenced_chunk, const auto begin, const auto end) {
+      const auto& mvcc_data = referenced_chunk->mvcc_data();
+      for (auto iter = begin; iter != end; ++iter) {
+        mvcc_data->compare_exchange_tid((*iter).chunk_offset, _transaction_id, TransactionID{0});
       }
-    }
+    });
   }
 }
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
@@ -10,9 +11,16 @@
 
 namespace hyrise {
 
+class Chunk;
+
 /**
  * Operator that marks the rows referenced by its input table as MVCC-expired.
  * Assumption: The input has been validated before.
+ *
+ * The rows are processed in runs of RowIDs that reference the same chunk, so that each referenced chunk and its
+ * MvccData is only looked up once per run. Rows of PosLists that reference multiple chunks are sorted for this. If a
+ * transaction deletes all rows of an immutable chunk, the chunk is invalidated with a single chunk-level end CID on
+ * commit (see MvccData::set_chunk_end_cid).
  */
 class Delete : public AbstractReadWriteOperator {
  public:
@@ -33,5 +41,8 @@ class Delete : public AbstractReadWriteOperator {
  private:
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+
+  // Immutable chunks of which all rows are deleted.
+  std::unordered_set<const Chunk*> _entirely_deleted_chunks;
 };
 }  // namespace hyrise
@@ -8,7 +8,13 @@
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/key_hash/key_hash_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -70,12 +76,83 @@ void copy_value_range(const std::shared_ptr<const AbstractSegment>& source_abstr
   }
 }
 
+/**
+ * Returns the segments that the target table can share with the input instead of copying the rows of `source_chunk`.
+ * This is the case for ReferenceSegments that cover an entire immutable chunk in order, such as the columns that an
+ * Update of all rows of a chunk forwards unchanged. As the segments of immutable chunks are never written to, a new
+ * chunk can point to them. Columns that cannot be shared are nullptr. If no column can be shared, the result is empty.
+ */
+Segments shareable_segments(const Chunk& source_chunk, const Table& target_table) {
+  const auto row_count = source_chunk.size();
+  if (row_count == 0 || row_count > target_table.target_chunk_size()) {
+    return {};
+  }
+
+  const auto column_count = source_chunk.column_count();
+  auto segments = Segments(column_count);
+  auto has_shared_segment = false;
+
+  // Usually, all ReferenceSegments of the chunk share their PosList, so we only check each PosList once.
+  auto checked_pos_list = std::shared_ptr<const AbstractPosList>{};
+  auto covers_entire_chunk = false;
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto reference_segment =
+        std::dynamic_pointer_cast<const ReferenceSegment>(source_chunk.get_segment(column_id));
+    if (!reference_segment) {
+      continue;
+    }
+
+    // The referenced column must not contain NULL values if the target column is not nullable.
+    const auto& referenced_table = *reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+    if (referenced_table.column_data_type(referenced_column_id) != target_table.column_data_type(column_id) ||
+        (referenced_table.column_is_nullable(referenced_column_id) && !target_table.column_is_nullable(column_id))) {
+      continue;
+    }
+
+    const auto& pos_list = reference_segment->pos_list();
+    if (!pos_list->references_single_chunk()) {
+      continue;
+    }
+
+    const auto referenced_chunk = referenced_table.get_chunk(pos_list->common_chunk_id());
+    if (!referenced_chunk || referenced_chunk->is_mutable() || referenced_chunk->size() != row_count) {
+      continue;
+    }
+
+    if (pos_list != checked_pos_list) {
+      checked_pos_list = pos_list;
+      auto expected_chunk_offset = ChunkOffset{0};
+      covers_entire_chunk = std::all_of(pos_list->begin(), pos_list->end(), [&](const auto& row_id) {
+        const auto is_expected = row_id.chunk_offset == expected_chunk_offset;
+        ++expected_chunk_offset;
+        return is_expected;
+      });
+    }
+
+    if (covers_entire_chunk) {
+      segments[column_id] = referenced_chunk->get_segment(referenced_column_id);
+      has_shared_segment = true;
+    }
+  }
+
+  if (!has_shared_segment) {
+    return {};
+  }
+
+  return segments;
+}
+
 }  // namespace
 
 namespace hyrise {
 
-Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert)
-    : AbstractReadWriteOperator(OperatorType::Insert, values_to_insert), _target_table_name(target_table_name) {}
+Insert::Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert,
+               const std::optional<SegmentEncodingSpec>& encoding_spec)
+    : AbstractReadWriteOperator(OperatorType::Insert, values_to_insert),
+      _target_table_name(target_table_name),
+      _encoding_spec(encoding_spec) {}
 
 const std::string& Insert::name() const {
   static const auto name = std::string{"Insert"};
@@ -93,6 +170,43 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type");
   }
 
+  /**
+   * 0. Find the source Chunks that reference all rows of an immutable Chunk, as produced by an Update that modifies
+   *    all rows of a Chunk. Instead of copying them row by row, we append a new Chunk that shares the referenced
+   *    Segments (i.e., the unchanged columns) and only materializes the remaining columns.
+   */
+  const auto source_chunk_count = left_input_table()->chunk_count();
+  auto shared_chunk_segments = std::vector<Segments>(source_chunk_count);
+  auto shared_row_count = uint64_t{0};
+  for (auto source_chunk_id = ChunkID{0}; source_chunk_id < source_chunk_count; ++source_chunk_id) {
+    const auto source_chunk = left_input_table()->get_chunk(source_chunk_id);
+    auto segments = shareable_segments(*source_chunk, *_target_table);
+    if (segments.empty()) {
+      continue;
+    }
+
+    const auto row_count = source_chunk->size();
+    const auto column_count = source_chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (segments[column_id]) {
+        continue;
+      }
+
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        const auto value_segment =
+            std::make_shared<ValueSegment<ColumnDataType>>(_target_table->column_is_nullable(column_id), row_count);
+        value_segment->resize(row_count);
+        copy_value_range<ColumnDataType>(source_chunk->get_segment(column_id), ChunkOffset{0}, value_segment,
+                                         ChunkOffset{0}, row_count);
+        segments[column_id] = value_segment;
+      });
+    }
+
+    shared_row_count += row_count;
+    shared_chunk_segments[source_chunk_id] = std::move(segments);
+  }
+
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
    *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
@@ -102,28 +216,50 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   {
     const auto append_lock = _target_table->acquire_append_mutex();
 
-    auto remaining_rows = left_input_table()->row_count();
+    // The Chunks with shared Segments are appended after the last Chunk of the target Table, which must not be left
+    // behind partially filled and mutable. Thus, we first fill a mutable last Chunk with rows that we copy anyway. If
+    // there are not enough of them, we copy (instead of share) the rows of further source Chunks.
+    const auto target_chunk_size = _target_table->target_chunk_size();
+    auto remaining_rows = left_input_table()->row_count() - shared_row_count;
+    const auto last_chunk = _target_table->chunk_count() > 0 ? _target_table->last_chunk() : nullptr;
+    const auto fill_last_chunk =
+        shared_row_count > 0 && last_chunk && last_chunk->is_mutable() && last_chunk->size() < target_chunk_size;
+    if (fill_last_chunk) {
+      const auto free_row_count = target_chunk_size - last_chunk->size();
+      for (auto source_chunk_id = ChunkID{0}; source_chunk_id < source_chunk_count && remaining_rows < free_row_count;
+           ++source_chunk_id) {
+        auto& segments = shared_chunk_segments[source_chunk_id];
+        if (segments.empty()) {
+          continue;
+        }
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
+        const auto row_count = segments.front()->size();
+        shared_row_count -= row_count;
+        remaining_rows += row_count;
+        segments = Segments{};
+      }
     }
-    while (remaining_rows > 0) {
+
+    // Allocates up to `max_row_count` rows at the end of the target Table and returns the number of allocated rows.
+    const auto allocate_chunk_range = [&](const uint64_t max_row_count) {
       auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
       auto target_chunk = _target_table->get_chunk(target_chunk_id);
 
       // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->target_chunk_size()) {
+      if (!target_chunk->is_mutable() || target_chunk->size() == target_chunk_size) {
         _target_table->append_mutable_chunk();
         ++target_chunk_id;
         target_chunk = _target_table->get_chunk(target_chunk_id);
       }
 
-      const auto num_rows_for_target_chunk =
-          std::min<size_t>(_target_table->target_chunk_size() - target_chunk->size(), remaining_rows);
+      const auto num_rows_for_target_chunk = std::min<size_t>(target_chunk_size - target_chunk->size(), max_row_count);
 
+      // Chunks that we fill completely are not written to by other transactions. We make them immutable right away so
+      // that they can be encoded before the commit.
+      const auto fills_entire_chunk = target_chunk->size() == 0 && num_rows_for_target_chunk == target_chunk_size;
       _target_chunk_ranges.emplace_back(
           ChunkRange{target_chunk_id, target_chunk->size(),
-                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk)});
+                     static_cast<ChunkOffset>(target_chunk->size() + num_rows_for_target_chunk), fills_entire_chunk});
 
       // Mark new (but still empty) rows as being under modification by current transaction.
       // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
@@ -170,55 +306,201 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
         std::atomic_thread_fence(std::memory_order_seq_cst);
       }
 
-      remaining_rows -= num_rows_for_target_chunk;
+      if (fills_entire_chunk) {
+        target_chunk->set_immutable();
+      }
+
+      return num_rows_for_target_chunk;
+    };
+
+    if (fill_last_chunk && shared_row_count > 0) {
+      remaining_rows -= allocate_chunk_range(remaining_rows);
+      DebugAssert(last_chunk->size() == target_chunk_size, "Expected the last Chunk to be full.");
+    }
+
+    // Append the Chunks with shared Segments. Their rows are marked as being inserted by the current transaction before
+    // the Chunk becomes visible. As shared Segments must not grow, the Chunks are immutable from the start.
+    for (auto source_chunk_id = ChunkID{0}; source_chunk_id < source_chunk_count; ++source_chunk_id) {
+      const auto& segments = shared_chunk_segments[source_chunk_id];
+      if (segments.empty()) {
+        continue;
+      }
+
+      const auto row_count = static_cast<ChunkOffset>(segments.front()->size());
+      const auto mvcc_data = std::make_shared<MvccData>(row_count, MvccData::MAX_COMMIT_ID);
+      const auto transaction_id = context->transaction_id();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+      }
+
+      const auto target_chunk_id = ChunkID{_target_table->chunk_count()};
+      _target_table->append_chunk(segments, mvcc_data);
+      _target_table->get_chunk(target_chunk_id)->set_immutable();
+      _target_chunk_ranges.emplace_back(ChunkRange{target_chunk_id, ChunkOffset{0}, row_count, true, true});
+    }
+
+    // The remaining rows are copied after the shared Chunks.
+    if (_target_table->chunk_count() == 0) {
+      _target_table->append_mutable_chunk();
+    }
+    while (remaining_rows > 0) {
+      remaining_rows -= allocate_chunk_range(remaining_rows);
     }
   }
 
   /**
-   * 2. Insert the Data into the memory allocated in the first step without holding a lock on the Table.
+   * 2. Insert the Data into the memory allocated in the first step without holding a lock on the Table. Each range is
+   *    written by a separate JobTask, which also encodes the Chunks that the range fills and adds the rows to the
+   *    KeyHashIndexes of the target Table. Until this transaction commits, the rows are invisible to others, who
+   *    resolve the visibility of index entries using the MvccData.
    */
-  auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_target_chunk_ranges.size());
 
+  // The ranges are filled with the rows of the source Chunks that are not shared in order. We determine the first
+  // source row of each range upfront so that the ranges can be written independently.
+  auto source_row_id = RowID{ChunkID{0}, ChunkOffset{0}};
   for (const auto& target_chunk_range : _target_chunk_ranges) {
-    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    const auto write_chunk_range = [&, target_chunk_range, range_source_row_id = source_row_id]() {
+      if (!target_chunk_range.shares_segments) {
+        _copy_chunk_range(target_chunk_range, range_source_row_id, shared_chunk_segments);
+      }
+      _finish_chunk_range(target_chunk_range);
+    };
+
+    // Inserts into a single range, such as the single-row inserts of TPC-C, are not worth scheduling a task.
+    if (_target_chunk_ranges.size() == 1) {
+      write_chunk_range();
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>(write_chunk_range));
+    }
 
-    auto target_chunk_offset = target_chunk_range.begin_chunk_offset;
-    auto target_chunk_range_remaining_rows =
-        ChunkOffset{target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset};
+    if (target_chunk_range.shares_segments) {
+      continue;
+    }
 
-    while (target_chunk_range_remaining_rows > 0) {
-      const auto source_chunk = left_input_table()->get_chunk(source_row_id.chunk_id);
-      const auto source_chunk_remaining_rows = ChunkOffset{source_chunk->size() - source_row_id.chunk_offset};
-      const auto num_rows_current_iteration =
-          std::min<ChunkOffset>(source_chunk_remaining_rows, target_chunk_range_remaining_rows);
+    // Advance to the first source row of the next range. Shared source Chunks do not provide rows to copy.
+    auto remaining_rows = ChunkOffset{target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset};
+    while (remaining_rows > 0) {
+      const auto source_chunk_size = shared_chunk_segments[source_row_id.chunk_id].empty()
+                                         ? left_input_table()->get_chunk(source_row_id.chunk_id)->size()
+                                         : ChunkOffset{0};
+      const auto num_rows =
+          std::min<ChunkOffset>(ChunkOffset{source_chunk_size - source_row_id.chunk_offset}, remaining_rows);
+      source_row_id.chunk_offset += num_rows;
+      remaining_rows -= num_rows;
+      if (source_row_id.chunk_offset == source_chunk_size) {
+        source_row_id = RowID{ChunkID{source_row_id.chunk_id + 1}, ChunkOffset{0}};
+      }
+    }
+  }
 
-      // Copy from the source into the target Segments
-      const auto column_count = target_chunk->column_count();
-      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
-        const auto& source_segment = source_chunk->get_segment(column_id);
-        const auto& target_segment = target_chunk->get_segment(column_id);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
-          using ColumnDataType = typename decltype(data_type_t)::type;
-          copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
-                                           target_chunk_offset, num_rows_current_iteration);
-        });
-      }
+  return nullptr;
+}
 
-      if (num_rows_current_iteration == source_chunk_remaining_rows) {
-        // Proceed to next source Chunk
-        ++source_row_id.chunk_id;
-        source_row_id.chunk_offset = 0;
-      } else {
-        source_row_id.chunk_offset += num_rows_current_iteration;
-      }
+void Insert::_copy_chunk_range(const ChunkRange& target_chunk_range, RowID source_row_id,
+                               const std::vector<Segments>& shared_chunk_segments) {
+  const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+
+  auto target_chunk_offset = target_chunk_range.begin_chunk_offset;
+  auto target_chunk_range_remaining_rows =
+      ChunkOffset{target_chunk_range.end_chunk_offset - target_chunk_range.begin_chunk_offset};
+
+  while (target_chunk_range_remaining_rows > 0) {
+    // Skip the source Chunks that were appended with shared Segments.
+    while (!shared_chunk_segments[source_row_id.chunk_id].empty()) {
+      ++source_row_id.chunk_id;
+    }
+
+    const auto source_chunk = left_input_table()->get_chunk(source_row_id.chunk_id);
+    const auto source_chunk_remaining_rows = ChunkOffset{source_chunk->size() - source_row_id.chunk_offset};
+    const auto num_rows_current_iteration =
+        std::min<ChunkOffset>(source_chunk_remaining_rows, target_chunk_range_remaining_rows);
+
+    // Copy from the source into the target Segments
+    const auto column_count = target_chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& source_segment = source_chunk->get_segment(column_id);
+      const auto& target_segment = target_chunk->get_segment(column_id);
+
+      resolve_data_type(_target_table->column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        copy_value_range<ColumnDataType>(source_segment, source_row_id.chunk_offset, target_segment,
+                                         target_chunk_offset, num_rows_current_iteration);
+      });
+    }
 
-      target_chunk_offset += num_rows_current_iteration;
-      target_chunk_range_remaining_rows -= num_rows_current_iteration;
+    if (num_rows_current_iteration == source_chunk_remaining_rows) {
+      // Proceed to next source Chunk
+      ++source_row_id.chunk_id;
+      source_row_id.chunk_offset = 0;
+    } else {
+      source_row_id.chunk_offset += num_rows_current_iteration;
     }
+
+    target_chunk_offset += num_rows_current_iteration;
+    target_chunk_range_remaining_rows -= num_rows_current_iteration;
   }
+}
 
-  return nullptr;
+void Insert::_finish_chunk_range(const ChunkRange& target_chunk_range) {
+  const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+
+  // Chunks that were appended as immutable are complete now. We encode the Chunks that we have written to and
+  // generate the pruning statistics, so that the Chunks do not have to be revisited after the commit.
+  if (target_chunk_range.is_immutable_chunk) {
+    if (_encoding_spec && !target_chunk_range.shares_segments) {
+      ChunkEncoder::encode_chunk(target_chunk, _target_table->column_data_types(), *_encoding_spec);
+    } else {
+      generate_chunk_pruning_statistics(target_chunk);
+    }
+  }
+
+  for (const auto& key_hash_index : _target_table->key_hash_indexes()) {
+    key_hash_index->insert(*target_chunk, target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                           target_chunk_range.end_chunk_offset);
+  }
+}
+
+bool Insert::_on_validate_commit() const {
+  // Enforce the key constraints that are backed by a KeyHashIndex. The inserted rows were added to the indexes during
+  // execution, so two transactions inserting the same key concurrently see each other's rows: at least the one that
+  // validates last is rolled back.
+  const auto key_hash_indexes = _target_table->key_hash_indexes();
+  if (key_hash_indexes.empty()) {
+    return true;
+  }
+
+  // Collect the rows that the transaction inserted into the target table, including those of other Insert operators
+  // (e.g., of an UPDATE that deleted a row inserted earlier in the transaction).
+  const auto& context = transaction_context();
+  auto own_inserted_rows = std::vector<KeyHashIndex::RowRange>{};
+  for (const auto& read_write_operator : context->read_write_operators()) {
+    const auto insert = std::dynamic_pointer_cast<const Insert>(read_write_operator);
+    if (!insert || insert->_target_table != _target_table) {
+      continue;
+    }
+
+    for (const auto& target_chunk_range : insert->_target_chunk_ranges) {
+      own_inserted_rows.emplace_back(KeyHashIndex::RowRange{
+          target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset});
+    }
+  }
+
+  const auto transaction_id = context->transaction_id();
+  for (const auto& key_hash_index : key_hash_indexes) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      if (key_hash_index->has_duplicates(*_target_table, target_chunk_range.chunk_id,
+                                         target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset,
+                                         transaction_id, own_inserted_rows)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
 }
 
 void Insert::_on_commit_records(const CommitID cid) {
@@ -232,6 +514,11 @@ void Insert::_on_commit_records(const CommitID cid) {
       mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
     }
 
+    // Chunks that were appended as immutable could not be finalized before their rows were committed.
+    if (target_chunk_range.is_immutable_chunk) {
+      mvcc_data->max_begin_cid = cid;
+    }
+
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
@@ -273,6 +560,10 @@ void Insert::_on_rollback_records() {
       mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
     }
 
+    if (target_chunk_range.is_immutable_chunk) {
+      mvcc_data->max_begin_cid = CommitID{0};
+    }
+
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
@@ -282,7 +573,7 @@ std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<Insert>(_target_table_name, copied_left_input);
+  return std::make_shared<Insert>(_target_table_name, copied_left_input, _encoding_spec);
 }
 
 void Insert::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "abstract_read_write_operator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
 #include "storage/pos_lists/row_id_pos_list.hpp"
 #include "utils/assert.hpp"
 
@@ -18,11 +21,22 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * The key constraints of the target table that are backed by a KeyHashIndex are enforced when the transaction
+ * commits: If an inserted key already exists, the transaction is rolled back (see _on_validate_commit).
+ *
+ * If the input rows of a chunk reference all rows of an immutable chunk in order, as it is the case when an Update
+ * modifies an entire chunk, the referenced columns (i.e., the unchanged ones) are not copied. Instead, a new immutable
+ * chunk is appended that shares their segments with the referenced chunk.
+ *
+ * Bulk inserts (e.g., INSERT INTO ... SELECT) allocate all target chunks in a single critical section and write the
+ * row ranges in parallel. Chunks that are filled entirely are immutable from the start. If an `encoding_spec` is
+ * given, they are encoded right after being written, i.e., before the commit makes their rows visible.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
-  explicit Insert(const std::string& target_table_name,
-                  const std::shared_ptr<const AbstractOperator>& values_to_insert);
+  explicit Insert(const std::string& target_table_name, const std::shared_ptr<const AbstractOperator>& values_to_insert,
+                  const std::optional<SegmentEncodingSpec>& encoding_spec = std::nullopt);
 
   const std::string& name() const override;
 
@@ -33,6 +47,7 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  bool _on_validate_commit() const override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
 
@@ -44,8 +59,23 @@ class Insert : public AbstractReadWriteOperator {
     ChunkID chunk_id{};
     ChunkOffset begin_chunk_offset{};
     ChunkOffset end_chunk_offset{};
+    // Whether the range spans an entire chunk that was made immutable when it was allocated. The max_begin_cid of
+    // these chunks is set on commit or rollback.
+    bool is_immutable_chunk{false};
+    // Whether the chunk was appended with Segments shared with another chunk (see _on_execute). Nothing is copied
+    // into these ranges.
+    bool shares_segments{false};
   };
 
+  // Copies the rows starting at `source_row_id` into the range, skipping the source chunks with shared segments.
+  void _copy_chunk_range(const ChunkRange& target_chunk_range, RowID source_row_id,
+                         const std::vector<Segments>& shared_chunk_segments);
+
+  // Encodes the written chunk if it is complete and adds the rows of the range to the KeyHashIndexes.
+  void _finish_chunk_range(const ChunkRange& target_chunk_range);
+
+  const std::optional<SegmentEncodingSpec> _encoding_spec;
+
   std::vector<ChunkRange> _target_chunk_ranges;
 
   std::shared_ptr<Table> _target_table;
@@ -14,11 +14,14 @@
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
 #include "join_helper/join_output_writing.hpp"
+#include "memory/tracking_memory_resource.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/settings/unsigned_integer_setting.hpp"
 #include "utils/timer.hpp"
 
 namespace hyrise {
@@ -62,11 +65,13 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
     that's the L2 cache, for Apple's M1 the L1 cache). This calculation should include hardware knowledge, once
     available in Hyrise. As of now, we assume a cache size of 1024 KB, of which we use 75 %.
 
-    We estimate the size the following way:
+    We estimate the size of the probe hash table (see PosHashTable::finalize() in join_hash_steps.hpp) the following
+    way:
       - we assume each key appears once (that is an overestimation space-wise, but we
         aim rather for a hash map that is slightly smaller than the cache than slightly larger)
-      - each entry in the hash map is a pair of the actual hash key and the SmallPosList storing uint32_t offsets (see
-        hash_join_steps.hpp)
+      - each distinct value occupies PROBE_SLOTS_PER_VALUE ProbeSlots, each of which holds the key and the range of its
+        positions; we assume keys of eight bytes
+      - each row of the build side adds one RowID to the compressed position list
   */
   if (build_side_size > probe_side_size) {
     /*
@@ -83,16 +88,10 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
   constexpr auto L2_CACHE_SIZE = 1'024'000;                   // bytes
   constexpr auto L2_CACHE_MAX_USABLE = L2_CACHE_SIZE * 0.75;  // use 75% of the L2 cache size
 
-  // For information about the sizing of the bytell hash map, see the comments:
-  // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
-  // Bytell hash map has a maximum fill factor of 0.9375. Since it's hard to estimate the number of distinct values in
-  // a radix partition (and thus the size of each hash table), we accomodate a little bit extra space for
-  // slightly skewed data distributions and aim for a fill level of 80%.
-  const auto complete_hash_map_size =
-      // number of items in map
-      static_cast<double>(build_side_size) *
-      // key + value (and one byte overhead, see link above)
-      static_cast<double>(sizeof(uint32_t)) / 0.8;
+  using HashTable = PosHashTable<uint64_t>;
+  constexpr auto HASH_TABLE_ENTRY_SIZE =
+      HashTable::PROBE_SLOTS_PER_VALUE * sizeof(HashTable::ProbeSlot) + sizeof(RowID);
+  const auto complete_hash_map_size = static_cast<double>(build_side_size) * static_cast<double>(HASH_TABLE_ENTRY_SIZE);
 
   const auto cluster_count = std::max(1.0, complete_hash_map_size / L2_CACHE_MAX_USABLE);
 
@@ -103,6 +102,33 @@ size_t JoinHash::calculate_radix_bits(const size_t build_side_size, const size_t
   return std::min(size_t{8}, static_cast<size_t>(std::ceil(std::log2(cluster_count))));
 }
 
+size_t JoinHash::estimate_memory_consumption(const size_t build_side_size, const size_t probe_side_size) {
+  // Each materialized value is stored along with its RowID. During the radix partitioning, both the materialized and
+  // the partitioned elements are held in memory.
+  constexpr auto MATERIALIZED_ELEMENT_SIZE = 2 * (sizeof(RowID) + sizeof(uint64_t));
+
+  // Each value of the build side is stored in the probe hash table (see calculate_radix_bits()) and its RowID is stored
+  // in the position list of the hash table.
+  using HashTable = PosHashTable<uint64_t>;
+  constexpr auto HASH_TABLE_ENTRY_SIZE =
+      HashTable::PROBE_SLOTS_PER_VALUE * sizeof(HashTable::ProbeSlot) + sizeof(RowID);
+
+  return static_cast<size_t>(static_cast<double>(build_side_size + probe_side_size) * MATERIALIZED_ELEMENT_SIZE +
+                             static_cast<double>(build_side_size) * HASH_TABLE_ENTRY_SIZE);
+}
+
+size_t JoinHash::calculate_spill_radix_bits(const size_t memory_consumption, const size_t memory_budget) {
+  DebugAssert(memory_budget > 0, "Expected a memory budget.");
+
+  // As the partitions are spilled to disk, we are not bound by the TLB considerations of calculate_radix_bits() and
+  // allow for a larger fan out.
+  constexpr auto MAX_SPILL_RADIX_BITS = size_t{16};
+
+  const auto partition_count =
+      std::max(2.0, std::ceil(static_cast<double>(memory_consumption) / static_cast<double>(memory_budget)));
+  return std::min(MAX_SPILL_RADIX_BITS, static_cast<size_t>(std::ceil(std::log2(partition_count))));
+}
+
 std::shared_ptr<const Table> JoinHash::_on_execute() {
   Assert(supports({_mode, _primary_predicate.predicate_condition,
                    left_input_table()->column_data_type(_primary_predicate.column_ids.first),
@@ -184,9 +210,22 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
           !std::is_same_v<pmr_string, BuildColumnDataType> && !std::is_same_v<pmr_string, ProbeColumnDataType>;
 
       if constexpr (BOTH_ARE_STRING || NEITHER_IS_STRING) {
+        // If the expected memory consumption exceeds the memory budget, we spill the radix partitions to disk and
+        // choose the number of radix bits so that the data structures of a single partition fit into the budget.
+        // Spilling requires radix partitioning as build and probe partitions would otherwise not correspond.
+        const auto memory_budget =
+            UnsignedIntegerSetting::value_or_default(MEMORY_BUDGET_SETTING, DEFAULT_MEMORY_BUDGET);
+        const auto memory_consumption =
+            estimate_memory_consumption(build_input_table->row_count(), probe_input_table->row_count());
+        const auto exceeds_memory_budget = memory_budget > 0 && memory_consumption > memory_budget;
+
         if (!_radix_bits) {
           _radix_bits = calculate_radix_bits(build_input_table->row_count(), probe_input_table->row_count());
+          if (exceeds_memory_budget) {
+            _radix_bits = std::max(*_radix_bits, calculate_spill_radix_bits(memory_consumption, memory_budget));
+          }
         }
+        const auto spill_to_disk = exceeds_memory_budget && *_radix_bits > 0;
 
         // It needs to be ensured that the build partitions do not get too large, because the used offsets in the
         // hash maps might otherwise overflow. Since radix partitioning aims to avoid large build partitions, this
@@ -199,8 +238,8 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
         _impl = std::make_unique<JoinHashImpl<BuildColumnDataType, ProbeColumnDataType>>(
             *this, build_input_table, probe_input_table, _mode, adjusted_column_ids,
-            _primary_predicate.predicate_condition, output_column_order, *_radix_bits, join_hash_performance_data,
-            adjusted_secondary_predicates);
+            _primary_predicate.predicate_condition, output_column_order, *_radix_bits, spill_to_disk,
+            join_hash_performance_data, adjusted_secondary_predicates);
       } else {
         Fail("Cannot join String with non-String column");
       }
@@ -224,7 +263,7 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const Table>& build_input_table,
                const std::shared_ptr<const Table>& probe_input_table, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-               const OutputColumnOrder output_column_order, const size_t radix_bits,
+               const OutputColumnOrder output_column_order, const size_t radix_bits, const bool spill_to_disk,
                JoinHash::PerformanceData& performance_data, std::vector<OperatorJoinPredicate>& secondary_predicates)
       : _join_hash(join_hash),
         _build_input_table(build_input_table),
@@ -235,7 +274,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
         _performance_data(performance_data),
         _output_column_order(output_column_order),
         _secondary_predicates(secondary_predicates),
-        _radix_bits(radix_bits) {}
+        _radix_bits(radix_bits),
+        _spill_to_disk(spill_to_disk),
+        _hash_table_memory_resource(join_hash.memory_resource()) {}
 
  protected:
   const JoinHash& _join_hash;
@@ -252,6 +293,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
   std::shared_ptr<Table> _output_table;
 
   const size_t _radix_bits;
+  const bool _spill_to_disk;
+
+  // Accounts for the positions stored in the hash tables. Allocates from the operator's memory resource, as the hash
+  // tables do not outlive the execution of the join.
+  TrackingMemoryResource _hash_table_memory_resource;
 
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
@@ -332,6 +378,12 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
             _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter,
             input_bloom_filter);
       }
+
+      // Store the number of materialized values. Depending on the order of materialization (which depends on the input
+      // sizes), each side might or might not be filtered by the Bloom filter.
+      for (const auto& partition : materialized_build_column) {
+        _performance_data.build_side_materialized_value_count += partition.elements.size();
+      }
     };
 
     /**
@@ -348,6 +400,63 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
             _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
             input_bloom_filter);
       }
+
+      for (const auto& partition : materialized_probe_column) {
+        _performance_data.probe_side_materialized_value_count += partition.elements.size();
+      }
+    };
+
+    /**
+     * 2. Perform radix partitioning for build and probe sides. The Bloom filters are not used in this step. Future work
+     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
+     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
+     *    within partition_by_radix.
+     */
+    const auto partition_build_side = [&]() {
+      if (keep_nulls_build_column) {
+        radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
+            materialized_build_column, histograms_build_column, _radix_bits);
+      } else {
+        radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
+            materialized_build_column, histograms_build_column, _radix_bits);
+      }
+
+      // After the data in materialized_build_column has been partitioned, it is not needed anymore.
+      materialized_build_column.clear();
+      histograms_build_column.clear();
+    };
+
+    const auto partition_probe_side = [&]() {
+      if (keep_nulls_probe_column) {
+        radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
+            materialized_probe_column, histograms_probe_column, _radix_bits);
+      } else {
+        radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
+            materialized_probe_column, histograms_probe_column, _radix_bits);
+      }
+
+      // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
+      materialized_probe_column.clear();
+      histograms_probe_column.clear();
+    };
+
+    // When spilling, each side is partitioned and written to disk right after it has been materialized, i.e., before
+    // the other side is materialized. Thus, the materialized and partitioned elements of only one side are held in
+    // memory at a time. This phase is not bounded by the memory budget (see JoinHash::MEMORY_BUDGET_SETTING).
+    auto spilled_build_column = std::optional<SpilledRadixContainer<BuildColumnType>>{};
+    auto spilled_probe_column = std::optional<SpilledRadixContainer<ProbeColumnType>>{};
+    auto build_column_contains_null_value = false;
+    auto clustering_duration = std::chrono::nanoseconds{};
+
+    const auto spill_build_side = [&]() {
+      partition_build_side();
+      build_column_contains_null_value = _contains_null_value(radix_build_column);
+      spilled_build_column.emplace(std::move(radix_build_column));
+    };
+
+    const auto spill_probe_side = [&]() {
+      partition_probe_side();
+      spilled_probe_column.emplace(std::move(radix_probe_column));
     };
 
     auto timer_materialization = Timer{};
@@ -357,70 +466,47 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       // Bloom filter that returns true for every probe.
       materialize_build_side(ALL_TRUE_BLOOM_FILTER);
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+      if (_spill_to_disk) {
+        spill_build_side();
+        clustering_duration += timer_materialization.lap();
+      }
       materialize_probe_side(build_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+      if (_spill_to_disk) {
+        spill_probe_side();
+        clustering_duration += timer_materialization.lap();
+      }
     } else {
       // Here, we first materialize the probe side and use the resulting Bloom filter in the materialization of the
       // build side. Consequently, the Bloom filter later passed into build() will have no effect as it has already
       // been used here to filter non-matching values.
       materialize_probe_side(ALL_TRUE_BLOOM_FILTER);
       _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+      if (_spill_to_disk) {
+        spill_probe_side();
+        clustering_duration += timer_materialization.lap();
+      }
       materialize_build_side(probe_side_bloom_filter);
       _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+      if (_spill_to_disk) {
+        spill_build_side();
+        clustering_duration += timer_materialization.lap();
+      }
     }
 
-    // Store the number of materialized values. Depending on the order of materialization (which depends on the input
-    // sizes), each side might or might not be filtered by the Bloom filter.
-    for (const auto& partition : materialized_build_column) {
-      _performance_data.build_side_materialized_value_count += partition.elements.size();
-    }
-    for (const auto& partition : materialized_probe_column) {
-      _performance_data.probe_side_materialized_value_count += partition.elements.size();
+    if (_spill_to_disk) {
+      _performance_data.set_step_runtime(OperatorSteps::Clustering, clustering_duration);
+      return _build_and_probe_spilled_partitions(std::move(*spilled_build_column), std::move(*spilled_probe_column),
+                                                 probe_side_bloom_filter, build_column_contains_null_value);
     }
 
-    /**
-     * 2. Perform radix partitioning for build and probe sides. The Bloom filters are not used in this step. Future work
-     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
-     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
-     *    within partition_by_radix.
-     */
     if (_radix_bits > 0) {
       auto timer_clustering = Timer{};
       auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-
-      jobs.emplace_back(std::make_shared<JobTask>([&]() {
-        // radix partition the build table
-        if (keep_nulls_build_column) {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
-        } else {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
-        }
-
-        // After the data in materialized_build_column has been partitioned, it is not needed anymore.
-        materialized_build_column.clear();
-      }));
-
-      jobs.emplace_back(std::make_shared<JobTask>([&]() {
-        // radix partition the probe column.
-        if (keep_nulls_probe_column) {
-          radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
-        } else {
-          radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
-        }
-
-        // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
-        materialized_probe_column.clear();
-      }));
-
+      jobs.emplace_back(std::make_shared<JobTask>(partition_build_side));
+      jobs.emplace_back(std::make_shared<JobTask>(partition_probe_side));
       Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-      histograms_build_column.clear();
-      histograms_probe_column.clear();
-
       _performance_data.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
     } else {
       // short cut: skip radix partitioning and use materialized data directly
@@ -437,31 +523,9 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    probe step.
      */
     auto timer_hash_map_building = Timer{};
-    if (_secondary_predicates.empty() && is_semi_or_anti_join(_mode)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
+    hash_tables = _build(radix_build_column, probe_side_bloom_filter);
     _performance_data.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
-    // Store the element counts of the built hash tables. Depending on the Bloom filter, we might have significantly
-    // less values stored than in the initial input table.
-    for (const auto& hash_table : hash_tables) {
-      if (!hash_table) {
-        continue;
-      }
-
-      _performance_data.hash_tables_distinct_value_count += hash_table->distinct_value_count();
-      const auto position_count = hash_table->position_count();
-      if (position_count) {
-        // Update or set hash_tables_position_count if hash table stores positions.
-        _performance_data.hash_tables_position_count =
-            _performance_data.hash_tables_position_count.value_or(0) + *position_count;
-      }
-    }
-
     /**
      * Short cut for AntiNullAsTrue:
      *   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted anyway (as
@@ -469,17 +533,11 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *   hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
      *   detecting a NULL value on the build side there.
      */
-    if (_mode == JoinMode::AntiNullAsTrue) {
-      for (const auto& build_side_partition : radix_build_column) {
-        for (const auto null_value : build_side_partition.null_values) {
-          if (null_value) {
-            auto timer_output_writing = Timer{};
-            const auto result = _join_hash._build_output_table({});
-            _performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
-            return result;
-          }
-        }
-      }
+    if (_mode == JoinMode::AntiNullAsTrue && _contains_null_value(radix_build_column)) {
+      auto timer_output_writing = Timer{};
+      const auto result = _join_hash._build_output_table({});
+      _performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+      return result;
     }
 
     radix_build_column.clear();
@@ -502,6 +560,53 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     }
 
     Timer timer_probing;
+    _probe(radix_probe_column, hash_tables, build_side_pos_lists, probe_side_pos_lists);
+    _performance_data.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+
+    radix_probe_column.clear();
+    hash_tables.clear();
+
+    /**
+     * 5. Write output Table
+     */
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
+
+  std::vector<std::optional<PosHashTable<HashedType>>> _build(const RadixContainer<BuildColumnType>& radix_build_column,
+                                                              const BloomFilter& probe_side_bloom_filter) {
+    auto hash_tables = std::vector<std::optional<PosHashTable<HashedType>>>{};
+    if (_secondary_predicates.empty() && is_semi_or_anti_join(_mode)) {
+      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly,
+                                                       _radix_bits, probe_side_bloom_filter,
+                                                       &_hash_table_memory_resource);
+    } else {
+      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
+                                                       probe_side_bloom_filter, &_hash_table_memory_resource);
+    }
+
+    // Store the element counts of the built hash tables. Depending on the Bloom filter, we might have significantly
+    // less values stored than in the initial input table.
+    for (const auto& hash_table : hash_tables) {
+      if (!hash_table) {
+        continue;
+      }
+
+      _performance_data.hash_tables_distinct_value_count += hash_table->distinct_value_count();
+      const auto position_count = hash_table->position_count();
+      if (position_count) {
+        // Update or set hash_tables_position_count if hash table stores positions.
+        _performance_data.hash_tables_position_count =
+            _performance_data.hash_tables_position_count.value_or(0) + *position_count;
+      }
+    }
+    _performance_data.hash_tables_peak_memory_usage = _hash_table_memory_resource.peak_allocated_bytes();
+
+    return hash_tables;
+  }
+
+  void _probe(const RadixContainer<ProbeColumnType>& radix_probe_column,
+              const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
+              std::vector<RowIDPosList>& build_side_pos_lists, std::vector<RowIDPosList>& probe_side_pos_lists) {
     switch (_mode) {
       case JoinMode::Inner:
         probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
@@ -537,15 +642,65 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       default:
         Fail("JoinMode not supported by JoinHash");
     }
-    _performance_data.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+  }
 
-    radix_probe_column.clear();
-    hash_tables.clear();
+  // Builds and probes the spilled radix partitions of both sides one partition at a time, so that only the hash table
+  // and the elements of a single partition are held in memory (see JoinHash::MEMORY_BUDGET_SETTING).
+  std::shared_ptr<const Table> _build_and_probe_spilled_partitions(
+      SpilledRadixContainer<BuildColumnType>&& spilled_build_column,
+      SpilledRadixContainer<ProbeColumnType>&& spilled_probe_column, const BloomFilter& probe_side_bloom_filter,
+      const bool build_column_contains_null_value) {
+    _performance_data.spilled_bytes = spilled_build_column.spilled_bytes() + spilled_probe_column.spilled_bytes();
+
+    // See the short cut for AntiNullAsTrue in _on_execute().
+    if (_mode == JoinMode::AntiNullAsTrue && build_column_contains_null_value) {
+      auto timer_output_writing = Timer{};
+      const auto result = _join_hash._build_output_table({});
+      _performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+      return result;
+    }
 
-    /**
-     * 5. Write output Table
-     */
+    DebugAssert(spilled_build_column.partition_count() == spilled_probe_column.partition_count(),
+                "Expected radix-partitioned inputs.");
+    const auto partition_count = spilled_probe_column.partition_count();
+
+    auto build_side_pos_lists = std::vector<RowIDPosList>(partition_count);
+    auto probe_side_pos_lists = std::vector<RowIDPosList>(partition_count);
+    auto building_duration = std::chrono::nanoseconds{};
+    auto probing_duration = std::chrono::nanoseconds{};
+
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      auto timer = Timer{};
+
+      // build() and probe() operate on RadixContainers with a single partition and a single hash table here. Their
+      // results are written to the partition's position lists.
+      const auto hash_tables = _build(spilled_build_column.load_partition(partition_idx), probe_side_bloom_filter);
+      building_duration += timer.lap();
+
+      auto partition_build_side_pos_lists = std::vector<RowIDPosList>(1);
+      auto partition_probe_side_pos_lists = std::vector<RowIDPosList>(1);
+      _probe(spilled_probe_column.load_partition(partition_idx), hash_tables, partition_build_side_pos_lists,
+             partition_probe_side_pos_lists);
+      build_side_pos_lists[partition_idx] = std::move(partition_build_side_pos_lists.front());
+      probe_side_pos_lists[partition_idx] = std::move(partition_probe_side_pos_lists.front());
+      probing_duration += timer.lap();
+    }
+
+    _performance_data.set_step_runtime(OperatorSteps::Building, building_duration);
+    _performance_data.set_step_runtime(OperatorSteps::Probing, probing_duration);
+
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
 
+  template <typename T>
+  static bool _contains_null_value(const RadixContainer<T>& radix_container) {
+    return std::any_of(radix_container.begin(), radix_container.end(), [](const auto& partition) {
+      return std::find(partition.null_values.begin(), partition.null_values.end(), true) != partition.null_values.end();
+    });
+  }
+
+  std::shared_ptr<const Table> _write_output_table(std::vector<RowIDPosList>& build_side_pos_lists,
+                                                   std::vector<RowIDPosList>& probe_side_pos_lists) {
     /**
      * After the probe step build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
      * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match
@@ -578,6 +733,9 @@ void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, Descripti
   const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
   stream << separator << "Radix bits: " << radix_bits << ".";
   stream << separator << "Build side is " << (left_input_is_build_side ? "left." : "right.");
+  if (spilled_bytes) {
+    stream << separator << "Spilled " << format_bytes(*spilled_bytes) << " to disk.";
+  }
 }
 
 }  // namespace hyrise
@@ -35,6 +35,22 @@ class JoinHash : public AbstractJoinOperator {
 
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size);
 
+  // Memory budget (in bytes) for the intermediate data structures of a single JoinHash, i.e., the materialized and
+  // radix-partitioned inputs as well as the hash tables. If the estimated memory consumption exceeds the budget, the
+  // radix partitions are spilled to a temporary file and built and probed one partition at a time. Note that the
+  // materialization and the radix partitioning still happen in memory, one side at a time. Their memory consumption is
+  // bounded by the size of the larger materialized side, not by the budget. The budget is not shared between the
+  // operators of a query, i.e., there is no query-level memory accounting. A budget of 0 disables spilling.
+  static constexpr auto MEMORY_BUDGET_SETTING = "JoinHash.memory_budget";
+  static constexpr auto DEFAULT_MEMORY_BUDGET = uint64_t{0};
+
+  // Estimates the memory consumption of the materialized inputs and the hash tables. We assume values of eight bytes.
+  static size_t estimate_memory_consumption(const size_t build_side_size, const size_t probe_side_size);
+
+  // Returns the number of radix bits required so that a single partition (and its hash table) is expected to fit into
+  // the memory budget.
+  static size_t calculate_spill_radix_bits(const size_t memory_consumption, const size_t memory_budget);
+
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
     ProbeSideMaterializing,
@@ -63,6 +79,12 @@ class JoinHash : public AbstractJoinOperator {
     // build_side_position_count (see order of materialization in hash_join.cpp).
     size_t hash_tables_distinct_value_count{0};
     std::optional<size_t> hash_tables_position_count;
+
+    // Peak number of bytes allocated for the positions stored in the hash tables.
+    size_t hash_tables_peak_memory_usage{0};
+
+    // Number of bytes written to disk if the radix partitions were spilled (see MEMORY_BUDGET_SETTING).
+    std::optional<size_t> spilled_bytes;
   };
 
  protected:
@@ -1,11 +1,14 @@
 #include "join_output_writing.hpp"
 
+#include <optional>
 #include <unordered_map>
 
 #include <boost/functional/hash_fwd.hpp>
 
 #include "hyrise.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_grouped_positions.hpp"
 #include "storage/segment_iterate.hpp"
 
 namespace {
@@ -15,6 +18,10 @@ using namespace hyrise;  // NOLINT(build/namespaces)
 using PosLists = std::vector<std::shared_ptr<const AbstractPosList>>;
 using PosListsByColumn = std::vector<std::shared_ptr<PosLists>>;
 
+// PosLists of reference inputs are resolved grouped by chunk (see write_output_segments) if they have at least this
+// many positions per input chunk. Otherwise, the grouping does not pay off.
+constexpr auto MIN_POSITIONS_FOR_GROUPED_RESOLUTION = size_t{4};
+
 struct PosListsHasher {
   size_t operator()(const PosLists& pos_lists) const {
     return boost::hash_range(pos_lists.begin(), pos_lists.end());
@@ -81,6 +88,7 @@ void write_output_segments(Segments& output_segments, const std::shared_ptr<cons
                            const PosListsByColumn& input_pos_lists_by_column,
                            std::shared_ptr<RowIDPosList>& pos_list) {
   auto output_pos_list_cache = std::unordered_map<std::shared_ptr<PosLists>, std::shared_ptr<RowIDPosList>>{};
+  auto grouped_positions = std::optional<ChunkGroupedPositions>{};
 
   auto dummy_table = std::shared_ptr<Table>{};
   const auto chunk_count = input_table->chunk_count();
@@ -112,27 +120,62 @@ void write_output_segments(Segments& output_segments, const std::shared_ptr<cons
       if (iter == output_pos_list_cache.end()) {
         // Get the row ids that are referenced.
         auto new_pos_list = std::make_shared<RowIDPosList>();
-        new_pos_list->reserve(pos_list->size());
-
         auto common_chunk_id = std::optional<ChunkID>{};
-        for (const auto& row : *pos_list) {
-          if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-            new_pos_list->push_back(row);
-            common_chunk_id = INVALID_CHUNK_ID;
-            continue;
-          }
 
-          const auto& referenced_pos_list = *(*input_table_pos_lists)[row.chunk_id];
-          new_pos_list->push_back(referenced_pos_list[row.chunk_offset]);
-
-          // Check if the current row matches the ChunkIDs that we have seen in previous rows.
-          const auto referenced_chunk_id = referenced_pos_list[row.chunk_offset].chunk_id;
+        // Check if the current row matches the ChunkIDs that we have seen in previous rows.
+        const auto track_common_chunk_id = [&](const ChunkID referenced_chunk_id) {
           if (!common_chunk_id) {
             common_chunk_id = referenced_chunk_id;
           } else if (*common_chunk_id != referenced_chunk_id) {
             common_chunk_id = INVALID_CHUNK_ID;
           }
+        };
+
+        if (pos_list->size() < MIN_POSITIONS_FOR_GROUPED_RESOLUTION * chunk_count) {
+          new_pos_list->reserve(pos_list->size());
+
+          for (const auto& row : *pos_list) {
+            if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
+              new_pos_list->push_back(row);
+              common_chunk_id = INVALID_CHUNK_ID;
+              continue;
+            }
+
+            const auto& referenced_pos_list = *(*input_table_pos_lists)[row.chunk_id];
+            new_pos_list->push_back(referenced_pos_list[row.chunk_offset]);
+            track_common_chunk_id(referenced_pos_list[row.chunk_offset].chunk_id);
+          }
+        } else {
+          // For larger PosLists, we resolve the positions grouped by the input chunk they reference. This way, the
+          // type of each input PosList is resolved once per input chunk instead of calling the virtual operator[]
+          // for every row, and the input PosList is read in order. The grouping is shared by all columns.
+          if (!grouped_positions) {
+            grouped_positions = group_positions_by_chunk_id(pos_list, chunk_count);
+          }
+
+          new_pos_list->resize(pos_list->size());
+          for (const auto null_position : grouped_positions->null_positions) {
+            (*new_pos_list)[null_position] = NULL_ROW_ID;
+            common_chunk_id = INVALID_CHUNK_ID;
+          }
+
+          const auto run_count = grouped_positions->chunk_ids.size();
+          for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+            const auto run_end = grouped_positions->run_ends[run_index];
+            resolve_pos_list_type(
+                (*input_table_pos_lists)[grouped_positions->chunk_ids[run_index]],
+                [&](const auto& referenced_pos_list) {
+                  for (auto position_index = grouped_positions->run_begin(run_index); position_index < run_end;
+                       ++position_index) {
+                    const auto referenced_row_id =
+                        (*referenced_pos_list)[grouped_positions->chunk_offsets[position_index]];
+                    (*new_pos_list)[grouped_positions->original_positions[position_index]] = referenced_row_id;
+                    track_common_chunk_id(referenced_row_id.chunk_id);
+                  }
+                });
+          }
         }
+
         if (common_chunk_id && *common_chunk_id != INVALID_CHUNK_ID) {
           // Track the occuring chunk ids and set the single chunk guarantee if possible. Generally, this is the case
           // if both of the following are true: (1) The probe side input already had this guarantee and (2) no radix
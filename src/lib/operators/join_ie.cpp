@@ -0,0 +1,550 @@
+#include "join_ie.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "join_helper/join_output_writing.hpp"
+#include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// For predicates of the form `left < right` (or <=), rows are ordered ascendingly. Otherwise, they are ordered
+// descendingly.
+bool requires_smaller_left_value(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals;
+}
+
+bool is_strict(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan || predicate_condition == PredicateCondition::GreaterThan;
+}
+
+// Returns whether any pair of values from the ranges [left_min, left_max] and [right_min, right_max] can satisfy the
+// predicate.
+template <typename T>
+bool ranges_may_match(const PredicateCondition predicate_condition, const T& left_min, const T& left_max,
+                      const T& right_min, const T& right_max) {
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      return left_min < right_max;
+    case PredicateCondition::LessThanEquals:
+      return left_min <= right_max;
+    case PredicateCondition::GreaterThan:
+      return left_max > right_min;
+    case PredicateCondition::GreaterThanEquals:
+      return left_max >= right_min;
+    default:
+      Fail("Unsupported predicate condition.");
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+bool JoinIE::supports(const JoinConfiguration config) {
+  // The second inequality predicate is passed as first secondary predicate. The JoinConfiguration does not carry the
+  // secondary predicates, so the constructor checks its predicate condition.
+  return is_inequality_predicate_condition(config.predicate_condition) && config.secondary_predicates &&
+         config.left_data_type == config.right_data_type && config.join_mode != JoinMode::AntiNullAsTrue &&
+         config.join_mode != JoinMode::Cross;
+}
+
+JoinIE::JoinIE(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const OperatorJoinPredicate& primary_predicate,
+               const std::vector<OperatorJoinPredicate>& secondary_predicates)
+    : AbstractJoinOperator(OperatorType::JoinIE, left, right, mode, primary_predicate, secondary_predicates,
+                           std::make_unique<PerformanceData>()) {
+  Assert(is_inequality_predicate_condition(primary_predicate.predicate_condition),
+         "JoinIE requires an inequality predicate as primary predicate.");
+  Assert(!secondary_predicates.empty() &&
+             is_inequality_predicate_condition(secondary_predicates.front().predicate_condition),
+         "JoinIE requires an inequality predicate as first secondary predicate.");
+}
+
+const std::string& JoinIE::name() const {
+  static const auto name = std::string{"JoinIE"};
+  return name;
+}
+
+std::shared_ptr<AbstractOperator> JoinIE::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<JoinIE>(copied_left_input, copied_right_input, _mode, _primary_predicate,
+                                  _secondary_predicates);
+}
+
+void JoinIE::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> JoinIE::_on_execute() {
+  const auto& secondary_predicate = _secondary_predicates.front();
+  const auto primary_data_type = left_input_table()->column_data_type(_primary_predicate.column_ids.first);
+  const auto secondary_data_type = left_input_table()->column_data_type(secondary_predicate.column_ids.first);
+
+  Assert(supports({_mode, _primary_predicate.predicate_condition, primary_data_type,
+                   right_input_table()->column_data_type(_primary_predicate.column_ids.second),
+                   !_secondary_predicates.empty(), left_input_table()->type(), right_input_table()->type()}),
+         "JoinIE doesn't support these parameters.");
+  Assert(secondary_data_type == right_input_table()->column_data_type(secondary_predicate.column_ids.second),
+         "JoinIE requires matching column types for the secondary inequality predicate.");
+
+  resolve_data_type(primary_data_type, [&](const auto primary_data_type_t) {
+    using PrimaryDataType = typename decltype(primary_data_type_t)::type;
+    resolve_data_type(secondary_data_type, [&](const auto secondary_data_type_t) {
+      using SecondaryDataType = typename decltype(secondary_data_type_t)::type;
+      _impl = std::make_unique<JoinIEImpl<PrimaryDataType, SecondaryDataType>>(*this);
+    });
+  });
+
+  return _impl->_on_execute();
+}
+
+void JoinIE::_on_cleanup() {
+  _impl.reset();
+}
+
+void JoinIE::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto block_pair_count = block_pairs_joined + block_pairs_pruned;
+  stream << (description_mode == DescriptionMode::SingleLine ? " " : "\n") << "Joined " << block_pairs_joined
+         << " of " << block_pair_count << " block pair" << (block_pair_count != 1 ? "s" : "") << ".";
+}
+
+template <typename PrimaryDataType, typename SecondaryDataType>
+class JoinIE::JoinIEImpl : public AbstractReadOnlyOperatorImpl {
+ public:
+  explicit JoinIEImpl(JoinIE& join_ie)
+      : _join_ie{join_ie},
+        _mode{join_ie._mode},
+        _primary_predicate{join_ie._primary_predicate},
+        _secondary_predicate{join_ie._secondary_predicates.front()},
+        _remaining_predicates(join_ie._secondary_predicates.cbegin() + 1, join_ie._secondary_predicates.cend()),
+        _performance_data{static_cast<PerformanceData&>(*join_ie.performance_data)} {}
+
+  std::shared_ptr<const Table> _on_execute() override {
+    auto timer = Timer{};
+
+    const auto left_input_table = _join_ie.left_input_table();
+    const auto right_input_table = _join_ie.right_input_table();
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      _materialize(*left_input_table, _primary_predicate.column_ids.first, _secondary_predicate.column_ids.first,
+                   _left_rows, _left_null_row_ids);
+    }));
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      _materialize(*right_input_table, _primary_predicate.column_ids.second, _secondary_predicate.column_ids.second,
+                   _right_rows, _right_null_row_ids);
+    }));
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    _performance_data.set_step_runtime(OperatorSteps::Materializing, timer.lap());
+
+    // Join all block pairs that might contain matches.
+    const auto left_blocks = _create_blocks(_left_rows);
+    const auto right_blocks = _create_blocks(_right_rows);
+
+    auto block_pairs = std::vector<std::pair<const Block*, const Block*>>{};
+    for (const auto& left_block : left_blocks) {
+      for (const auto& right_block : right_blocks) {
+        if (ranges_may_match(_primary_predicate.predicate_condition, left_block.primary_min, left_block.primary_max,
+                             right_block.primary_min, right_block.primary_max) &&
+            ranges_may_match(_secondary_predicate.predicate_condition, left_block.secondary_min,
+                             left_block.secondary_max, right_block.secondary_min, right_block.secondary_max)) {
+          block_pairs.emplace_back(&left_block, &right_block);
+        }
+      }
+    }
+    _performance_data.block_pairs_joined = block_pairs.size();
+    _performance_data.block_pairs_pruned = left_blocks.size() * right_blocks.size() - block_pairs.size();
+
+    const auto block_pair_count = block_pairs.size();
+    auto block_pair_results = std::vector<BlockPairResult>(block_pair_count);
+    jobs.clear();
+    for (auto block_pair_id = size_t{0}; block_pair_id < block_pair_count; ++block_pair_id) {
+      const auto& [left_block, right_block] = block_pairs[block_pair_id];
+      const auto join_block_pair = [&, block_pair_id, left_block = left_block, right_block = right_block]() {
+        // Accessors are not thread-safe, so we create one evaluator per job.
+        auto multi_predicate_join_evaluator = std::optional<MultiPredicateJoinEvaluator>{};
+        if (!_remaining_predicates.empty()) {
+          multi_predicate_join_evaluator.emplace(*left_input_table, *right_input_table, _mode, _remaining_predicates);
+        }
+
+        block_pair_results[block_pair_id] =
+            _join_block_pair(*left_block, *right_block, multi_predicate_join_evaluator);
+      };
+
+      if (left_block->end - left_block->begin + right_block->end - right_block->begin > JOB_SPAWN_THRESHOLD) {
+        jobs.emplace_back(std::make_shared<JobTask>(join_block_pair));
+      } else {
+        join_block_pair();
+      }
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    _performance_data.set_step_runtime(OperatorSteps::Joining, timer.lap());
+
+    auto output_chunks = _write_output_chunks(block_pair_results);
+    _performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+    return _join_ie._build_output_table(std::move(output_chunks));
+  }
+
+ protected:
+  struct Row {
+    PrimaryDataType primary_value;
+    SecondaryDataType secondary_value;
+    RowID row_id;
+  };
+
+  // A range of consecutive rows of the sorted input and the value ranges of both inequality columns.
+  struct Block {
+    size_t begin;
+    size_t end;
+    PrimaryDataType primary_min;
+    PrimaryDataType primary_max;
+    SecondaryDataType secondary_min;
+    SecondaryDataType secondary_max;
+  };
+
+  // Matches of a block pair. The matched rows (indexes into the sorted inputs) are only collected for outer, semi,
+  // and anti joins.
+  struct BlockPairResult {
+    RowIDPosList pos_list_left;
+    RowIDPosList pos_list_right;
+    std::vector<size_t> matched_left_rows;
+    std::vector<size_t> matched_right_rows;
+  };
+
+  // Materializes the values of both inequality columns and sorts the rows by the primary predicate's column. Rows
+  // with a NULL value in one of the columns never match and are collected separately.
+  void _materialize(const Table& table, const ColumnID primary_column_id, const ColumnID secondary_column_id,
+                    std::vector<Row>& rows, RowIDPosList& null_row_ids) const {
+    rows.reserve(table.row_count());
+
+    auto primary_values = std::vector<PrimaryDataType>{};
+    auto primary_nulls = std::vector<bool>{};
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto chunk_size = chunk->size();
+      primary_values.resize(chunk_size);
+      primary_nulls.assign(chunk_size, false);
+
+      segment_iterate<PrimaryDataType>(*chunk->get_segment(primary_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          primary_nulls[position.chunk_offset()] = true;
+        } else {
+          primary_values[position.chunk_offset()] = position.value();
+        }
+      });
+
+      segment_iterate<SecondaryDataType>(*chunk->get_segment(secondary_column_id), [&](const auto& position) {
+        const auto chunk_offset = position.chunk_offset();
+        const auto row_id = RowID{chunk_id, chunk_offset};
+        if (primary_nulls[chunk_offset] || position.is_null()) {
+          null_row_ids.emplace_back(row_id);
+          return;
+        }
+
+        rows.emplace_back(Row{std::move(primary_values[chunk_offset]), position.value(), row_id});
+      });
+    }
+
+    if (requires_smaller_left_value(_primary_predicate.predicate_condition)) {
+      std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.primary_value < rhs.primary_value;
+      });
+    } else {
+      std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.primary_value > rhs.primary_value;
+      });
+    }
+  }
+
+  static std::vector<Block> _create_blocks(const std::vector<Row>& rows) {
+    auto blocks = std::vector<Block>{};
+    const auto row_count = rows.size();
+    blocks.reserve((row_count + BLOCK_SIZE - 1) / BLOCK_SIZE);
+
+    for (auto begin = size_t{0}; begin < row_count; begin += BLOCK_SIZE) {
+      const auto end = std::min(begin + BLOCK_SIZE, row_count);
+
+      // The rows are sorted by the primary value, either ascendingly or descendingly.
+      const auto [primary_min, primary_max] = std::minmax(rows[begin].primary_value, rows[end - 1].primary_value);
+      const auto [secondary_min, secondary_max] =
+          std::minmax_element(rows.cbegin() + begin, rows.cbegin() + end, [](const auto& lhs, const auto& rhs) {
+            return lhs.secondary_value < rhs.secondary_value;
+          });
+      blocks.emplace_back(Block{begin, end, primary_min, primary_max, secondary_min->secondary_value,
+                                secondary_max->secondary_value});
+    }
+
+    return blocks;
+  }
+
+  BlockPairResult _join_block_pair(const Block& left_block, const Block& right_block,
+                                   std::optional<MultiPredicateJoinEvaluator>& multi_predicate_join_evaluator) const {
+    const auto left_row_count = left_block.end - left_block.begin;
+    const auto right_row_count = right_block.end - right_block.begin;
+    const auto row_count = left_row_count + right_row_count;
+
+    // Entries of L1 smaller than left_row_count denote rows of the left block, all others rows of the right block.
+    const auto row = [&](const uint32_t entry) -> const Row& {
+      return entry < left_row_count ? _left_rows[left_block.begin + entry]
+                                    : _right_rows[right_block.begin + entry - left_row_count];
+    };
+
+    // L1: Merge both blocks, which are already sorted by the primary value. A left row l and a right row r satisfy
+    // the primary predicate iff r is placed after l. Thus, for strict predicates, right rows precede left rows with the
+    // same value.
+    const auto primary_ascending = requires_smaller_left_value(_primary_predicate.predicate_condition);
+    const auto primary_strict = is_strict(_primary_predicate.predicate_condition);
+    auto l1 = std::vector<uint32_t>(row_count);
+    auto left_entry = uint32_t{0};
+    auto right_entry = static_cast<uint32_t>(left_row_count);
+    for (auto& entry : l1) {
+      if (right_entry == row_count) {
+        entry = left_entry++;
+        continue;
+      }
+      if (left_entry == left_row_count) {
+        entry = right_entry++;
+        continue;
+      }
+
+      const auto& left_value = row(left_entry).primary_value;
+      const auto& right_value = row(right_entry).primary_value;
+      const auto left_first = left_value == right_value
+                                  ? !primary_strict
+                                  : (primary_ascending ? left_value < right_value : left_value > right_value);
+      entry = left_first ? left_entry++ : right_entry++;
+    }
+
+    // L2: Permutation of the positions in L1, ordered such that, when a left row l is visited, exactly the right rows
+    // r satisfying the secondary predicate have been visited before. For `l < r`, the rows are visited in descending
+    // order. For strict predicates, left rows are visited before right rows with the same value.
+    const auto secondary_descending = requires_smaller_left_value(_secondary_predicate.predicate_condition);
+    const auto secondary_strict = is_strict(_secondary_predicate.predicate_condition);
+    auto l2 = std::vector<uint32_t>(row_count);
+    std::iota(l2.begin(), l2.end(), uint32_t{0});
+    std::sort(l2.begin(), l2.end(), [&](const uint32_t lhs, const uint32_t rhs) {
+      const auto lhs_entry = l1[lhs];
+      const auto rhs_entry = l1[rhs];
+      const auto& lhs_value = row(lhs_entry).secondary_value;
+      const auto& rhs_value = row(rhs_entry).secondary_value;
+      if (lhs_value != rhs_value) {
+        return secondary_descending ? lhs_value > rhs_value : lhs_value < rhs_value;
+      }
+
+      const auto lhs_is_left = lhs_entry < left_row_count;
+      const auto rhs_is_left = rhs_entry < left_row_count;
+      return secondary_strict ? lhs_is_left && !rhs_is_left : !lhs_is_left && rhs_is_left;
+    });
+
+    // The bit array marks the L1 positions of visited right rows. A second level marks the non-empty words of the bit
+    // array so that empty regions are skipped quickly.
+    auto bits = std::vector<uint64_t>((row_count + 63) / 64);
+    auto bit_summary = std::vector<uint64_t>((bits.size() + 63) / 64);
+
+    const auto track_left_matches = _mode == JoinMode::Left || _mode == JoinMode::FullOuter;
+    const auto track_right_matches = _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
+    const auto is_semi_or_anti = is_semi_or_anti_join(_mode);
+
+    auto result = BlockPairResult{};
+    auto left_matches = std::vector<bool>(track_left_matches ? left_row_count : 0);
+    auto right_matches = std::vector<bool>(track_right_matches ? right_row_count : 0);
+
+    for (const auto position : l2) {
+      const auto entry = l1[position];
+      if (entry >= left_row_count) {
+        const auto word_id = position / 64;
+        bits[word_id] |= uint64_t{1} << (position % 64);
+        bit_summary[word_id / 64] |= uint64_t{1} << (word_id % 64);
+        continue;
+      }
+
+      const auto& left_row = _left_rows[left_block.begin + entry];
+
+      // Visit all set bits after the position of the left row in L1.
+      const auto first_position = static_cast<size_t>(position) + 1;
+      if (first_position == row_count) {
+        continue;
+      }
+      auto word_id = first_position / 64;
+      auto word = bits[word_id] & (~uint64_t{0} << (first_position % 64));
+      while (true) {
+        auto stop = false;
+        while (word && !stop) {
+          const auto match_position = word_id * 64 + std::countr_zero(word);
+          word &= word - 1;
+
+          const auto right_entry = l1[match_position] - left_row_count;
+          const auto& right_row = _right_rows[right_block.begin + right_entry];
+          if (multi_predicate_join_evaluator &&
+              !multi_predicate_join_evaluator->satisfies_all_predicates(left_row.row_id, right_row.row_id)) {
+            continue;
+          }
+
+          if (is_semi_or_anti) {
+            // A single match per left row suffices.
+            result.matched_left_rows.emplace_back(left_block.begin + entry);
+            stop = true;
+            continue;
+          }
+
+          result.pos_list_left.emplace_back(left_row.row_id);
+          result.pos_list_right.emplace_back(right_row.row_id);
+          if (track_left_matches) {
+            left_matches[entry] = true;
+          }
+          if (track_right_matches) {
+            right_matches[right_entry] = true;
+          }
+        }
+        if (stop) {
+          break;
+        }
+
+        // Find the next non-empty word using the summary.
+        ++word_id;
+        auto summary_id = word_id / 64;
+        if (summary_id >= bit_summary.size()) {
+          break;
+        }
+        auto summary_word = bit_summary[summary_id] & (~uint64_t{0} << (word_id % 64));
+        while (!summary_word && ++summary_id < bit_summary.size()) {
+          summary_word = bit_summary[summary_id];
+        }
+        if (!summary_word) {
+          break;
+        }
+        word_id = summary_id * 64 + std::countr_zero(summary_word);
+        word = bits[word_id];
+      }
+    }
+
+    for (auto entry = size_t{0}; entry < left_matches.size(); ++entry) {
+      if (left_matches[entry]) {
+        result.matched_left_rows.emplace_back(left_block.begin + entry);
+      }
+    }
+    for (auto entry = size_t{0}; entry < right_matches.size(); ++entry) {
+      if (right_matches[entry]) {
+        result.matched_right_rows.emplace_back(right_block.begin + entry);
+      }
+    }
+
+    return result;
+  }
+
+  std::vector<std::shared_ptr<Chunk>> _write_output_chunks(std::vector<BlockPairResult>& block_pair_results) const {
+    const auto left_input_table = _join_ie.left_input_table();
+    const auto right_input_table = _join_ie.right_input_table();
+
+    auto left_matches = std::vector<bool>(_left_rows.size());
+    auto right_matches = std::vector<bool>(_right_rows.size());
+    for (const auto& block_pair_result : block_pair_results) {
+      for (const auto row : block_pair_result.matched_left_rows) {
+        left_matches[row] = true;
+      }
+      for (const auto row : block_pair_result.matched_right_rows) {
+        right_matches[row] = true;
+      }
+    }
+
+    constexpr auto ALLOW_PARTITION_MERGE = true;
+
+    // Semi and anti joins only emit rows of the left input.
+    if (is_semi_or_anti_join(_mode)) {
+      const auto emit_matches = _mode == JoinMode::Semi;
+      auto pos_lists = std::vector<RowIDPosList>(1);
+      auto& pos_list = pos_lists.front();
+      for (auto row = size_t{0}; row < _left_rows.size(); ++row) {
+        if (left_matches[row] == emit_matches) {
+          pos_list.emplace_back(_left_rows[row].row_id);
+        }
+      }
+      if (!emit_matches) {
+        pos_list.insert(pos_list.end(), _left_null_row_ids.cbegin(), _left_null_row_ids.cend());
+      }
+
+      auto empty_pos_lists = std::vector<RowIDPosList>(1);
+      return write_output_chunks(empty_pos_lists, pos_lists, right_input_table, left_input_table, false,
+                                 left_input_table->type() == TableType::References, OutputColumnOrder::RightOnly,
+                                 ALLOW_PARTITION_MERGE);
+    }
+
+    auto pos_lists_left = std::vector<RowIDPosList>{};
+    auto pos_lists_right = std::vector<RowIDPosList>{};
+    pos_lists_left.reserve(block_pair_results.size() + 1);
+    pos_lists_right.reserve(block_pair_results.size() + 1);
+    for (auto& block_pair_result : block_pair_results) {
+      pos_lists_left.emplace_back(std::move(block_pair_result.pos_list_left));
+      pos_lists_right.emplace_back(std::move(block_pair_result.pos_list_right));
+    }
+
+    // Add the unmatched rows (including rows with NULL values) for outer joins.
+    auto unmatched_pos_list_left = RowIDPosList{};
+    auto unmatched_pos_list_right = RowIDPosList{};
+    const auto emit_unmatched = [&](const auto& rows, const auto& matches, const auto& null_row_ids,
+                                    RowIDPosList& pos_list, RowIDPosList& null_pos_list) {
+      for (auto row = size_t{0}; row < rows.size(); ++row) {
+        if (!matches[row]) {
+          pos_list.emplace_back(rows[row].row_id);
+        }
+      }
+      pos_list.insert(pos_list.end(), null_row_ids.cbegin(), null_row_ids.cend());
+      null_pos_list.resize(pos_list.size(), NULL_ROW_ID);
+    };
+
+    if (_mode == JoinMode::Left || _mode == JoinMode::FullOuter) {
+      emit_unmatched(_left_rows, left_matches, _left_null_row_ids, unmatched_pos_list_left, unmatched_pos_list_right);
+    }
+    if (_mode == JoinMode::Right || _mode == JoinMode::FullOuter) {
+      emit_unmatched(_right_rows, right_matches, _right_null_row_ids, unmatched_pos_list_right,
+                     unmatched_pos_list_left);
+    }
+    pos_lists_left.emplace_back(std::move(unmatched_pos_list_left));
+    pos_lists_right.emplace_back(std::move(unmatched_pos_list_right));
+
+    return write_output_chunks(pos_lists_left, pos_lists_right, left_input_table, right_input_table,
+                               left_input_table->type() == TableType::References,
+                               right_input_table->type() == TableType::References,
+                               OutputColumnOrder::LeftFirstRightSecond, ALLOW_PARTITION_MERGE);
+  }
+
+  JoinIE& _join_ie;
+  const JoinMode _mode;
+  const OperatorJoinPredicate _primary_predicate;
+  const OperatorJoinPredicate _secondary_predicate;
+  const std::vector<OperatorJoinPredicate> _remaining_predicates;
+  PerformanceData& _performance_data;
+
+  std::vector<Row> _left_rows;
+  std::vector<Row> _right_rows;
+  RowIDPosList _left_null_row_ids;
+  RowIDPosList _right_null_row_ids;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * This operator implements the IEJoin algorithm (Khayyat et al., "Lightning Fast and Space Efficient Inequality Joins",
+ * VLDB 2015) for joins with two inequality predicates, e.g., band joins or interval joins such as
+ * `a.start <= b.ts AND b.ts < a.end`. The primary predicate and the first secondary predicate have to be inequality
+ * predicates (<, <=, >, >=). All further secondary predicates are evaluated for the candidate pairs.
+ *
+ * The join works as follows:
+ * -> Both inputs are materialized and sorted by the column of the primary predicate. Rows with a NULL value in one of
+ *    the two inequality columns never match.
+ * -> Both sorted inputs are cut into blocks. For each pair of a left and a right block, the value ranges of the blocks
+ *    are compared. Pairs that cannot contain a match are pruned, all others are joined in parallel.
+ * -> For a block pair, the rows of both blocks are merged into one array (L1) ordered by the primary predicate's
+ *    column. A permutation array orders the rows by the secondary predicate's column (L2). Visiting L2 in order, each
+ *    right row sets its bit (at its position in L1) in a bit array, and each left row emits the right rows whose bits
+ *    are set at larger L1 positions. The ordering of L1 and L2 (including the handling of ties for strict and
+ *    non-strict predicates) ensures that exactly the right rows satisfying both predicates are found.
+ *
+ * All join modes except for AntiNullAsTrue are supported. Both columns of an inequality predicate need to have the same
+ * data type.
+ */
+class JoinIE : public AbstractJoinOperator {
+ public:
+  static bool supports(const JoinConfiguration config);
+
+  JoinIE(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+         const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
+         const std::vector<OperatorJoinPredicate>& secondary_predicates);
+
+  const std::string& name() const override;
+
+  enum class OperatorSteps : uint8_t { Materializing, Joining, OutputWriting };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    size_t block_pairs_joined{0};
+    size_t block_pairs_pruned{0};
+  };
+
+  // Number of rows per input block. Blocks are small enough so that the bit array and the permutation array of a
+  // block pair fit into the L2 cache.
+  static constexpr auto BLOCK_SIZE = size_t{4096};
+
+  // Block pairs with fewer rows are joined directly instead of spawning a job. See JoinSortMerge::JOB_SPAWN_THRESHOLD.
+  static constexpr auto JOB_SPAWN_THRESHOLD = size_t{500};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_cleanup() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  template <typename PrimaryDataType, typename SecondaryDataType>
+  class JoinIEImpl;
+  template <typename PrimaryDataType, typename SecondaryDataType>
+  friend class JoinIEImpl;
+
+  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
+};
+
+}  // namespace hyrise
@@ -9,15 +9,70 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/abstract_chunk_index.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/column_pruning_utils.hpp"
 #include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
+#include "validate.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Number of probe values that are looked up in the table-level index at once.
+constexpr auto TABLE_INDEX_LOOKUP_BATCH_SIZE = size_t{1024};
+
+/**
+ * Returns a table-level index of the stored table on the join column of the index side input, which was produced by
+ * `get_table`. As the GetTable may have omitted chunks (pruned or deleted ones) and columns, the RowIDs of the index
+ * cannot be used directly. Thus, we also return a mapping from the ChunkIDs of the stored table to the ChunkIDs of the
+ * same chunks in `index_input_table`. Chunks that are not part of the input or not indexed are mapped to
+ * INVALID_CHUNK_ID. The chunks are matched by comparing their join segments, which GetTable passes on.
+ */
+std::pair<std::shared_ptr<PartialHashIndex>, std::vector<ChunkID>> find_table_index(const GetTable& get_table,
+                                                                                    const Table& index_input_table,
+                                                                                    const ColumnID column_id) {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table.table_name());
+  const auto stored_column_id = column_id_before_pruning(column_id, get_table.pruned_column_ids());
+  const auto table_indexes = stored_table->get_table_indexes(stored_column_id);
+  if (table_indexes.empty()) {
+    return {nullptr, {}};
+  }
+
+  const auto& table_index = table_indexes.front();
+  const auto indexed_chunk_ids = table_index->get_indexed_chunk_ids();
+
+  const auto stored_chunk_count = stored_table->chunk_count();
+  const auto input_chunk_count = index_input_table.chunk_count();
+  auto index_chunk_ids = std::vector<ChunkID>(stored_chunk_count, INVALID_CHUNK_ID);
+  auto input_chunk_id = ChunkID{0};
+  for (auto stored_chunk_id = ChunkID{0}; stored_chunk_id < stored_chunk_count && input_chunk_id < input_chunk_count;
+       ++stored_chunk_id) {
+    const auto stored_chunk = stored_table->get_chunk(stored_chunk_id);
+    if (!stored_chunk || index_input_table.get_chunk(input_chunk_id)->get_segment(column_id) !=
+                             stored_chunk->get_segment(stored_column_id)) {
+      continue;
+    }
+
+    if (indexed_chunk_ids.contains(stored_chunk_id)) {
+      index_chunk_ids[stored_chunk_id] = input_chunk_id;
+    }
+    ++input_chunk_id;
+  }
+
+  return {table_index, std::move(index_chunk_ids)};
+}
+
+}  // namespace
 
 namespace hyrise {
 
@@ -151,9 +206,66 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   Timer timer;
   if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
       _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
-    // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
+
+    // If the index side input is a Validate on top of a GetTable (as it is for all tables with MVCC), the chunks that
+    // are covered by a table-level index of the stored table are joined using that index. As the Validate might have
+    // removed rows, only the rows it emitted are joined.
+    auto covered_by_table_index = std::vector<bool>(chunk_count_index_input_table);
+    const auto index_input_validate =
+        std::dynamic_pointer_cast<const Validate>(_index_side == IndexSide::Left ? left_input() : right_input());
+    const auto index_input_get_table =
+        index_input_validate ? std::dynamic_pointer_cast<const GetTable>(index_input_validate->left_input()) : nullptr;
+    const auto probe_column_id = _adjusted_primary_predicate.column_ids.first;
+    const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+    if (index_input_get_table && _adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+        _probe_input_table->column_data_type(probe_column_id) ==
+            _index_input_table->column_data_type(index_column_id)) {
+      const auto get_table_output = index_input_validate->left_input_table();
+      const auto [table_index, index_chunk_ids] =
+          find_table_index(*index_input_get_table, *get_table_output, index_column_id);
+      if (table_index) {
+        auto is_indexed = std::vector<bool>(get_table_output->chunk_count());
+        for (const auto get_table_chunk_id : index_chunk_ids) {
+          if (get_table_chunk_id != INVALID_CHUNK_ID) {
+            is_indexed[get_table_chunk_id] = true;
+          }
+        }
+
+        // Flag the rows emitted by the Validate, by the chunks of the GetTable's output they reference.
+        auto visible_rows = std::vector<std::vector<bool>>(get_table_output->chunk_count());
+        for (auto index_chunk_id = ChunkID{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+          const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+          Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+          const auto& reference_segment =
+              static_cast<const ReferenceSegment&>(*index_chunk->get_segment(index_column_id));
+          const auto& pos_list = *reference_segment.pos_list();
+          if (pos_list.empty() || !pos_list.references_single_chunk() ||
+              reference_segment.referenced_table() != get_table_output || !is_indexed[pos_list[0].chunk_id]) {
+            continue;
+          }
+
+          auto& chunk_visible_rows = visible_rows[pos_list[0].chunk_id];
+          chunk_visible_rows.resize(get_table_output->get_chunk(pos_list[0].chunk_id)->size());
+          for (const auto& row_id : pos_list) {
+            chunk_visible_rows[row_id.chunk_offset] = true;
+          }
+          covered_by_table_index[index_chunk_id] = true;
+          ++join_index_performance_data.chunks_scanned_with_index;
+        }
+
+        _data_join_using_table_index(*table_index, index_chunk_ids, false, false, visible_rows);
+        index_joining_duration += timer.lap();
+      }
+    }
+
+    // Scan all remaining chunks for index input
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+      if (covered_by_table_index[index_chunk_id]) {
+        continue;
+      }
+
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -201,9 +313,40 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       }
     }
   } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
+
+    // Join the chunks that are covered by a table-level index with a single index lookup per probe value. NULL values
+    // are not looked up, which is why AntiNullAsTrue joins are excluded.
+    auto covered_by_table_index = std::vector<bool>(chunk_count_index_input_table);
+    const auto index_input_get_table = std::dynamic_pointer_cast<const GetTable>(
+        _index_side == IndexSide::Left ? left_input() : right_input());
+    const auto probe_column_id = _adjusted_primary_predicate.column_ids.first;
+    const auto index_column_id = _adjusted_primary_predicate.column_ids.second;
+    if (index_input_get_table && _adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals &&
+        _mode != JoinMode::AntiNullAsTrue && _secondary_predicates.empty() &&
+        _probe_input_table->column_data_type(probe_column_id) ==
+            _index_input_table->column_data_type(index_column_id)) {
+      const auto [table_index, index_chunk_ids] =
+          find_table_index(*index_input_get_table, *_index_input_table, index_column_id);
+      if (table_index) {
+        _data_join_using_table_index(*table_index, index_chunk_ids, track_probe_matches, track_index_matches);
+
+        for (const auto index_chunk_id : index_chunk_ids) {
+          if (index_chunk_id != INVALID_CHUNK_ID) {
+            covered_by_table_index[index_chunk_id] = true;
+            ++join_index_performance_data.chunks_scanned_with_index;
+          }
+        }
+        index_joining_duration += timer.lap();
+      }
+    }
+
+    // Scan all remaining chunks for index input
     for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+      if (covered_by_table_index[index_chunk_id]) {
+        continue;
+      }
+
       const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -310,6 +453,92 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
   join_index_performance_data.chunks_scanned_without_index++;
 }
 
+void JoinIndex::_data_join_using_table_index(const PartialHashIndex& table_index,
+                                             const std::vector<ChunkID>& index_chunk_ids,
+                                             const bool track_probe_matches, const bool track_index_matches,
+                                             const std::vector<std::vector<bool>>& visible_rows) {
+  const auto probe_column_id = _adjusted_primary_predicate.column_ids.first;
+  const auto semi_or_anti_join = is_semi_or_anti_join(_mode);
+  const auto stored_chunk_count = index_chunk_ids.size();
+  const auto dereference_matches = !visible_rows.empty();
+  DebugAssert(!dereference_matches || (_mode == JoinMode::Inner && !track_probe_matches && !track_index_matches),
+              "Reference tables on the index side are supported for Inner joins only.");
+
+  resolve_data_type(_probe_input_table->column_data_type(probe_column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto probe_values = std::vector<ColumnDataType>{};
+    auto probe_chunk_offsets = std::vector<ChunkOffset>{};
+    probe_values.reserve(TABLE_INDEX_LOOKUP_BATCH_SIZE);
+    probe_chunk_offsets.reserve(TABLE_INDEX_LOOKUP_BATCH_SIZE);
+
+    const auto chunk_count = _probe_input_table->chunk_count();
+    for (auto probe_chunk_id = ChunkID{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
+      const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      const auto look_up_batch = [&]() {
+        if (probe_values.empty()) {
+          return;
+        }
+
+        table_index.range_equals_batched(
+            [&](const size_t value_idx, const std::vector<RowID>& index_row_ids) {
+              const auto probe_row_id = RowID{probe_chunk_id, probe_chunk_offsets[value_idx]};
+              auto has_match = false;
+              for (const auto& index_row_id : index_row_ids) {
+                // Skip rows of chunks that are not part of the index side input, e.g., because they were pruned.
+                if (index_row_id.chunk_id >= stored_chunk_count ||
+                    index_chunk_ids[index_row_id.chunk_id] == INVALID_CHUNK_ID) {
+                  continue;
+                }
+
+                const auto index_chunk_id = index_chunk_ids[index_row_id.chunk_id];
+                if (dereference_matches && (index_row_id.chunk_offset >= visible_rows[index_chunk_id].size() ||
+                                            !visible_rows[index_chunk_id][index_row_id.chunk_offset])) {
+                  continue;
+                }
+
+                has_match = true;
+                if (!semi_or_anti_join) {
+                  _probe_pos_list->emplace_back(probe_row_id);
+                  _index_pos_list->emplace_back(RowID{index_chunk_id, index_row_id.chunk_offset});
+                  if (dereference_matches) {
+                    _index_pos_dereferenced.emplace_back(true);
+                  }
+                }
+
+                if (track_index_matches) {
+                  _index_matches[index_chunk_id][index_row_id.chunk_offset] = true;
+                }
+              }
+
+              if (has_match && track_probe_matches) {
+                _probe_matches[probe_chunk_id][probe_row_id.chunk_offset] = true;
+              }
+            },
+            probe_values);
+
+        probe_values.clear();
+        probe_chunk_offsets.clear();
+      };
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(probe_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        probe_values.emplace_back(position.value());
+        probe_chunk_offsets.emplace_back(position.chunk_offset());
+        if (probe_values.size() == TABLE_INDEX_LOOKUP_BATCH_SIZE) {
+          look_up_batch();
+        }
+      });
+      look_up_batch();
+    }
+  });
+}
+
 // join loop that joins two segments of two columns using an iterator for the probe side,
 // and an index for the index side
 template <typename ProbeIterator>
@@ -14,6 +14,7 @@
 namespace hyrise {
 
 class MultiPredicateJoinEvaluator;
+class PartialHashIndex;
 using IndexRange = std::pair<AbstractChunkIndex::Iterator, AbstractChunkIndex::Iterator>;
 
 /**
@@ -26,6 +27,11 @@ using IndexRange = std::pair<AbstractChunkIndex::Iterator, AbstractChunkIndex::I
    * fallback solution (nested join loop) is used. Using the fallback solution does not increment the number of chunks
    * scanned with index in the performance data.
    *
+   * If the index side input is a data table produced by a GetTable and the stored table has a table-level index
+   * (PartialHashIndex) on the join column, equi-joins look up each probe value once in this index instead of once per
+   * chunk. The probe values are looked up in batches (see PartialHashIndex::range_equals_batched). Only the chunks not
+   * covered by the table-level index are joined using chunk indexes or the nested loop fallback.
+   *
    * Note: An index needs to be present on the index side table in order to execute an index join.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -65,6 +71,14 @@ class JoinIndex : public AbstractJoinOperator {
                              const bool track_index_matches, const bool is_semi_or_anti_join,
                              MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
 
+  // Joins the chunks that are covered by a table-level index with a single index lookup per probe value. If
+  // `visible_rows` is not empty, the index side input is a reference table (a Validate on top of a GetTable). Then,
+  // `index_chunk_ids` map to chunks of the GetTable's output, only the rows flagged in `visible_rows` are joined, and
+  // the matches are written as dereferenced RowIDs (see _index_pos_dereferenced).
+  void _data_join_using_table_index(const PartialHashIndex& table_index, const std::vector<ChunkID>& index_chunk_ids,
+                                    const bool track_probe_matches, const bool track_index_matches,
+                                    const std::vector<std::vector<bool>>& visible_rows = {});
+
   template <typename ProbeIterator>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
@@ -1,11 +1,16 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
+#include <bit>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -68,6 +73,82 @@ join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, LeftIte
     }
   }
 }
+
+// Number of right values that are compared with a left value at once in join_two_materialized_segments(). The results
+// of a block are collected in a bit mask, which allows the compiler to vectorize the comparisons.
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// Non-NULL values of a segment and their chunk offsets.
+template <typename T>
+struct MaterializedSegment {
+  std::vector<T> values;
+  std::vector<ChunkOffset> chunk_offsets;
+};
+
+template <typename T>
+MaterializedSegment<T> materialize_non_null_values(const AbstractSegment& segment) {
+  auto materialized_segment = MaterializedSegment<T>{};
+  materialized_segment.values.reserve(segment.size());
+  materialized_segment.chunk_offsets.reserve(segment.size());
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (!position.is_null()) {
+      materialized_segment.values.emplace_back(position.value());
+      materialized_segment.chunk_offsets.emplace_back(position.chunk_offset());
+    }
+  });
+
+  return materialized_segment;
+}
+
+// Block-nested-loop kernel for arithmetic columns. NULL values are not materialized, as they never match (the kernel is
+// not used for AntiNullAsTrue joins).
+template <typename BinaryFunctor, typename T>
+void __attribute__((noinline))
+join_two_materialized_segments(const BinaryFunctor& func, const MaterializedSegment<T>& left,
+                               const MaterializedSegment<T>& right, const ChunkID chunk_id_left,
+                               const ChunkID chunk_id_right, const JoinNestedLoop::JoinParams& params) {
+  const auto left_size = left.values.size();
+  const auto right_size = right.values.size();
+  const auto* const right_values = right.values.data();
+
+  // Semi and anti joins only need to know whether a left row has a match.
+  const auto stop_after_first_match =
+      !params.write_pos_lists && !params.track_right_matches && params.track_left_matches;
+
+  for (auto left_index = size_t{0}; left_index < left_size; ++left_index) {
+    const auto left_value = left.values[left_index];
+    const auto left_row_id = RowID{chunk_id_left, left.chunk_offsets[left_index]};
+
+    for (auto block_begin = size_t{0}; block_begin < right_size; block_begin += BLOCK_SIZE) {
+      const auto block_size = std::min(BLOCK_SIZE, right_size - block_begin);
+
+      auto mask = uint64_t{0};
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        mask |= static_cast<uint64_t>(func(left_value, right_values[block_begin + index])) << index;
+      }
+
+      while (mask) {
+        const auto index = block_begin + std::countr_zero(mask);
+        mask &= mask - 1;
+
+        const auto right_row_id = RowID{chunk_id_right, right.chunk_offsets[index]};
+        if (params.secondary_predicate_evaluator.satisfies_all_predicates(left_row_id, right_row_id)) {
+          process_match(left_row_id, right_row_id, params);
+        }
+      }
+
+      if (stop_after_first_match && params.left_matches[left_row_id.chunk_offset]) {
+        break;
+      }
+    }
+  }
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -138,68 +219,148 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
   const auto track_left_matches = is_outer_join || semi_or_anti_join;
   const auto track_right_matches = _mode == JoinMode::FullOuter;
 
-  auto left_matches_by_chunk = std::vector<std::vector<bool>>(left_table->chunk_count());
+  // Each job joins one left chunk with a range of right chunks. The ranges are chosen such that each job performs at
+  // least MIN_COMPARISONS_PER_JOB comparisons (unless the range reaches the last right chunk). The jobs write their
+  // matches into their own position lists and match vectors, which are merged afterwards.
+  struct ChunkPairsJob {
+    ChunkID chunk_id_left;
+    ChunkID chunk_id_right_begin;
+    ChunkID chunk_id_right_end;
+    RowIDPosList pos_list_left;
+    RowIDPosList pos_list_right;
+    std::vector<bool> left_matches;
+    std::vector<std::vector<bool>> right_matches;
+  };
 
-  auto right_matches_by_chunk = std::vector<std::vector<bool>>(right_table->chunk_count());
+  const auto chunk_count_left = left_table->chunk_count();
   const auto chunk_count_right = right_table->chunk_count();
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-    const auto chunk_right = right_table->get_chunk(chunk_id_right);
-    Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  auto chunk_pairs_jobs = std::vector<ChunkPairsJob>{};
+  for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+    const auto chunk_left = left_table->get_chunk(chunk_id_left);
+    Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    right_matches_by_chunk[chunk_id_right].resize(chunk_right->size());
+    const auto chunk_size_left = size_t{chunk_left->size()};
+    auto chunk_id_right_begin = ChunkID{0};
+    auto comparison_count = size_t{0};
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+      const auto chunk_right = right_table->get_chunk(chunk_id_right);
+      Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      comparison_count += chunk_size_left * chunk_right->size();
+      if (comparison_count >= MIN_COMPARISONS_PER_JOB || chunk_id_right + 1 == chunk_count_right) {
+        chunk_pairs_jobs.emplace_back(
+            ChunkPairsJob{chunk_id_left, chunk_id_right_begin, ChunkID{chunk_id_right + 1}, {}, {}, {}, {}});
+        chunk_id_right_begin = ChunkID{chunk_id_right + 1};
+        comparison_count = 0;
+      }
+    }
   }
 
-  auto secondary_predicate_evaluator =
-      MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_pairs_jobs.size());
+  for (auto& chunk_pairs_job : chunk_pairs_jobs) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, &chunk_pairs_job = chunk_pairs_job]() {
+      // Accessors are not thread-safe, so we create one evaluator per job.
+      auto secondary_predicate_evaluator =
+          MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+
+      const auto chunk_id_left = chunk_pairs_job.chunk_id_left;
+      const auto segment_left = left_table->get_chunk(chunk_id_left)->get_segment(left_column_id);
+      if (track_left_matches) {
+        chunk_pairs_job.left_matches.resize(segment_left->size());
+      }
 
-  // Scan all chunks from left input
-  const auto chunk_count_left = left_table->chunk_count();
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
-    const auto chunk_left = left_table->get_chunk(chunk_id_left);
-    Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      chunk_pairs_job.right_matches.resize(chunk_pairs_job.chunk_id_right_end - chunk_pairs_job.chunk_id_right_begin);
+      for (auto chunk_id_right = chunk_pairs_job.chunk_id_right_begin;
+           chunk_id_right < chunk_pairs_job.chunk_id_right_end; ++chunk_id_right) {
+        const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
+        auto& right_matches = chunk_pairs_job.right_matches[chunk_id_right - chunk_pairs_job.chunk_id_right_begin];
+        if (track_right_matches) {
+          right_matches.resize(segment_right->size());
+        }
+
+        JoinParams params{chunk_pairs_job.pos_list_left,
+                          chunk_pairs_job.pos_list_right,
+                          chunk_pairs_job.left_matches,
+                          right_matches,
+                          track_left_matches,
+                          track_right_matches,
+                          _mode,
+                          maybe_flipped_predicate_condition,
+                          secondary_predicate_evaluator,
+                          !semi_or_anti_join};
+        _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-    auto segment_left = chunk_left->get_segment(left_column_id);
+  // Merge the results of the jobs.
+  auto left_matches_by_chunk = std::vector<std::vector<bool>>(chunk_count_left);
+  if (track_left_matches) {
+    for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+      left_matches_by_chunk[chunk_id_left].resize(left_table->get_chunk(chunk_id_left)->size());
+    }
+  }
 
-    std::vector<bool> left_matches;
+  auto right_matches_by_chunk = std::vector<std::vector<bool>>(chunk_count_right);
+  if (track_right_matches) {
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
+      right_matches_by_chunk[chunk_id_right].resize(right_table->get_chunk(chunk_id_right)->size());
+    }
+  }
 
-    if (track_left_matches) {
-      left_matches.resize(segment_left->size());
+  const auto merge_matches = [](std::vector<bool>& matches, const std::vector<bool>& job_matches) {
+    const auto match_count = job_matches.size();
+    for (auto offset = size_t{0}; offset < match_count; ++offset) {
+      if (job_matches[offset]) {
+        matches[offset] = true;
+      }
     }
+  };
 
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-      const auto chunk_right = right_table->get_chunk(chunk_id_right);
-      Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  auto match_count = size_t{0};
+  for (const auto& chunk_pairs_job : chunk_pairs_jobs) {
+    match_count += chunk_pairs_job.pos_list_left.size();
+  }
+  pos_list_left->reserve(match_count);
+  pos_list_right->reserve(match_count);
 
-      const auto segment_right = chunk_right->get_segment(right_column_id);
-
-      JoinParams params{*pos_list_left,
-                        *pos_list_right,
-                        left_matches,
-                        right_matches_by_chunk[chunk_id_right],
-                        track_left_matches,
-                        track_right_matches,
-                        _mode,
-                        maybe_flipped_predicate_condition,
-                        secondary_predicate_evaluator,
-                        !semi_or_anti_join};
-      _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+  for (const auto& chunk_pairs_job : chunk_pairs_jobs) {
+    pos_list_left->insert(pos_list_left->end(), chunk_pairs_job.pos_list_left.cbegin(),
+                          chunk_pairs_job.pos_list_left.cend());
+    pos_list_right->insert(pos_list_right->end(), chunk_pairs_job.pos_list_right.cbegin(),
+                           chunk_pairs_job.pos_list_right.cend());
+
+    if (track_left_matches) {
+      merge_matches(left_matches_by_chunk[chunk_pairs_job.chunk_id_left], chunk_pairs_job.left_matches);
     }
 
-    if (is_outer_join) {
-      // Add unmatched rows on the left for Left and Full Outer joins
-      for (ChunkOffset chunk_offset{0}; chunk_offset < static_cast<ChunkOffset>(left_matches.size()); ++chunk_offset) {
+    if (track_right_matches) {
+      for (auto chunk_id_right = chunk_pairs_job.chunk_id_right_begin;
+           chunk_id_right < chunk_pairs_job.chunk_id_right_end; ++chunk_id_right) {
+        merge_matches(right_matches_by_chunk[chunk_id_right],
+                      chunk_pairs_job.right_matches[chunk_id_right - chunk_pairs_job.chunk_id_right_begin]);
+      }
+    }
+  }
+
+  if (is_outer_join) {
+    // Add unmatched rows on the left for Left and Full Outer joins
+    for (auto chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+      const auto& left_matches = left_matches_by_chunk[chunk_id_left];
+      const auto chunk_size = static_cast<ChunkOffset>(left_matches.size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
         if (!left_matches[chunk_offset]) {
           pos_list_left->emplace_back(RowID{chunk_id_left, chunk_offset});
           pos_list_right->emplace_back(NULL_ROW_ID);
         }
       }
     }
-
-    left_matches_by_chunk[chunk_id_left] = std::move(left_matches);
   }
 
   // For Full Outer we need to add all unmatched rows for the right side.
-  // Unmatched rows on the left side are already added in the main loop above
+  // Unmatched rows on the left side are already added above
   if (_mode == JoinMode::FullOuter) {
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
       const auto chunk_right = right_table->get_chunk(chunk_id_right);
@@ -259,9 +420,10 @@ void JoinNestedLoop::_join_two_untyped_segments(const AbstractSegment& abstract_
                                                 const ChunkID chunk_id_left, const ChunkID chunk_id_right,
                                                 JoinNestedLoop::JoinParams& params) {
   /**
-   * This function dispatches `join_two_typed_segments()`.
+   * This function dispatches `join_two_materialized_segments()` and `join_two_typed_segments()`.
    *
-   * To reduce compile time, we erase the types of Segments and the PredicateCondition/comparator if
+   * Arithmetic segments of the same data type take the "BLOCK PATH" (see below).
+   * Otherwise, to reduce compile time, we erase the types of Segments and the PredicateCondition/comparator if
    * `abstract_segment_left.data_type() != abstract_segment_left.data_type()` or `LeftSegmentType != RightSegmentType`. This is
    * the "SLOW PATH".
    * If data types and segment types are the same, we take the "FAST PATH", where only the SegmentType of left segment
@@ -271,6 +433,36 @@ void JoinNestedLoop::_join_two_untyped_segments(const AbstractSegment& abstract_
    * of the JoinNestedLoop reasonably low.
    */
 
+  /**
+   * BLOCK PATH
+   * For arithmetic columns of the same data type, both segments are materialized into typed arrays and compared
+   * block-wise (see join_two_materialized_segments()). AntiNullAsTrue joins need to see NULL values and take the paths
+   * below.
+   */
+  if (abstract_segment_left.data_type() == abstract_segment_right.data_type() &&
+      params.mode != JoinMode::AntiNullAsTrue) {
+    auto block_path_taken = false;
+
+    resolve_data_type(abstract_segment_left.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        const auto left = materialize_non_null_values<ColumnDataType>(abstract_segment_left);
+        const auto right = materialize_non_null_values<ColumnDataType>(abstract_segment_right);
+
+        with_comparator(params.predicate_condition, [&](auto comparator) {
+          join_two_materialized_segments(comparator, left, right, chunk_id_left, chunk_id_right, params);
+        });
+
+        block_path_taken = true;
+      }
+    });
+
+    if (block_path_taken) {
+      return;
+    }
+  }
+
   /**
    * FAST PATH
    */
@@ -41,6 +41,10 @@ class JoinNestedLoop : public AbstractJoinOperator {
     bool write_pos_lists{};
   };
 
+  // Minimum number of value comparisons (i.e., the product of the left and the right chunk sizes) of a job. The left
+  // chunk of a job is joined with as many right chunks as needed to reach this number.
+  static constexpr auto MIN_COMPARISONS_PER_JOB = size_t{100'000};
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
@@ -0,0 +1,124 @@
+#include "key_index_lookup.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "storage/index/key_hash/key_hash_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+KeyIndexLookup::KeyIndexLookup(const std::string& table_name, const std::vector<ColumnID>& pruned_column_ids,
+                               const std::vector<ColumnID>& key_column_ids,
+                               const std::vector<std::shared_ptr<AbstractExpression>>& key_values)
+    : AbstractReadOnlyOperator(OperatorType::KeyIndexLookup),
+      _table_name(table_name),
+      _pruned_column_ids(pruned_column_ids),
+      _key_column_ids(key_column_ids),
+      _key_values(key_values) {
+  DebugAssert(std::is_sorted(_pruned_column_ids.begin(), _pruned_column_ids.end()),
+              "Expected sorted vector of ColumnIDs");
+  Assert(_key_column_ids.size() == _key_values.size(), "Expected one value per key column.");
+}
+
+const std::string& KeyIndexLookup::name() const {
+  static const auto name = std::string{"KeyIndexLookup"};
+  return name;
+}
+
+std::string KeyIndexLookup::description(DescriptionMode description_mode) const {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+  auto stream = std::stringstream{};
+
+  stream << AbstractOperator::description(description_mode) << separator;
+  stream << "(" << _table_name << ")";
+
+  const auto key_column_count = _key_column_ids.size();
+  for (auto key_column_index = size_t{0}; key_column_index < key_column_count; ++key_column_index) {
+    stream << separator << stored_table->column_name(_key_column_ids[key_column_index]) << " = "
+           << _key_values[key_column_index]->description(AbstractExpression::DescriptionMode::ColumnName);
+  }
+
+  return stream.str();
+}
+
+const std::string& KeyIndexLookup::table_name() const {
+  return _table_name;
+}
+
+const std::vector<ColumnID>& KeyIndexLookup::key_column_ids() const {
+  return _key_column_ids;
+}
+
+std::shared_ptr<const Table> KeyIndexLookup::_on_execute() {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_table_name);
+
+  // Find the index on the key columns and order the values like the index's columns.
+  auto sorted_key_column_ids = _key_column_ids;
+  std::sort(sorted_key_column_ids.begin(), sorted_key_column_ids.end());
+
+  auto key_hash_index = std::shared_ptr<KeyHashIndex>{};
+  for (const auto& candidate_index : stored_table->key_hash_indexes()) {
+    if (candidate_index->column_ids() == sorted_key_column_ids) {
+      key_hash_index = candidate_index;
+      break;
+    }
+  }
+  Assert(key_hash_index, "No KeyHashIndex found for the key columns of table '" + _table_name + "'.");
+
+  auto key_values = std::vector<AllTypeVariant>{};
+  key_values.reserve(_key_values.size());
+  for (const auto column_id : key_hash_index->column_ids()) {
+    const auto key_column_iter = std::find(_key_column_ids.cbegin(), _key_column_ids.cend(), column_id);
+    const auto key_column_index = static_cast<size_t>(std::distance(_key_column_ids.cbegin(), key_column_iter));
+    const auto value = expression_get_value_or_parameter(*_key_values[key_column_index]);
+    Assert(value, "Expected ValueExpression or CorrelatedParameterExpression as key value.");
+    key_values.emplace_back(*value);
+  }
+
+  const auto pos_list = std::make_shared<RowIDPosList>(key_hash_index->lookup(*stored_table, key_values));
+
+  // Build the output columns like GetTable does, omitting pruned columns.
+  auto column_definitions = TableColumnDefinitions{};
+  auto segments = Segments{};
+  auto pruned_column_ids_iter = _pruned_column_ids.begin();
+  const auto column_count = stored_table->column_count();
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < column_count; ++stored_column_id) {
+    if (pruned_column_ids_iter != _pruned_column_ids.end() && stored_column_id == *pruned_column_ids_iter) {
+      ++pruned_column_ids_iter;
+      continue;
+    }
+
+    column_definitions.emplace_back(stored_table->column_definitions()[stored_column_id]);
+    segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_id, pos_list));
+  }
+
+  const auto output_table = std::make_shared<Table>(column_definitions, TableType::References);
+  if (!pos_list->empty()) {
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> KeyIndexLookup::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<KeyIndexLookup>(_table_name, _pruned_column_ids, _key_column_ids,
+                                          expressions_deep_copy(_key_values, copied_ops));
+}
+
+void KeyIndexLookup::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expressions_set_parameters(_key_values, parameters);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractExpression;
+
+/**
+ * Operator that finds the rows of a stored table whose key columns equal the given values using the table's
+ * KeyHashIndex (see Table::create_key_hash_index). It is used instead of GetTable and TableScans for point lookups on
+ * keys (see IndexScanRule). The output references the stored table and holds the columns that a GetTable with the
+ * same pruned columns would output.
+ *
+ * As the index covers all rows, the output also contains rows that are not visible to the current transaction. Their
+ * visibility is resolved by a Validate on top of the lookup, just as for GetTable.
+ */
+class KeyIndexLookup : public AbstractReadOnlyOperator {
+ public:
+  // `key_column_ids` are ColumnIDs of the stored table and have to match the columns of one of its KeyHashIndexes.
+  // `key_values` are ValueExpressions or CorrelatedParameterExpressions.
+  KeyIndexLookup(const std::string& table_name, const std::vector<ColumnID>& pruned_column_ids,
+                 const std::vector<ColumnID>& key_column_ids,
+                 const std::vector<std::shared_ptr<AbstractExpression>>& key_values);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::string& table_name() const;
+  const std::vector<ColumnID>& key_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::string _table_name;
+  const std::vector<ColumnID> _pruned_column_ids;
+  const std::vector<ColumnID> _key_column_ids;
+  const std::vector<std::shared_ptr<AbstractExpression>> _key_values;
+};
+
+}  // namespace hyrise
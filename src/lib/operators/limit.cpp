@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/value_expression.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 
@@ -26,6 +28,26 @@ std::shared_ptr<AbstractExpression> Limit::row_count_expression() const {
   return _row_count_expression;
 }
 
+std::optional<size_t> Limit::constant_row_count() const {
+  const auto value_expression = std::dynamic_pointer_cast<const ValueExpression>(_row_count_expression);
+  if (!value_expression || variant_is_null(value_expression->value)) {
+    return std::nullopt;
+  }
+
+  auto row_count = std::optional<size_t>{};
+  boost::apply_visitor(
+      [&](const auto& value) {
+        using ValueType = std::decay_t<decltype(value)>;
+        if constexpr (std::is_integral_v<ValueType>) {
+          if (value >= 0) {
+            row_count = static_cast<size_t>(value);
+          }
+        }
+      },
+      value_expression->value);
+  return row_count;
+}
+
 std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
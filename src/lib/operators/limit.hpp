@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -18,6 +19,10 @@ class Limit : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractExpression> row_count_expression() const;
 
+  // The number of rows if the row count expression is a value, std::nullopt if it has to be evaluated at execution.
+  // Used to push the limit down to the input operators (see AbstractOperator::set_row_limit).
+  std::optional<size_t> constant_row_count() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
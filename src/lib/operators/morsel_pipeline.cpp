@@ -0,0 +1,291 @@
+#include "morsel_pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/operator_row_limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+using CopiedOperators = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>;
+
+bool contains_subquery(const std::shared_ptr<AbstractExpression>& expression) {
+  auto subquery_found = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) {
+      subquery_found = true;
+      return ExpressionVisitation::DoNotVisitArguments;
+    }
+    return ExpressionVisitation::VisitArguments;
+  });
+  return subquery_found;
+}
+
+// Creates a reference table with a single chunk that holds the rows of the given chunk of `input_table`.
+std::shared_ptr<const Table> create_morsel_table(const std::shared_ptr<const Table>& input_table,
+                                                 const ChunkID chunk_id, const std::shared_ptr<const Chunk>& chunk) {
+  const auto column_count = input_table->column_count();
+  auto segments = Segments{};
+  segments.reserve(column_count);
+
+  if (input_table->type() == TableType::References) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(chunk->get_segment(column_id));
+    }
+  } else {
+    const auto pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk->size());
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+  }
+
+  auto morsel_chunk = std::make_shared<Chunk>(std::move(segments));
+  morsel_chunk->finalize();
+  if (!chunk->individually_sorted_by().empty()) {
+    morsel_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+  }
+
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References,
+                                 std::vector<std::shared_ptr<Chunk>>{morsel_chunk});
+}
+
+void create_pipelines_recursively(const std::shared_ptr<const AbstractOperator>& op, CopiedOperators& copied_ops,
+                                  std::unordered_set<const AbstractOperator*>& visited_ops) {
+  if (!op || !visited_ops.emplace(op.get()).second) {
+    return;
+  }
+
+  for (const auto& subquery : op->uncorrelated_subqueries()) {
+    create_pipelines_recursively(subquery, copied_ops, visited_ops);
+  }
+
+  // Collect the chain of pipelineable operators that ends with `op`. The operators below `op` must not have other
+  // consumers, as their results are no longer materialized.
+  auto chain = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  auto current_op = op;
+  while (current_op->left_input() && MorselPipeline::is_pipelineable(*current_op) &&
+         (chain.empty() || current_op->consumer_count() == 1)) {
+    chain.emplace_back(current_op);
+    current_op = current_op->left_input();
+  }
+
+  if (chain.size() < 2) {
+    create_pipelines_recursively(op->left_input(), copied_ops, visited_ops);
+    create_pipelines_recursively(op->right_input(), copied_ops, visited_ops);
+    return;
+  }
+
+  // Replace pipelines below the chain first, so that the copied input of the MorselPipeline contains them.
+  create_pipelines_recursively(current_op, copied_ops, visited_ops);
+  const auto copied_input = current_op->deep_copy(copied_ops);
+
+  std::reverse(chain.begin(), chain.end());
+  copied_ops.emplace(op.get(), std::make_shared<MorselPipeline>(copied_input, chain));
+}
+
+}  // namespace
+
+namespace hyrise {
+
+MorselPipeline::MorselPipeline(const std::shared_ptr<const AbstractOperator>& input_operator,
+                               const std::vector<std::shared_ptr<const AbstractOperator>>& operators)
+    : AbstractReadOnlyOperator(OperatorType::MorselPipeline, input_operator),
+      _placeholder(std::make_shared<TableWrapper>(
+          std::make_shared<Table>(TableColumnDefinitions{}, TableType::References))) {
+  Assert(!operators.empty(), "MorselPipeline requires at least one operator.");
+
+  // Copy the operators so that each reads from the copy of its predecessor and the first one from the placeholder.
+  auto previous_op = _placeholder;
+  _operators.reserve(operators.size());
+  for (const auto& op : operators) {
+    Assert(is_pipelineable(*op), "Operator " + op->name() + " cannot be part of a MorselPipeline.");
+    auto copied_ops = CopiedOperators{{op->left_input().get(), previous_op}};
+    previous_op = op->deep_copy(copied_ops);
+    _operators.emplace_back(previous_op);
+  }
+}
+
+const std::string& MorselPipeline::name() const {
+  static const auto name = std::string{"MorselPipeline"};
+  return name;
+}
+
+std::string MorselPipeline::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  auto stream = std::stringstream{};
+  stream << AbstractOperator::description(description_mode) << separator;
+  for (auto op_idx = size_t{0}; op_idx < _operators.size(); ++op_idx) {
+    stream << (op_idx > 0 ? " -> " : "") << _operators[op_idx]->name();
+  }
+
+  return stream.str();
+}
+
+bool MorselPipeline::is_pipelineable(const AbstractOperator& op) {
+  switch (op.type()) {
+    case OperatorType::TableScan: {
+      // The excluded ChunkIDs refer to the chunks of the entire input, not to those of a morsel. TableScans with a
+      // runtime filter have a second input, which is not part of the pipeline.
+      const auto& table_scan = static_cast<const TableScan&>(op);
+      return table_scan.excluded_chunk_ids.empty() && !contains_subquery(table_scan.predicate()) &&
+             !table_scan.runtime_filter_column_ids();
+    }
+
+    case OperatorType::Projection: {
+      const auto& projection = static_cast<const Projection&>(op);
+      return std::none_of(projection.expressions.begin(), projection.expressions.end(), contains_subquery);
+    }
+
+    case OperatorType::Validate:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+std::shared_ptr<AbstractOperator> MorselPipeline::create_pipelines(
+    const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto copied_ops = CopiedOperators{};
+  auto visited_ops = std::unordered_set<const AbstractOperator*>{};
+  create_pipelines_recursively(pqp, copied_ops, visited_ops);
+  return pqp->deep_copy(copied_ops);
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& MorselPipeline::operators() const {
+  return _operators;
+}
+
+std::shared_ptr<const Table> MorselPipeline::_on_execute() {
+  const auto input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto morsel_outputs = std::vector<std::shared_ptr<const Table>>(chunk_count);
+  auto row_limit = OperatorRowLimit{_row_limit, chunk_count};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    if (chunk->size() == 0) {
+      row_limit.add_chunk(chunk_id, 0);
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, chunk]() {
+      if (row_limit.is_cancelled(chunk_id)) {
+        return;
+      }
+
+      auto morsel_output = _execute_morsel(create_morsel_table(input_table, chunk_id, chunk));
+      row_limit.add_chunk(chunk_id, morsel_output->row_count());
+      morsel_outputs[chunk_id] = std::move(morsel_output);
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // Drop the outputs of morsels that were executed before they were cancelled.
+  morsel_outputs.resize(row_limit.end_chunk_id());
+
+  // The output schema is taken from the first morsel. If there is none, we execute the operators on an empty table.
+  const auto first_output_iter =
+      std::find_if(morsel_outputs.begin(), morsel_outputs.end(), [](const auto& output) { return output; });
+  const auto first_output =
+      first_output_iter != morsel_outputs.end()
+          ? *first_output_iter
+          : _execute_morsel(std::make_shared<Table>(input_table->column_definitions(), TableType::References));
+
+  // Projections determine the nullability of new columns from the values of each morsel.
+  auto output_column_definitions = first_output->column_definitions();
+  const auto column_count = first_output->column_count();
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(chunk_count);
+
+  for (const auto& morsel_output : morsel_outputs) {
+    if (!morsel_output) {
+      continue;
+    }
+    DebugAssert(morsel_output->type() == first_output->type(), "Morsels produced different table types.");
+
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_column_definitions[column_id].nullable |= morsel_output->column_is_nullable(column_id);
+    }
+
+    const auto morsel_chunk_count = morsel_output->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < morsel_chunk_count; ++chunk_id) {
+      const auto chunk = morsel_output->get_chunk(chunk_id);
+
+      auto segments = Segments{};
+      segments.reserve(column_count);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+
+      const auto& output_chunk = output_chunks.emplace_back(std::make_shared<Chunk>(std::move(segments)));
+      output_chunk->finalize();
+      if (!chunk->individually_sorted_by().empty()) {
+        output_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+      }
+    }
+  }
+
+  return std::make_shared<Table>(output_column_definitions, first_output->type(), std::move(output_chunks));
+}
+
+std::shared_ptr<const Table> MorselPipeline::_execute_morsel(const std::shared_ptr<const Table>& morsel_table) const {
+  const auto table_wrapper = std::make_shared<TableWrapper>(morsel_table);
+  auto copied_ops = CopiedOperators{{_placeholder.get(), table_wrapper}};
+  const auto root_op = _operators.back()->deep_copy(copied_ops);
+
+  // The copied operators register as consumers of their inputs, so intermediate results are released as soon as the
+  // next operator has executed.
+  table_wrapper->execute();
+  for (const auto& op : _operators) {
+    copied_ops.at(op.get())->execute();
+  }
+
+  return root_op->get_output();
+}
+
+std::shared_ptr<AbstractOperator> MorselPipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
+  return std::make_shared<MorselPipeline>(
+      copied_left_input, std::vector<std::shared_ptr<const AbstractOperator>>(_operators.begin(), _operators.end()));
+}
+
+void MorselPipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  // Also sets the parameters of the operators below (i.e., of the other templates and the placeholder).
+  _operators.back()->set_parameters(parameters);
+}
+
+void MorselPipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  _operators.back()->set_transaction_context_recursively(transaction_context);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+/**
+ * Executes a chain of non-blocking operators (TableScan, Validate, Projection) morsel by morsel. Usually, each of
+ * these operators processes all chunks of its input before the next operator starts, so that every operator of the
+ * chain writes a complete intermediate table. A MorselPipeline instead runs the entire chain for a single chunk (the
+ * morsel) of its input in one job. The intermediate results of a morsel are small and are consumed by the next operator
+ * while they are still in the cache. The jobs for the morsels are executed in parallel by the scheduler.
+ *
+ * For each morsel, the operators are copied from the given templates, with their input replaced by a table holding
+ * only that chunk. Chunks of data tables are wrapped in ReferenceSegments with an EntireChunkPosList, so that the
+ * output references the input table just as it would without pipelining. The output chunks are in the order of the
+ * input chunks.
+ *
+ * Pipelines are created by create_pipelines() for queries that request pipelined execution (see SQLPipelineBuilder).
+ * Blocking operators (e.g., joins and aggregates) consume the output of a MorselPipeline like that of any other
+ * operator.
+ */
+class MorselPipeline : public AbstractReadOnlyOperator {
+ public:
+  // `operators` are ordered bottom-up, i.e., the first operator reads the morsels of `input_operator`. Only their
+  // configuration is used, the operators themselves are neither modified nor executed.
+  MorselPipeline(const std::shared_ptr<const AbstractOperator>& input_operator,
+                 const std::vector<std::shared_ptr<const AbstractOperator>>& operators);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  // Whether `op` can be part of a MorselPipeline. Operators with subqueries are excluded, as these would be executed
+  // once per morsel.
+  static bool is_pipelineable(const AbstractOperator& op);
+
+  /**
+   * Returns a copy of `pqp` in which each chain of at least two pipelineable operators is replaced by a MorselPipeline.
+   * All operators of a chain except for the topmost one must have a single consumer.
+   */
+  static std::shared_ptr<AbstractOperator> create_pipelines(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  // The templates of the pipelined operators, bottom-up
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Copies the operators, replacing the placeholder with a TableWrapper for `morsel_table`, and executes them.
+  std::shared_ptr<const Table> _execute_morsel(const std::shared_ptr<const Table>& morsel_table) const;
+
+  // Input of the first template operator. It is never executed.
+  std::shared_ptr<AbstractOperator> _placeholder;
+
+  std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace hyrise
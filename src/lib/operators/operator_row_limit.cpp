@@ -0,0 +1,66 @@
+#include "operator_row_limit.hpp"
+
+#include <mutex>
+#include <optional>
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+OperatorRowLimit::OperatorRowLimit(const std::optional<size_t>& row_limit, const ChunkID chunk_count)
+    : _row_limit(row_limit),
+      _end_chunk_id(row_limit == size_t{0} ? ChunkID{0} : chunk_count),
+      _output_row_counts(row_limit ? static_cast<size_t>(chunk_count) : size_t{0}) {}
+
+bool OperatorRowLimit::is_cancelled(const ChunkID chunk_id) const {
+  return chunk_id >= _end_chunk_id.load();
+}
+
+void OperatorRowLimit::add_chunk(const ChunkID chunk_id, const size_t output_row_count) {
+  if (!_row_limit) {
+    return;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  DebugAssert(!_output_row_counts[chunk_id], "Chunk was added twice.");
+  _output_row_counts[chunk_id] = output_row_count;
+
+  // Extend the prefix of completed chunks. Once it holds enough rows, all chunks after it are cancelled.
+  const auto end_chunk_id = ChunkID{_end_chunk_id.load()};
+  while (_completed_prefix_end < end_chunk_id && _output_row_counts[_completed_prefix_end]) {
+    _completed_prefix_row_count += *_output_row_counts[_completed_prefix_end];
+    ++_completed_prefix_end;
+
+    if (_completed_prefix_row_count >= *_row_limit) {
+      _end_chunk_id = _completed_prefix_end;
+      break;
+    }
+  }
+}
+
+ChunkID OperatorRowLimit::end_chunk_id() const {
+  return ChunkID{_end_chunk_id.load()};
+}
+
+ChunkID OperatorRowLimit::prefix_chunk_count(const Table& table, const std::optional<size_t>& row_limit) {
+  const auto chunk_count = table.chunk_count();
+  if (!row_limit) {
+    return chunk_count;
+  }
+
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (row_count >= *row_limit) {
+      return chunk_id;
+    }
+
+    const auto chunk = table.get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    row_count += chunk->size();
+  }
+
+  return chunk_count;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+/**
+ * Used by operators that process their input chunks in parallel jobs to implement the row limit hint (see
+ * AbstractOperator::set_row_limit). The jobs report the number of output rows of each processed chunk. As soon as the
+ * chunks up to some ChunkID (i.e., a prefix of the output) hold enough rows, all later chunks are cancelled: Jobs
+ * check is_cancelled() before processing a chunk and the operators drop the results of cancelled chunks.
+ *
+ * Without a row limit, no chunk is ever cancelled.
+ */
+class OperatorRowLimit {
+ public:
+  OperatorRowLimit(const std::optional<size_t>& row_limit, const ChunkID chunk_count);
+
+  bool is_cancelled(const ChunkID chunk_id) const;
+
+  // Has to be called for every chunk that is not cancelled, including those that are skipped or yield no rows.
+  void add_chunk(const ChunkID chunk_id, const size_t output_row_count);
+
+  // The ChunkID of the first cancelled chunk, or the chunk count if no chunk is cancelled.
+  ChunkID end_chunk_id() const;
+
+  // The number of leading chunks of `table` that hold at least `row_limit` rows, used by operators that produce one
+  // output row per input row.
+  static ChunkID prefix_chunk_count(const Table& table, const std::optional<size_t>& row_limit);
+
+ private:
+  const std::optional<size_t> _row_limit;
+
+  std::atomic<ChunkID::base_type> _end_chunk_id;
+
+  std::mutex _mutex;
+  std::vector<std::optional<size_t>> _output_row_counts;
+  ChunkID _completed_prefix_end{0};
+  size_t _completed_prefix_row_count{0};
+};
+
+}  // namespace hyrise
@@ -5,15 +5,18 @@
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/evaluation/expression_program.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
+#include "operators/operator_row_limit.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
@@ -94,7 +97,10 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     return expression->type == ExpressionType::PQPColumn;
   });
   const auto output_table_type = forwards_any_columns ? input_table.type() : TableType::Data;
-  const auto chunk_count = input_table.chunk_count();
+
+  // With a row limit (see AbstractOperator::set_row_limit), only the leading chunks that hold enough rows are
+  // projected.
+  const auto chunk_count = OperatorRowLimit::prefix_chunk_count(input_table, _row_limit);
 
   // Perform the actual projection on a per-chunk level. `output_segments_by_chunk` will contain both forwarded and
   // newly generated columns. In the upcoming loop, we do not yet deal with the projection_result_table indirection
@@ -107,6 +113,15 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   const auto expression_count = expressions.size();
   const auto forwarded_pqp_columns = _determine_forwarded_columns(output_table_type);
 
+  // Newly generated columns are evaluated by an ExpressionProgram if it supports the expression, and by the
+  // ExpressionEvaluator otherwise. Programs are compiled once and used for all chunks.
+  auto expression_programs = std::vector<std::shared_ptr<const ExpressionProgram>>(expression_count);
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    if (!forwarded_pqp_columns.contains(expressions[column_id])) {
+      expression_programs[column_id] = ExpressionProgram::compile(expressions[column_id], input_table);
+    }
+  }
+
   // NULLability information is either forwarded or collected during the execution of the ExpressionEvaluator. The
   // vector stores atomic bool values. This allows parallel write operation per thread.
   auto column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
@@ -148,16 +163,25 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
 
     // Defines the job that performs the evaluation if the columns are newly generated.
-    auto perform_projection_evaluation = [this, chunk_id, expression_count, &output_segments_by_chunk,
-                                          &column_is_nullable, &forwarded_pqp_columns]() {
-      auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id};
+    auto perform_projection_evaluation = [this, chunk_id, expression_count, input_chunk, &output_segments_by_chunk,
+                                          &column_is_nullable, &forwarded_pqp_columns, &expression_programs]() {
+      // Only created if an expression is not supported by ExpressionProgram
+      auto evaluator = std::optional<ExpressionEvaluator>{};
 
       for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
         const auto& expression = expressions[column_id];
 
         if (!forwarded_pqp_columns.contains(expression)) {
           // Newly generated column - the expression needs to be evaluated
-          auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
+          auto output_segment = std::shared_ptr<BaseValueSegment>{};
+          if (expression_programs[column_id]) {
+            output_segment = expression_programs[column_id]->evaluate_to_segment(*input_chunk);
+          } else {
+            if (!evaluator) {
+              evaluator.emplace(left_input_table(), chunk_id);
+            }
+            output_segment = evaluator->evaluate_expression_to_segment(*expression);
+          }
           column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
           // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
           // both ReferenceSegments and ValueSegments. We deal with this later.
@@ -171,6 +195,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (input_chunk->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_projection_evaluation);
+      job_task->set_preferred_node_id(input_chunk->numa_node_id().value_or(CURRENT_NODE_ID));
       jobs.push_back(job_task);
     } else {
       perform_projection_evaluation();
@@ -2,7 +2,6 @@
 
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -21,6 +20,7 @@
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "lossless_cast.hpp"
+#include "operators/operator_row_limit.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -50,10 +50,26 @@ TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& input_operat
   _search_and_register_uncorrelated_subqueries(predicate);
 }
 
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& input_operator,
+                     const std::shared_ptr<AbstractExpression>& predicate,
+                     const std::shared_ptr<const AbstractOperator>& runtime_filter_input,
+                     const ColumnIDPair& runtime_filter_column_ids)
+    : AbstractReadOnlyOperator{OperatorType::TableScan, input_operator, runtime_filter_input,
+                               std::make_unique<PerformanceData>()},
+      _predicate(predicate),
+      _runtime_filter_column_ids(runtime_filter_column_ids) {
+  Assert(runtime_filter_input, "Runtime filter requires an input.");
+  _search_and_register_uncorrelated_subqueries(predicate);
+}
+
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const {
   return _predicate;
 }
 
+const std::optional<ColumnIDPair>& TableScan::runtime_filter_column_ids() const {
+  return _runtime_filter_column_ids;
+}
+
 const std::string& TableScan::name() const {
   static const auto name = std::string{"TableScan"};
   return name;
@@ -67,6 +83,10 @@ std::string TableScan::description(DescriptionMode description_mode) const {
   stream << AbstractOperator::description(description_mode) << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  if (_runtime_filter_column_ids) {
+    stream << separator << "Runtime filter: Column #" << _runtime_filter_column_ids->first << " in Column #"
+           << _runtime_filter_column_ids->second << " of right input";
+  }
 
   return stream.str();
 }
@@ -81,8 +101,12 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
-    const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  if (_runtime_filter_column_ids) {
+    return std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy(copied_ops), copied_right_input,
+                                       *_runtime_filter_column_ids);
+  }
   return std::make_shared<TableScan>(copied_left_input, _predicate->deep_copy(copied_ops));
 }
 
@@ -92,28 +116,67 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   _impl = create_impl();
   _impl_description = _impl->description();
 
-  auto output_mutex = std::mutex{};
+  auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+
+  // The runtime filter is built from the complete result of the right input. The scheduler only runs the TableScan
+  // once the right input has been executed (it is a regular input in the PQP). Thus, the scan never waits for the
+  // filter to be published.
+  if (_runtime_filter_column_ids) {
+    _runtime_filter = std::make_unique<RuntimeFilter>(*right_input_table(), _runtime_filter_column_ids->second);
+    DebugAssert(_runtime_filter->data_type() == in_table->column_data_type(_runtime_filter_column_ids->first),
+                "Runtime filter requires columns of the same data type.");
+    scan_performance_data.has_runtime_filter = true;
+  }
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  // The output chunks are stored by the ID of their input chunk, so that the output is in the order of the input. This
+  // is required for the row limit, which cancels the chunks after the first ones holding enough matches.
+  const auto chunk_count = in_table->chunk_count();
+  auto output_chunks_by_input_chunk = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto row_limit = OperatorRowLimit{_row_limit, chunk_count};
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  jobs.reserve(chunk_count - excluded_chunk_set.size());
 
-  const auto chunk_count = in_table->chunk_count();
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (row_limit.is_cancelled(chunk_id)) {
+      // The chunks scanned so far already hold enough matches. As the jobs are only scheduled after this loop, this
+      // check only applies to chunks that were scanned inline (see JOB_SPAWN_THRESHOLD). Jobs of cancelled chunks
+      // return right away instead.
+      break;
+    }
+
     if (excluded_chunk_set.contains(chunk_id)) {
+      row_limit.add_chunk(chunk_id, 0);
       continue;
     }
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_chunks_by_input_chunk, &row_limit,
+                               &scan_performance_data]() {
+      if (row_limit.is_cancelled(chunk_id)) {
+        return;
+      }
+
+      if (_runtime_filter && _runtime_filter->can_prune(*chunk_in, _runtime_filter_column_ids->first)) {
+        ++scan_performance_data.num_chunks_pruned_by_runtime_filter;
+        row_limit.add_chunk(chunk_id, 0);
+        return;
+      }
+
       // The actual scan happens in the sub classes of BaseTableScanImpl
       const auto matches_out = _impl->scan_chunk(chunk_id);
+
+      if (_runtime_filter && !matches_out->empty()) {
+        const auto match_count = matches_out->size();
+        _runtime_filter->filter(*chunk_in, _runtime_filter_column_ids->first, matches_out);
+        scan_performance_data.num_rows_filtered_by_runtime_filter += match_count - matches_out->size();
+      }
+
+      row_limit.add_chunk(chunk_id, matches_out->size());
       if (matches_out->empty()) {
         return;
       }
@@ -197,17 +260,20 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
       const auto chunk = std::make_shared<Chunk>(out_segments, nullptr, chunk_in->get_allocator());
       chunk->finalize();
+      if (const auto numa_node_id = chunk_in->numa_node_id()) {
+        chunk->set_numa_node_id(*numa_node_id);
+      }
       if (keep_chunk_sort_order && !chunk_in->individually_sorted_by().empty()) {
         chunk->set_individually_sorted_by(chunk_in->individually_sorted_by());
       }
-      const auto lock = std::lock_guard<std::mutex>{output_mutex};
-      output_chunks.emplace_back(chunk);
+      output_chunks_by_input_chunk[chunk_id] = chunk;
     };
     // Spawn job when chunk sufficiently large. The upper bound of the chunk size, still needs to be re-evaluated over
     // time to find the value which gives the best performance.
     constexpr auto JOB_SPAWN_THRESHOLD = ChunkOffset{500};
     if (chunk_in->size() >= JOB_SPAWN_THRESHOLD) {
       auto job_task = std::make_shared<JobTask>(perform_table_scan);
+      job_task->set_preferred_node_id(chunk_in->numa_node_id().value_or(CURRENT_NODE_ID));
       jobs.push_back(job_task);
     } else {
       perform_table_scan();
@@ -216,7 +282,16 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-  auto& scan_performance_data = dynamic_cast<PerformanceData&>(*performance_data);
+  // Drop the results of chunks that were scanned before they were cancelled.
+  output_chunks_by_input_chunk.resize(row_limit.end_chunk_id());
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(output_chunks_by_input_chunk.size());
+  for (auto& chunk : output_chunks_by_input_chunk) {
+    if (chunk) {
+      output_chunks.emplace_back(std::move(chunk));
+    }
+  }
+
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
@@ -458,6 +533,7 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() {
 
 void TableScan::_on_cleanup() {
   _impl.reset();
+  _runtime_filter.reset();
 }
 
 }  // namespace hyrise
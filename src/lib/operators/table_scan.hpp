@@ -9,6 +9,7 @@
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
+#include "table_scan/runtime_filter.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -24,8 +25,21 @@ class TableScan : public AbstractReadOnlyOperator {
   TableScan(const std::shared_ptr<const AbstractOperator>& input_operator,
             const std::shared_ptr<AbstractExpression>& predicate);
 
+  /**
+   * Creates a TableScan that additionally applies a RuntimeFilter to the rows matching the predicate. The filter is
+   * built from the values of column `runtime_filter_column_ids.second` in the result of `runtime_filter_input`, which
+   * becomes the right input of the TableScan. It is applied to column `runtime_filter_column_ids.first` of the input
+   * table. As the filter is not exact, this is only used for semi join reductions (see SemiJoinReductionRule).
+   */
+  TableScan(const std::shared_ptr<const AbstractOperator>& input_operator,
+            const std::shared_ptr<AbstractExpression>& predicate,
+            const std::shared_ptr<const AbstractOperator>& runtime_filter_input,
+            const ColumnIDPair& runtime_filter_column_ids);
+
   const std::shared_ptr<AbstractExpression>& predicate() const;
 
+  const std::optional<ColumnIDPair>& runtime_filter_column_ids() const;
+
   const std::string& name() const override;
   std::string description(DescriptionMode description_mode) const override;
 
@@ -57,6 +71,11 @@ class TableScan : public AbstractReadOnlyOperator {
     std::atomic_size_t num_chunks_with_all_rows_matching{0};
     std::atomic_size_t num_chunks_with_binary_search{0};
 
+    // Only set if the TableScan has a runtime filter.
+    bool has_runtime_filter{false};
+    std::atomic_size_t num_chunks_pruned_by_runtime_filter{0};
+    std::atomic_size_t num_rows_filtered_by_runtime_filter{0};
+
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
       OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
 
@@ -64,6 +83,10 @@ class TableScan : public AbstractReadOnlyOperator {
       stream << separator << "Chunks: " << num_chunks_with_early_out.load() << " skipped with no results, ";
       stream << separator << num_chunks_with_all_rows_matching.load() << " skipped with all matching, ";
       stream << num_chunks_with_binary_search.load() << " scanned using binary search.";
+      if (has_runtime_filter) {
+        stream << separator << "Runtime filter: " << num_chunks_pruned_by_runtime_filter.load() << " chunk(s) pruned, ";
+        stream << num_rows_filtered_by_runtime_filter.load() << " row(s) filtered.";
+      }
     }
   };
 
@@ -72,7 +95,7 @@ class TableScan : public AbstractReadOnlyOperator {
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
-      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
 
   void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
@@ -90,6 +113,10 @@ class TableScan : public AbstractReadOnlyOperator {
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
 
+  // The first ColumnID refers to the input table, the second one to the result of the right input.
+  const std::optional<ColumnIDPair> _runtime_filter_column_ids;
+  std::unique_ptr<RuntimeFilter> _runtime_filter;
+
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
 };
@@ -4,9 +4,9 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -121,6 +121,29 @@ std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_d
   auto& dictionary_matches = result.second;
 
   count = 0u;
+
+  if (const auto* starts_with_pattern = std::get_if<LikeMatcher::StartsWithPattern>(&_matcher.pattern_variant())) {
+    // The dictionary is sorted, so the values starting with the prefix form a contiguous range that begins at the
+    // first value not less than the prefix. Instead of testing every value, we find the range by binary search.
+    const auto prefix = std::string_view{starts_with_pattern->string};
+    const auto value_less = [](const auto& value, const std::string_view search_value) {
+      return std::string_view{value} < search_value;
+    };
+    const auto range_begin = std::lower_bound(dictionary.begin(), dictionary.end(), prefix, value_less);
+    const auto range_end = std::partition_point(range_begin, dictionary.end(), [&](const auto& value) {
+      return std::string_view{value}.starts_with(prefix);
+    });
+
+    const auto range_begin_offset = static_cast<size_t>(std::distance(dictionary.begin(), range_begin));
+    const auto range_size = static_cast<size_t>(std::distance(range_begin, range_end));
+
+    dictionary_matches.assign(dictionary.size(), _invert_results);
+    std::fill_n(dictionary_matches.begin() + static_cast<std::ptrdiff_t>(range_begin_offset), range_size,
+                !_invert_results);
+    count = _invert_results ? dictionary.size() - range_size : range_size;
+    return result;
+  }
+
   dictionary_matches.reserve(dictionary.size());
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
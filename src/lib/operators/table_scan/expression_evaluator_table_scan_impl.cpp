@@ -1,19 +1,27 @@
 #include "expression_evaluator_table_scan_impl.hpp"
 
 #include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/evaluation/expression_program.hpp"
 #include "expression/expression_utils.hpp"
 
 namespace hyrise {
 
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
     const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const AbstractExpression>& expression)
-    : _in_table(in_table), _expression(expression) {}
+    : _in_table(in_table),
+      _expression(expression),
+      _expression_program(ExpressionProgram::compile(expression, *in_table)) {}
 
 std::string ExpressionEvaluatorTableScanImpl::description() const {
   return "ExpressionEvaluator";
 }
 
 std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
+  if (_expression_program) {
+    return std::make_shared<RowIDPosList>(
+        _expression_program->evaluate_to_pos_list(*_in_table->get_chunk(chunk_id), chunk_id));
+  }
+
   return std::make_shared<RowIDPosList>(
       ExpressionEvaluator{_in_table, chunk_id}.evaluate_expression_to_pos_list(*_expression));
 }
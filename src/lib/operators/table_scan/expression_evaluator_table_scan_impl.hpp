@@ -3,6 +3,7 @@
 #include "abstract_table_scan_impl.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/evaluation/expression_program.hpp"
 
 namespace hyrise {
 
@@ -12,7 +13,8 @@ class UncorrelatedSubqueryResults;
 /**
  * Uses the ExpressionEvaluator::evaluate_expression_to_pos_list() for a fallback implementation of the
  * AbstractTableScanImpl. This is likely slower than any specialized `AbstractTableScanImpl` and should thus only be
- * used if a particular expression type doesn't have a specialized `AbstractTableScanImpl`.
+ * used if a particular expression type doesn't have a specialized `AbstractTableScanImpl`. If an ExpressionProgram
+ * supports the expression, it is used instead of the ExpressionEvaluator.
  */
 class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  public:
@@ -25,6 +27,7 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  private:
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<const AbstractExpression> _expression;
+  std::shared_ptr<const ExpressionProgram> _expression_program;
 };
 
 }  // namespace hyrise
@@ -0,0 +1,210 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// std::hash is the identity for integers in libstdc++. To make use of all bits of the hash, we mix it using the
+// finalizer of MurmurHash3.
+uint64_t mix_hash(uint64_t hash) {
+  hash ^= hash >> 33u;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33u;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33u;
+  return hash;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+RuntimeFilter::RuntimeFilter(const Table& table, const ColumnID column_id)
+    : _data_type(table.column_data_type(column_id)) {
+  const auto row_count = table.row_count();
+  const auto bloom_filter_size =
+      std::clamp(std::bit_ceil(row_count * BLOOM_FILTER_BITS_PER_VALUE), MIN_BLOOM_FILTER_SIZE, MAX_BLOOM_FILTER_SIZE);
+  _bloom_filter.resize(bloom_filter_size);
+  _bloom_filter_mask = bloom_filter_size - 1;
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = ColumnDataType{};
+    auto max = ColumnDataType{};
+    const auto hash_function = std::hash<ColumnDataType>{};
+
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        if (_value_count == 0) {
+          min = value;
+          max = value;
+        } else {
+          min = std::min(min, value);
+          max = std::max(max, value);
+        }
+        ++_value_count;
+
+        const auto hash = mix_hash(hash_function(value));
+        _bloom_filter.set(hash & _bloom_filter_mask);
+        _bloom_filter.set((hash >> 32u) & _bloom_filter_mask);
+      });
+    }
+
+    if (_value_count > 0) {
+      _min = min;
+      _max = max;
+    }
+  });
+}
+
+DataType RuntimeFilter::data_type() const {
+  return _data_type;
+}
+
+size_t RuntimeFilter::value_count() const {
+  return _value_count;
+}
+
+bool RuntimeFilter::can_prune(const Chunk& chunk, const ColumnID column_id) const {
+  if (_value_count == 0) {
+    return true;
+  }
+
+  const auto& segment = chunk.get_segment(column_id);
+  DebugAssert(segment->data_type() == _data_type, "RuntimeFilter was built for a different data type.");
+
+  // Chunks of reference tables have no pruning statistics. If the segment references a single chunk, we use the
+  // statistics of that chunk instead. Chunks that reference multiple chunks are never pruned.
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    const auto& pos_list = *reference_segment->pos_list();
+    if (pos_list.empty() || !pos_list.references_single_chunk()) {
+      return false;
+    }
+
+    const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id());
+    return referenced_chunk && can_prune(*referenced_chunk, reference_segment->referenced_column_id());
+  }
+
+  auto can_prune = false;
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& pruning_statistics = chunk.pruning_statistics();
+    if (pruning_statistics) {
+      const auto& segment_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[column_id]);
+
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+        if (segment_statistics.range_filter &&
+            segment_statistics.range_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+          can_prune = true;
+        }
+      }
+
+      if (segment_statistics.min_max_filter &&
+          segment_statistics.min_max_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+        can_prune = true;
+      }
+      return;
+    }
+
+    // Without pruning statistics, we can still use the sorted dictionary of dictionary-encoded segments.
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      // An empty dictionary means that the segment only contains NULL values.
+      can_prune = dictionary.empty() || dictionary.back() < boost::get<ColumnDataType>(_min) ||
+                  dictionary.front() > boost::get<ColumnDataType>(_max);
+    }
+  });
+
+  return can_prune;
+}
+
+void RuntimeFilter::filter(const Chunk& chunk, const ColumnID column_id,
+                           const std::shared_ptr<RowIDPosList>& matches) const {
+  if (_value_count == 0) {
+    matches->clear();
+    return;
+  }
+
+  const auto& segment = *chunk.get_segment(column_id);
+  DebugAssert(segment.data_type() == _data_type, "RuntimeFilter was built for a different data type.");
+  matches->guarantee_single_chunk();
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& min = boost::get<ColumnDataType>(_min);
+    const auto& max = boost::get<ColumnDataType>(_max);
+
+    const auto passes_filter = [&](const auto& value) {
+      return value >= min && value <= max && _bloom_filter_contains(value);
+    };
+
+    // The matches are iterated in order. Thus, we can compact them in place as a match is never overwritten before it
+    // has been visited.
+    auto read_index = size_t{0};
+    auto write_index = size_t{0};
+
+    // segment_iterate_filtered requires point access, which ReferenceSegments do not offer. Thus, we resolve the
+    // referenced values of the matches using an accessor.
+    if (dynamic_cast<const ReferenceSegment*>(&segment)) {
+      const auto accessor = create_segment_accessor<ColumnDataType>(chunk.get_segment(column_id));
+      const auto match_count = matches->size();
+      for (; read_index < match_count; ++read_index) {
+        const auto value = accessor->access((*matches)[read_index].chunk_offset);
+        if (value && passes_filter(*value)) {
+          (*matches)[write_index] = (*matches)[read_index];
+          ++write_index;
+        }
+      }
+    } else {
+      segment_iterate_filtered<ColumnDataType>(segment, matches, [&](const auto& position) {
+        if (!position.is_null() && passes_filter(position.value())) {
+          (*matches)[write_index] = (*matches)[read_index];
+          ++write_index;
+        }
+        ++read_index;
+      });
+    }
+
+    matches->resize(write_index);
+  });
+}
+
+template <typename ColumnDataType>
+bool RuntimeFilter::_bloom_filter_contains(const ColumnDataType& value) const {
+  const auto hash = mix_hash(std::hash<ColumnDataType>{}(value));
+  return _bloom_filter.test(hash & _bloom_filter_mask) && _bloom_filter.test((hash >> 32u) & _bloom_filter_mask);
+}
+
+}  // namespace hyrise
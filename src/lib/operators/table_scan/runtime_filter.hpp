@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+
+#include <boost/dynamic_bitset.hpp>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * A RuntimeFilter summarizes the values of a column of an intermediate result (e.g., the reducer of a semi join
+ * reduction, see SemiJoinReductionRule) by their minimum, their maximum, and a Bloom filter. A TableScan that is given
+ * a RuntimeFilter uses it to skip chunks whose values cannot be within [min, max] and to remove rows whose values are
+ * not contained in the Bloom filter. As Bloom filters have false positives, the filtered result may still contain rows
+ * whose values do not occur in the summarized column. Thus, RuntimeFilters can only be used where removing rows is
+ * optional, such as for semi join reductions. NULL values never pass the filter.
+ */
+class RuntimeFilter {
+ public:
+  RuntimeFilter(const Table& table, const ColumnID column_id);
+
+  DataType data_type() const;
+
+  // Number of non-NULL values that were added to the filter.
+  size_t value_count() const;
+
+  // Returns true if no value of the column in the given chunk can pass the filter. This is decided based on the
+  // chunk's pruning statistics or, if the chunk has none, on the dictionary of a dictionary-encoded segment. For chunks
+  // of reference tables, the referenced chunk is used if all rows reference the same chunk.
+  bool can_prune(const Chunk& chunk, const ColumnID column_id) const;
+
+  // Removes all matches whose values in the given column of the chunk do not pass the filter. The matches have to
+  // reference the chunk, which may be a chunk of a data table or of a reference table.
+  void filter(const Chunk& chunk, const ColumnID column_id, const std::shared_ptr<RowIDPosList>& matches) const;
+
+  // Bits per value in the Bloom filter. With two hash functions, this results in a false positive rate of about 5%.
+  static constexpr auto BLOOM_FILTER_BITS_PER_VALUE = size_t{8};
+  static constexpr auto MIN_BLOOM_FILTER_SIZE = size_t{1} << 10;
+  static constexpr auto MAX_BLOOM_FILTER_SIZE = size_t{1} << 26;
+
+ protected:
+  template <typename ColumnDataType>
+  bool _bloom_filter_contains(const ColumnDataType& value) const;
+
+  DataType _data_type;
+  size_t _value_count{0};
+
+  // Only set if _value_count > 0.
+  AllTypeVariant _min;
+  AllTypeVariant _max;
+
+  // The size of the Bloom filter is a power of two, so that we can use a mask instead of a modulo.
+  boost::dynamic_bitset<> _bloom_filter;
+  size_t _bloom_filter_mask{0};
+};
+
+}  // namespace hyrise
@@ -1,10 +1,12 @@
 #include "union_all.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "operators/operator_row_limit.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
@@ -24,14 +26,17 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
          "Input tables must have same number of columns");
   DebugAssert(left_input_table()->type() == right_input_table()->type(), "Input tables must have the same type");
 
-  auto output_chunks =
-      std::vector<std::shared_ptr<Chunk>>{left_input_table()->chunk_count() + right_input_table()->chunk_count()};
-  auto output_chunk_idx = size_t{0};
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(left_input_table()->chunk_count() + right_input_table()->chunk_count());
+
+  // With a row limit (see AbstractOperator::set_row_limit), the right input is only added if the left input does not
+  // hold enough rows.
+  auto remaining_row_limit = _row_limit;
 
   // add positions to output by iterating over both input tables
   for (const auto& input : {left_input_table(), right_input_table()}) {
     // iterating over all chunks of table input
-    const auto chunk_count = input->chunk_count();
+    const auto chunk_count = OperatorRowLimit::prefix_chunk_count(*input, remaining_row_limit);
     for (ChunkID in_chunk_id{0}; in_chunk_id < chunk_count; in_chunk_id++) {
       const auto chunk = input->get_chunk(in_chunk_id);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -45,8 +50,11 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
       }
 
       // adding newly filled chunk to the output table
-      output_chunks[output_chunk_idx] = std::make_shared<Chunk>(output_segments);
-      ++output_chunk_idx;
+      output_chunks.emplace_back(std::make_shared<Chunk>(output_segments));
+
+      if (remaining_row_limit) {
+        *remaining_row_limit -= std::min(*remaining_row_limit, static_cast<size_t>(chunk->size()));
+      }
     }
   }
 
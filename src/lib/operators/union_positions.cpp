@@ -1,19 +1,29 @@
 #include "union_positions.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <boost/container_hash/hash.hpp>
 #include <boost/sort/sort.hpp>
 
+#include "bytell_hash_map.hpp"
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
 
 /**
  * ### UnionPositions implementation
@@ -53,19 +63,29 @@
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
  *
- * The sorting, which is the most expensive part of this operator, could probably be parallelized.
+ *
+ *
+ * ### Hash-based algorithm
+ * The sorting is the most expensive part of the above, and it runs on a single thread. As an alternative, the rows of
+ * both ReferenceMatrices are partitioned by the ChunkID of their first RowID, with one job per partition. Each job
+ * counts the rows of the left input in a hash map (or, if there is only one ColumnCluster, in counters per referenced
+ * row) and emits the right rows that exceed these counts. The output is not sorted.
+ * The cost-based choice between both algorithms (see _choose_algorithm()) prefers sorting for presorted and small
+ * inputs.
  */
 namespace hyrise {
 
 UnionPositions::UnionPositions(const std::shared_ptr<const AbstractOperator>& left,
-                               const std::shared_ptr<const AbstractOperator>& right)
-    : AbstractReadOnlyOperator(OperatorType::UnionPositions, left, right) {}
+                               const std::shared_ptr<const AbstractOperator>& right,
+                               const std::optional<Algorithm> algorithm)
+    : AbstractReadOnlyOperator(OperatorType::UnionPositions, left, right, std::make_unique<PerformanceData>()),
+      _algorithm{algorithm} {}
 
 std::shared_ptr<AbstractOperator> UnionPositions::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const {
-  return std::make_shared<UnionPositions>(copied_left_input, copied_right_input);
+  return std::make_shared<UnionPositions>(copied_left_input, copied_right_input, _algorithm);
 }
 
 void UnionPositions::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -79,6 +99,17 @@ const std::string& UnionPositions::name() const {
   return name;
 }
 
+void UnionPositions::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData<OperatorSteps>::output_to_stream(stream, description_mode);
+
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+  if (algorithm == Algorithm::SortMerge) {
+    stream << separator << "Sorted and merged the inputs.";
+  } else {
+    stream << separator << "Hashed the inputs in " << job_count << " job" << (job_count != 1 ? "s" : "") << ".";
+  }
+}
+
 std::shared_ptr<const Table> UnionPositions::_on_execute() {
   auto early_result = _prepare_operator();
   if (early_result) {
@@ -86,25 +117,102 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   }
 
   const auto& left_in_table = *left_input_table();
+  auto& step_performance_data = static_cast<PerformanceData&>(*performance_data);
+  auto timer = Timer{};
 
   /**
    * For each input, create a ReferenceMatrix
    */
-  auto reference_matrix_left = _build_reference_matrix(left_input_table());
-  auto reference_matrix_right = _build_reference_matrix(right_input_table());
+  const auto reference_matrix_left = _build_reference_matrix(left_input_table());
+  const auto reference_matrix_right = _build_reference_matrix(right_input_table());
+  step_performance_data.set_step_runtime(OperatorSteps::BuildReferenceMatrices, timer.lap());
+
+  const auto hash_job_count = _hash_job_count(reference_matrix_left, reference_matrix_right);
+  const auto algorithm =
+      _algorithm ? *_algorithm : _choose_algorithm(reference_matrix_left, reference_matrix_right, hash_job_count);
+  step_performance_data.algorithm = algorithm;
+
+  auto output_chunks = std::vector<ReferenceMatrix>{};
+  if (algorithm == Algorithm::SortMerge) {
+    output_chunks = _union_sort_merge(reference_matrix_left, reference_matrix_right);
+  } else {
+    step_performance_data.job_count = hash_job_count;
+    output_chunks = _union_hash(reference_matrix_left, reference_matrix_right, hash_job_count);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Union, timer.lap());
 
+  /**
+   * Build result table
+   */
+  auto out_table = std::make_shared<Table>(left_in_table.column_definitions(), TableType::References);
+  for (auto& output_chunk : output_chunks) {
+    Segments output_segments;
+
+    for (size_t pos_lists_idx = 0; pos_lists_idx < output_chunk.size(); ++pos_lists_idx) {
+      const auto pos_list = std::make_shared<RowIDPosList>(std::move(output_chunk[pos_lists_idx]));
+      const auto cluster_column_id_begin = _column_cluster_offsets[pos_lists_idx];
+      const auto cluster_column_id_end = pos_lists_idx >= _column_cluster_offsets.size() - 1
+                                             ? left_in_table.column_count()
+                                             : _column_cluster_offsets[pos_lists_idx + 1];
+      for (auto column_id = cluster_column_id_begin; column_id < cluster_column_id_end; ++column_id) {
+        auto ref_segment = std::make_shared<ReferenceSegment>(_referenced_tables[pos_lists_idx],
+                                                              _referenced_column_ids[column_id], pos_list);
+        output_segments.push_back(ref_segment);
+      }
+    }
+
+    out_table->append_chunk(output_segments);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer.lap());
+
+  return out_table;
+}
+
+size_t UnionPositions::_hash_job_count(const ReferenceMatrix& left_matrix, const ReferenceMatrix& right_matrix) const {
+  // Rows are partitioned by the ChunkID of their first RowID, so there cannot be more partitions than chunks in the
+  // first referenced table.
+  const auto row_count = left_matrix.front().size() + right_matrix.front().size();
+  const auto max_job_count = std::min(Hyrise::get().topology.num_cpus(),
+                                      static_cast<size_t>(_referenced_tables.front()->chunk_count()));
+  return std::max(std::min(row_count / MIN_ROWS_PER_JOB, max_job_count), size_t{1});
+}
+
+UnionPositions::Algorithm UnionPositions::_choose_algorithm(const ReferenceMatrix& left_matrix,
+                                                            const ReferenceMatrix& right_matrix,
+                                                            const size_t hash_job_count) {
+  // Sorting an input takes about n * log(n) comparisons on a single thread. pdqsort sorts presorted inputs (e.g., the
+  // outputs of table scans) in linear time, which we detect by looking at the first ColumnCluster.
+  const auto estimate_sort_cost = [](const ReferenceMatrix& matrix) {
+    const auto& first_pos_list = matrix.front();
+    const auto row_count = first_pos_list.size();
+    if (std::is_sorted(first_pos_list.begin(), first_pos_list.end())) {
+      return row_count;
+    }
+    return row_count * std::bit_width(row_count);
+  };
+
+  // Every job of the hash-based algorithm scans all rows and inserts the rows of its partition into a hash map.
+  const auto row_count = left_matrix.front().size() + right_matrix.front().size();
+  const auto hash_cost = row_count + HASH_COST_FACTOR * row_count / hash_job_count;
+  const auto sort_cost = estimate_sort_cost(left_matrix) + estimate_sort_cost(right_matrix);
+
+  return hash_cost < sort_cost ? Algorithm::Hash : Algorithm::SortMerge;
+}
+
+std::vector<UnionPositions::ReferenceMatrix> UnionPositions::_union_sort_merge(
+    const ReferenceMatrix& left_matrix, const ReferenceMatrix& right_matrix) const {
   /**
    * Init the virtual pos lists
    */
-  VirtualPosList virtual_pos_list_left(left_in_table.row_count(), 0u);
+  VirtualPosList virtual_pos_list_left(left_matrix.front().size(), 0u);
   std::iota(virtual_pos_list_left.begin(), virtual_pos_list_left.end(), 0u);
-  VirtualPosList virtual_pos_list_right(right_input_table()->row_count(), 0u);
+  VirtualPosList virtual_pos_list_right(right_matrix.front().size(), 0u);
   std::iota(virtual_pos_list_right.begin(), virtual_pos_list_right.end(), 0u);
 
   /**
    * Sort the virtual pos lists so that they bring the rows in their respective ReferenceMatrix into order.
    * This is necessary for merging them.
-   * Performance note: These sorts take the vast majority of time spent in this operator. Using boost's pdqsort helps
+   * Performance note: These sorts take the vast majority of time spent in this algorithm. Using boost's pdqsort helps
    * a lot over std::sort, but there is probably still room for improvement (see comment above about other data
    * structures). The reason why pdqsort can be much faster than std::sort is that is more efficient for already sorted
    * data, which happens when no "shuffling" operators (e.g., inner joins) occur before the UnionPosition so the
@@ -112,53 +220,29 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
    * faster than std::sort.
    */
   boost::sort::pdqsort(virtual_pos_list_left.begin(), virtual_pos_list_left.end(),
-                       VirtualPosListCmpContext{reference_matrix_left});
+                       VirtualPosListCmpContext{left_matrix});
   boost::sort::pdqsort(virtual_pos_list_right.begin(), virtual_pos_list_right.end(),
-                       VirtualPosListCmpContext{reference_matrix_right});
+                       VirtualPosListCmpContext{right_matrix});
 
-  /**
-   * Build result table
-   */
   auto left_idx = size_t{0};
   auto right_idx = size_t{0};
   const auto num_rows_left = virtual_pos_list_left.size();
   const auto num_rows_right = virtual_pos_list_right.size();
 
-  auto out_table = std::make_shared<Table>(left_in_table.column_definitions(), TableType::References);
-
-  std::vector<std::shared_ptr<RowIDPosList>> pos_lists(reference_matrix_left.size());
-  std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<RowIDPosList>(); });
+  auto output_chunks = std::vector<ReferenceMatrix>{};
+  auto pos_lists = ReferenceMatrix(left_matrix.size());
 
   // Adds the row `row_idx` from `reference_matrix` to the pos_lists we're currently building
   const auto emit_row = [&](const ReferenceMatrix& reference_matrix, size_t row_idx) {
     for (size_t pos_list_idx = 0; pos_list_idx < pos_lists.size(); ++pos_list_idx) {
-      pos_lists[pos_list_idx]->emplace_back(reference_matrix[pos_list_idx][row_idx]);
+      pos_lists[pos_list_idx].emplace_back(reference_matrix[pos_list_idx][row_idx]);
     }
   };
 
-  // Turn 'pos_lists' into a new chunk and append it to the table
-  const auto emit_chunk = [&]() {
-    Segments output_segments;
-
-    for (size_t pos_lists_idx = 0; pos_lists_idx < pos_lists.size(); ++pos_lists_idx) {
-      const auto cluster_column_id_begin = _column_cluster_offsets[pos_lists_idx];
-      const auto cluster_column_id_end = pos_lists_idx >= _column_cluster_offsets.size() - 1
-                                             ? left_in_table.column_count()
-                                             : _column_cluster_offsets[pos_lists_idx + 1];
-      for (auto column_id = cluster_column_id_begin; column_id < cluster_column_id_end; ++column_id) {
-        auto ref_segment = std::make_shared<ReferenceSegment>(
-            _referenced_tables[pos_lists_idx], _referenced_column_ids[column_id], pos_lists[pos_lists_idx]);
-        output_segments.push_back(ref_segment);
-      }
-    }
-
-    out_table->append_chunk(output_segments);
-  };
-
   /**
-   * This loop merges reference_matrix_left and reference_matrix_right into the result table. The implementation is
-   * derived from std::set_union() and only differs from it insofar as that it builds the output table at the same
-   * time as merging the two ReferenceMatrices
+   * This loop merges left_matrix and right_matrix into the output chunks. The implementation is derived from
+   * std::set_union() and only differs from it insofar as that it builds the output chunks at the same time as merging
+   * the two ReferenceMatrices
    */
 
   const auto out_chunk_size = Chunk::DEFAULT_SIZE;
@@ -169,20 +253,20 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
      * Begin derived from std::union()
      */
     if (left_idx == num_rows_left) {  // NOLINT(bugprone-branch-clone)
-      emit_row(reference_matrix_right, virtual_pos_list_right[right_idx]);
+      emit_row(right_matrix, virtual_pos_list_right[right_idx]);
       ++right_idx;
     } else if (right_idx == num_rows_right) {
-      emit_row(reference_matrix_left, virtual_pos_list_left[left_idx]);
+      emit_row(left_matrix, virtual_pos_list_left[left_idx]);
       ++left_idx;
-    } else if (_compare_reference_matrix_rows(reference_matrix_right, virtual_pos_list_right[right_idx],
-                                              reference_matrix_left, virtual_pos_list_left[left_idx])) {
-      emit_row(reference_matrix_right, virtual_pos_list_right[right_idx]);
+    } else if (_compare_reference_matrix_rows(right_matrix, virtual_pos_list_right[right_idx], left_matrix,
+                                              virtual_pos_list_left[left_idx])) {
+      emit_row(right_matrix, virtual_pos_list_right[right_idx]);
       ++right_idx;
     } else {
-      emit_row(reference_matrix_left, virtual_pos_list_left[left_idx]);
+      emit_row(left_matrix, virtual_pos_list_left[left_idx]);
 
-      if (!_compare_reference_matrix_rows(reference_matrix_left, virtual_pos_list_left[left_idx],
-                                          reference_matrix_right, virtual_pos_list_right[right_idx])) {
+      if (!_compare_reference_matrix_rows(left_matrix, virtual_pos_list_left[left_idx], right_matrix,
+                                          virtual_pos_list_right[right_idx])) {
         ++right_idx;
       }
       ++left_idx;
@@ -196,18 +280,127 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
      * Emit a completed chunk
      */
     if (chunk_row_idx == out_chunk_size && out_chunk_size != 0) {
-      emit_chunk();
+      output_chunks.emplace_back(std::move(pos_lists));
 
       chunk_row_idx = 0;
-      std::generate(pos_lists.begin(), pos_lists.end(), [&] { return std::make_shared<RowIDPosList>(); });
+      pos_lists = ReferenceMatrix(left_matrix.size());
     }
   }
 
   if (chunk_row_idx != 0) {
-    emit_chunk();
+    output_chunks.emplace_back(std::move(pos_lists));
   }
 
-  return out_table;
+  return output_chunks;
+}
+
+std::vector<UnionPositions::ReferenceMatrix> UnionPositions::_union_hash(const ReferenceMatrix& left_matrix,
+                                                                         const ReferenceMatrix& right_matrix,
+                                                                         const size_t job_count) const {
+  const auto cluster_count = left_matrix.size();
+  const auto num_rows_left = left_matrix.front().size();
+  const auto num_rows_right = right_matrix.front().size();
+
+  auto output_chunks_by_job = std::vector<std::vector<ReferenceMatrix>>(job_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& output_chunks = output_chunks_by_job[job_id];
+      auto pos_lists = ReferenceMatrix(cluster_count);
+
+      const auto emit_row = [&](const ReferenceMatrix& reference_matrix, const size_t row_idx) {
+        for (auto pos_list_idx = size_t{0}; pos_list_idx < cluster_count; ++pos_list_idx) {
+          pos_lists[pos_list_idx].emplace_back(reference_matrix[pos_list_idx][row_idx]);
+        }
+
+        if (pos_lists.front().size() == Chunk::DEFAULT_SIZE) {
+          output_chunks.emplace_back(std::move(pos_lists));
+          pos_lists = ReferenceMatrix(cluster_count);
+        }
+      };
+
+      // Equal rows have the same first RowID and thus end up in the same partition. NULL_ROW_IDs (e.g., from outer
+      // joins) all have the same ChunkID, too.
+      const auto in_partition = [&](const ReferenceMatrix& reference_matrix, const size_t row_idx) {
+        return reference_matrix.front()[row_idx].chunk_id % job_count == job_id;
+      };
+
+      // Emits all rows of the left input and as many rows of the right input as they occur more often than in the left
+      // input (i.e., the semantics of std::set_union()). `get_left_count` returns a pointer to the number of not yet
+      // "consumed" left rows that are equal to the passed row, or nullptr if there is none and `insert` is false.
+      const auto union_partition = [&](const auto& get_left_count) {
+        for (auto row_idx = size_t{0}; row_idx < num_rows_left; ++row_idx) {
+          if (in_partition(left_matrix, row_idx)) {
+            ++*get_left_count(left_matrix, row_idx, true);
+            emit_row(left_matrix, row_idx);
+          }
+        }
+
+        for (auto row_idx = size_t{0}; row_idx < num_rows_right; ++row_idx) {
+          if (in_partition(right_matrix, row_idx)) {
+            auto* const left_count = get_left_count(right_matrix, row_idx, false);
+            if (left_count && *left_count > 0) {
+              --*left_count;
+            } else {
+              emit_row(right_matrix, row_idx);
+            }
+          }
+        }
+      };
+
+      if (cluster_count == 1) {
+        // All rows reference the same table. Instead of hashing the RowIDs, we use a counter for each referenced row,
+        // allocated per referenced chunk. We cannot use plain bitmaps, as duplicate rows within the inputs are kept.
+        const auto& referenced_table = *_referenced_tables.front();
+        auto counts_by_chunk = std::vector<std::vector<uint32_t>>(referenced_table.chunk_count());
+        auto null_row_count = uint32_t{0};
+
+        union_partition([&](const ReferenceMatrix& reference_matrix, const size_t row_idx, const bool /*insert*/) {
+          const auto& row_id = reference_matrix.front()[row_idx];
+          if (row_id.is_null()) {
+            return &null_row_count;
+          }
+
+          auto& counts = counts_by_chunk[row_id.chunk_id];
+          if (counts.empty()) {
+            const auto chunk = referenced_table.get_chunk(row_id.chunk_id);
+            Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+            counts.resize(chunk->size());
+          }
+          DebugAssert(row_id.chunk_offset < counts.size(), "RowID references row beyond the chunk's size.");
+          return &counts[row_id.chunk_offset];
+        });
+      } else {
+        auto left_counts = ska::bytell_hash_map<size_t, uint32_t, RowHashContext, RowEqualContext>{
+            0, RowHashContext{left_matrix, right_matrix}, RowEqualContext{left_matrix, right_matrix}};
+
+        union_partition([&](const ReferenceMatrix& reference_matrix, const size_t row_idx,
+                            const bool insert) -> uint32_t* {
+          const auto row = &reference_matrix == &left_matrix ? row_idx : row_idx | RIGHT_ROW_FLAG;
+          if (insert) {
+            return &left_counts[row];
+          }
+
+          const auto iter = left_counts.find(row);
+          return iter != left_counts.end() ? &iter->second : nullptr;
+        });
+      }
+
+      if (!pos_lists.front().empty()) {
+        output_chunks.emplace_back(std::move(pos_lists));
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto output_chunks = std::vector<ReferenceMatrix>{};
+  for (auto& job_output_chunks : output_chunks_by_job) {
+    std::move(job_output_chunks.begin(), job_output_chunks.end(), std::back_inserter(output_chunks));
+  }
+
+  return output_chunks;
 }
 
 std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
@@ -364,6 +557,34 @@ bool UnionPositions::_compare_reference_matrix_rows(const ReferenceMatrix& left_
   return false;
 }
 
+size_t UnionPositions::RowHashContext::operator()(size_t row) const {
+  const auto& reference_matrix = row & RIGHT_ROW_FLAG ? right_matrix : left_matrix;
+  const auto row_idx = row & ~RIGHT_ROW_FLAG;
+
+  auto hash = size_t{0};
+  for (const auto& reference_matrix_column : reference_matrix) {
+    const auto& row_id = reference_matrix_column[row_idx];
+    boost::hash_combine(hash, static_cast<ChunkID::base_type>(row_id.chunk_id));
+    boost::hash_combine(hash, static_cast<ChunkOffset::base_type>(row_id.chunk_offset));
+  }
+  return hash;
+}
+
+bool UnionPositions::RowEqualContext::operator()(size_t left, size_t right) const {
+  const auto& left_reference_matrix = left & RIGHT_ROW_FLAG ? right_matrix : left_matrix;
+  const auto& right_reference_matrix = right & RIGHT_ROW_FLAG ? right_matrix : left_matrix;
+  const auto left_row_idx = left & ~RIGHT_ROW_FLAG;
+  const auto right_row_idx = right & ~RIGHT_ROW_FLAG;
+
+  const auto cluster_count = left_matrix.size();
+  for (auto column_idx = size_t{0}; column_idx < cluster_count; ++column_idx) {
+    if (left_reference_matrix[column_idx][left_row_idx] != right_reference_matrix[column_idx][right_row_idx]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool UnionPositions::VirtualPosListCmpContext::operator()(size_t left, size_t right) const {
   for (const auto& reference_matrix_column : reference_matrix) {
     const auto left_row_id = reference_matrix_column[left];
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -66,14 +67,37 @@ namespace hyrise {
  *    RowID{0, 1}
  *    RowID{1, 0}
  *
+ * ## Algorithms
+ *  The union is computed either by sorting both inputs and merging them (SortMerge) or by partitioning the rows and
+ *  deduplicating the partitions in parallel (Hash). Unless an algorithm is passed, it is chosen based on the estimated
+ *  costs of both (see the cpp).
  */
 class UnionPositions : public AbstractReadOnlyOperator {
  public:
+  enum class Algorithm : uint8_t { SortMerge, Hash };
+
   UnionPositions(const std::shared_ptr<const AbstractOperator>& left,
-                 const std::shared_ptr<const AbstractOperator>& right);
+                 const std::shared_ptr<const AbstractOperator>& right,
+                 const std::optional<Algorithm> algorithm = std::nullopt);
 
   const std::string& name() const override;
 
+  enum class OperatorSteps : uint8_t { BuildReferenceMatrices, Union, OutputWriting };
+
+  struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+
+    Algorithm algorithm{Algorithm::SortMerge};
+    size_t job_count{1};
+  };
+
+  // Inserting a row into a hash map is estimated to be HASH_COST_FACTOR times as expensive as comparing two rows.
+  static constexpr auto HASH_COST_FACTOR = size_t{8};
+
+  // Each job of the hash-based algorithm scans all rows to find those of its partition. Thus, we only spawn a job for
+  // every MIN_ROWS_PER_JOB input rows.
+  static constexpr auto MIN_ROWS_PER_JOB = size_t{10'000};
+
  private:
   // See docs at the top of the cpp
   using ReferenceMatrix = std::vector<RowIDPosList>;
@@ -84,7 +108,25 @@ class UnionPositions : public AbstractReadOnlyOperator {
    * Needs to know about the ReferenceMatrix that the VirtualPosList references and is thus dubbed a "Context".
    */
   struct VirtualPosListCmpContext {
-    ReferenceMatrix& reference_matrix;
+    const ReferenceMatrix& reference_matrix;
+    bool operator()(size_t left, size_t right) const;
+  };
+
+  /**
+   * Hash and equality functors for the hash map of the hash-based algorithm. The keys are row indexes of the left
+   * ReferenceMatrix, or of the right ReferenceMatrix with RIGHT_ROW_FLAG set.
+   */
+  static constexpr auto RIGHT_ROW_FLAG = size_t{1} << 63u;
+
+  struct RowHashContext {
+    const ReferenceMatrix& left_matrix;
+    const ReferenceMatrix& right_matrix;
+    size_t operator()(size_t row) const;
+  };
+
+  struct RowEqualContext {
+    const ReferenceMatrix& left_matrix;
+    const ReferenceMatrix& right_matrix;
     bool operator()(size_t left, size_t right) const;
   };
 
@@ -111,6 +153,17 @@ class UnionPositions : public AbstractReadOnlyOperator {
   std::shared_ptr<const Table> _prepare_operator();
 
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
+
+  // Returns the number of jobs used by the hash-based algorithm.
+  size_t _hash_job_count(const ReferenceMatrix& left_matrix, const ReferenceMatrix& right_matrix) const;
+  static Algorithm _choose_algorithm(const ReferenceMatrix& left_matrix, const ReferenceMatrix& right_matrix,
+                                     const size_t hash_job_count);
+
+  // Both algorithms return the pos lists of the output chunks, one ReferenceMatrix per chunk.
+  std::vector<ReferenceMatrix> _union_sort_merge(const ReferenceMatrix& left_matrix,
+                                                 const ReferenceMatrix& right_matrix) const;
+  std::vector<ReferenceMatrix> _union_hash(const ReferenceMatrix& left_matrix, const ReferenceMatrix& right_matrix,
+                                           const size_t job_count) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
 
@@ -122,5 +175,7 @@ class UnionPositions : public AbstractReadOnlyOperator {
 
   // For each column_idx in the input tables, specifies the referenced column in the referenced table
   std::vector<ColumnID> _referenced_column_ids;
+
+  const std::optional<Algorithm> _algorithm;
 };
 }  // namespace hyrise
@@ -1,5 +1,6 @@
 #include "validate.hpp"
 
+#include <bit>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,6 +9,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
+#include "operators/operator_row_limit.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
@@ -25,6 +27,10 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+bool is_row_visible(const MvccData::VisibilityBitmap& visibility, ChunkOffset chunk_offset) {
+  return (visibility[chunk_offset / 64] >> (chunk_offset % 64)) & 1;
+}
+
 }  // namespace
 
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
@@ -55,6 +61,18 @@ bool Validate::_is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chun
   return snapshot_commit_id >= max_begin_cid && chunk->invalid_row_count() == 0;
 }
 
+std::shared_ptr<const MvccData::VisibilityBitmap> Validate::_visibility(const MvccData& mvcc_data,
+                                                                        const TransactionID our_tid,
+                                                                        const CommitID snapshot_commit_id,
+                                                                        const ChunkOffset row_count) const {
+  if (_can_use_visibility_cache) {
+    return mvcc_data.visibility(snapshot_commit_id, row_count);
+  }
+
+  return std::make_shared<const MvccData::VisibilityBitmap>(
+      mvcc_data.compute_visibility(our_tid, snapshot_commit_id, row_count, true));
+}
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& input_operator)
     : AbstractReadOnlyOperator(OperatorType::Validate, input_operator) {}
 
@@ -86,9 +104,9 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
-  output_chunks.reserve(chunk_count);
-  auto output_mutex = std::mutex{};
+  // Stored by the ID of the input chunk, so that the output is in the order of the input (see OperatorRowLimit).
+  auto output_chunks_by_input_chunk = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto row_limit = OperatorRowLimit{_row_limit, chunk_count};
 
   auto job_start_chunk_id = ChunkID{0};
   auto job_end_chunk_id = ChunkID{0};
@@ -103,6 +121,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   // (4) no rows in the chunk have been invalidated before this transaction was started,
   // (5) the current transaction has no in-flight deletes.
   const auto& read_write_operators = transaction_context->read_write_operators();
+  _can_use_visibility_cache = read_write_operators.empty();
   for (const auto& read_write_operator : read_write_operators) {
     if (read_write_operator->type() == OperatorType::Delete) {
       _can_use_chunk_shortcut = false;
@@ -122,12 +141,12 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       const auto execute_directly = job_start_chunk_id == 0 && job_end_chunk_id == (chunk_count - 1);
 
       if (execute_directly) {
-        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id, output_chunks,
-                         output_mutex);
+        _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
+                         output_chunks_by_input_chunk, row_limit);
       } else {
-        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks, &output_mutex] {
+        jobs.push_back(std::make_shared<JobTask>([=, this, &output_chunks_by_input_chunk, &row_limit] {
           _validate_chunks(input_table, job_start_chunk_id, job_end_chunk_id, our_tid, snapshot_commit_id,
-                           output_chunks, output_mutex);
+                           output_chunks_by_input_chunk, row_limit);
         }));
 
         // Prepare next job
@@ -140,13 +159,24 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
+  // Drop the results of chunks that were validated before they were cancelled.
+  output_chunks_by_input_chunk.resize(row_limit.end_chunk_id());
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(output_chunks_by_input_chunk.size());
+  for (auto& chunk : output_chunks_by_input_chunk) {
+    if (chunk) {
+      output_chunks.emplace_back(std::move(chunk));
+    }
+  }
+
   return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
 void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
                                 const ChunkID chunk_id_end, const TransactionID our_tid,
-                                const CommitID snapshot_commit_id, std::vector<std::shared_ptr<Chunk>>& output_chunks,
-                                std::mutex& output_mutex) const {
+                                const CommitID snapshot_commit_id,
+                                std::vector<std::shared_ptr<Chunk>>& output_chunks_by_input_chunk,
+                                OperatorRowLimit& row_limit) const {
   // Stores whether a chunk has been found to be entirely visible. Only used for reference tables where no single
   // chunk guarantee has been given. Not stored in Validate object to avoid concurrency issues. This assumes that
   // only one table is referenced over all chunks. If, in the future, this is not true anymore, entirely_visible_chunks
@@ -155,6 +185,10 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
   auto entirely_visible_chunks_table = std::shared_ptr<const Table>{};  // used only for sanity check
 
   for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end; ++chunk_id) {
+    if (row_limit.is_cancelled(chunk_id)) {
+      return;
+    }
+
     const auto chunk_in = input_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
@@ -197,11 +231,29 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
         } else {
+          // Evaluating the visibility of the entire referenced chunk only pays off if the input references a large
+          // share of its rows or if the visibility has already been cached by a previous Validate.
+          const auto referenced_chunk_size = referenced_chunk->size();
+          auto visibility = std::shared_ptr<const MvccData::VisibilityBitmap>{};
+          if (pos_list_in->size() * 4 >= referenced_chunk_size) {
+            visibility = _visibility(*mvcc_data, our_tid, snapshot_commit_id, referenced_chunk_size);
+          } else if (_can_use_visibility_cache) {
+            visibility = mvcc_data->cached_visibility(snapshot_commit_id, referenced_chunk_size);
+          }
+
           auto temp_pos_list = RowIDPosList{};
           temp_pos_list.guarantee_single_chunk();
-          for (auto row_id : *pos_list_in) {
-            if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
+          if (visibility) {
+            for (auto row_id : *pos_list_in) {
+              if (hyrise::is_row_visible(*visibility, row_id.chunk_offset)) {
+                temp_pos_list.emplace_back(row_id);
+              }
+            }
+          } else {
+            for (auto row_id : *pos_list_in) {
+              if (hyrise::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+                temp_pos_list.emplace_back(row_id);
+              }
             }
           }
           pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
@@ -263,14 +315,19 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
+        const auto visibility = _visibility(*mvcc_data, our_tid, snapshot_commit_id, chunk_in->size());
+
         auto temp_pos_list = RowIDPosList{};
         temp_pos_list.reserve(expected_number_of_valid_rows);
         temp_pos_list.guarantee_single_chunk();
-        // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          if (hyrise::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
+        // Generate pos_list_out from the set bits of the selection bitmap.
+        const auto block_count = visibility->size();
+        for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+          auto mask = (*visibility)[block_index];
+          while (mask) {
+            const auto chunk_offset = static_cast<ChunkOffset>(block_index * 64 + std::countr_zero(mask));
             temp_pos_list.emplace_back(chunk_id, chunk_offset);
+            mask &= mask - 1;
           }
         }
         pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
@@ -283,8 +340,8 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       }
     }
 
+    row_limit.add_chunk(chunk_id, pos_list_out->size());
     if (!pos_list_out->empty()) {
-      const auto lock = std::lock_guard<std::mutex>{output_mutex};
       // The validate operator does not affect the sorted_by property. If a chunk has been sorted before, it still is
       // after the validate operator.
       const auto chunk = std::make_shared<Chunk>(output_segments);
@@ -294,7 +351,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& input_table,
       if (!sorted_by.empty()) {
         chunk->set_individually_sorted_by(sorted_by);
       }
-      output_chunks.emplace_back(chunk);
+      output_chunks_by_input_chunk[chunk_id] = chunk;
     }
   }
 }
@@ -5,11 +5,14 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "storage/mvcc_data.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace hyrise {
 
+class OperatorRowLimit;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -31,14 +34,25 @@ class Validate : public AbstractReadOnlyOperator {
  private:
   void _validate_chunks(const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id_start,
                         const ChunkID chunk_id_end, const TransactionID our_tid, const CommitID snapshot_commit_id,
-                        std::vector<std::shared_ptr<Chunk>>& output_chunks, std::mutex& output_mutex) const;
+                        std::vector<std::shared_ptr<Chunk>>& output_chunks_by_input_chunk,
+                        OperatorRowLimit& row_limit) const;
 
   // This is a performance optimization that can only be used if a couple of conditions are met, i.e., if
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Returns the visibility of the rows [0, row_count) of a chunk (see MvccData::compute_visibility). For transactions
+  // that did not modify any rows, the visibility cached in the MvccData is used if possible.
+  std::shared_ptr<const MvccData::VisibilityBitmap> _visibility(const MvccData& mvcc_data, const TransactionID our_tid,
+                                                                const CommitID snapshot_commit_id,
+                                                                const ChunkOffset row_count) const;
+
   bool _can_use_chunk_shortcut = true;
 
+  // True if the transaction has no read-write operators. Then, no row can be locked by it and the visibility of chunks
+  // only depends on the snapshot commit ID, which allows us to cache it (see MvccData::visibility).
+  bool _can_use_visibility_cache = true;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
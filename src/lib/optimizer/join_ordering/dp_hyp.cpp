@@ -0,0 +1,298 @@
+#include "dp_hyp.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "enumerate_hyper_ccp.hpp"
+#include "hyrise.hpp"
+#include "join_graph.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+// Building and costing the plan of a single CsgCmpPair is cheap. Below this number of pairs per job, the scheduling
+// overhead outweighs the benefit of costing the pairs in parallel.
+constexpr auto MIN_CSG_CMP_PAIRS_PER_JOB = size_t{64};
+
+}  // namespace
+
+namespace hyrise {
+
+DpHyp::DpHyp(const size_t init_max_csg_cmp_pair_count) : _max_csg_cmp_pair_count(init_max_csg_cmp_pair_count) {}
+
+std::shared_ptr<AbstractLQPNode> DpHyp::operator()(const JoinGraph& join_graph,
+                                                   const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  const auto vertex_count = join_graph.vertices.size();
+  Assert(vertex_count > 0, "Code below relies on the JoinGraph having vertices");
+  Assert(vertex_count <= MAX_VERTEX_COUNT, "Too many vertices for DpHyp");
+
+  /**
+   * 1. Initialize the vertex plans as in DpCcp: Place uncorrelated predicates (think "6 > 4": not referencing any
+   *    vertex) on top of the largest vertex and local predicates on top of their vertices.
+   */
+  auto vertex_lqps = join_graph.vertices;
+
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (edge.vertex_set.none()) {
+      uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+    }
+  }
+
+  if (!uncorrelated_predicates.empty()) {
+    const auto& cardinality_estimator = cost_estimator->cardinality_estimator;
+    const auto largest_vertex_iter =
+        std::max_element(vertex_lqps.begin(), vertex_lqps.end(), [&](const auto& lhs, const auto& rhs) {
+          return cardinality_estimator->estimate_cardinality(lhs) < cardinality_estimator->estimate_cardinality(rhs);
+        });
+
+    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+      *largest_vertex_iter = PredicateNode::make(uncorrelated_predicate, *largest_vertex_iter);
+    }
+  }
+
+  auto components = std::vector<Component>{};
+  components.reserve(vertex_count);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
+    const auto vertex_lqp = _add_predicates_to_plan(vertex_lqps[vertex_idx], vertex_predicates, cost_estimator);
+
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    vertex_set.set(vertex_idx);
+    const auto vertex_cost = cost_estimator->estimate_plan_cost(vertex_lqp);
+    components.emplace_back(Component{vertex_set, JoinPlan{vertex_lqp, vertex_cost}});
+  }
+
+  /**
+   * 2. Set up one cost estimator per parallel job. Each gets the same caching guarantees as the estimator used by the
+   *    JoinOrderingRule. Some nodes (e.g., StoredTableNodes) lazily compute their output expressions. This must not
+   *    happen concurrently, so it is triggered for all vertices before any job runs.
+   */
+  _cost_estimators = {cost_estimator};
+  if (Hyrise::get().is_multi_threaded()) {
+    for (const auto& vertex : join_graph.vertices) {
+      visit_lqp(vertex, [](const auto& node) {
+        node->output_expressions();
+        return LQPVisitation::VisitInputs;
+      });
+    }
+
+    const auto job_count = std::max(Hyrise::get().topology.num_cpus(), size_t{1});
+    for (auto job_idx = size_t{1}; job_idx < job_count; ++job_idx) {
+      const auto job_cost_estimator = cost_estimator->new_instance();
+      job_cost_estimator->guarantee_bottom_up_construction();
+      job_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+      _cost_estimators.emplace_back(job_cost_estimator);
+    }
+  }
+
+  /**
+   * 3. Run DPhyp on the components. If the search space exceeds the budget, collapse the cheapest plan for the largest
+   *    vertex sets that fit into the budget into a new component and repeat (IDP-1).
+   */
+  while (components.size() > 1) {
+    const auto component_count = components.size();
+    const auto [max_vertex_set_size, csg_cmp_pairs] = _enumerate_csg_cmp_pairs(join_graph, components);
+    const auto best_plans = _evaluate_csg_cmp_pairs(join_graph, components, csg_cmp_pairs);
+
+    if (max_vertex_set_size == component_count) {
+      auto all_components_set = JoinGraphVertexSet{component_count};
+      all_components_set.flip();  // Turns all bits to '1'
+
+      const auto best_plan_iter = best_plans.find(all_components_set);
+      Assert(best_plan_iter != best_plans.end(),
+             "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+
+      _cost_estimators.clear();
+      return best_plan_iter->second.lqp;
+    }
+
+    // Usually, the plans joining the most components have max_vertex_set_size components. Choose the cheapest.
+    auto collapsed_plan_iter = best_plans.end();
+    for (auto best_plan_iter = best_plans.begin(); best_plan_iter != best_plans.end(); ++best_plan_iter) {
+      const auto joined_component_count = best_plan_iter->first.count();
+      if (joined_component_count < 2) {
+        continue;
+      }
+
+      if (collapsed_plan_iter == best_plans.end() || joined_component_count > collapsed_plan_iter->first.count() ||
+          (joined_component_count == collapsed_plan_iter->first.count() &&
+           best_plan_iter->second.cost < collapsed_plan_iter->second.cost)) {
+        collapsed_plan_iter = best_plan_iter;
+      }
+    }
+    Assert(collapsed_plan_iter != best_plans.end(), "No join plan generated. Maybe JoinGraph isn't connected?");
+
+    auto collapsed_component = Component{JoinGraphVertexSet{vertex_count}, collapsed_plan_iter->second};
+    auto remaining_components = std::vector<Component>{};
+    remaining_components.reserve(component_count - collapsed_plan_iter->first.count() + 1);
+    for (auto component_idx = size_t{0}; component_idx < component_count; ++component_idx) {
+      if (collapsed_plan_iter->first.test(component_idx)) {
+        collapsed_component.vertex_set |= components[component_idx].vertex_set;
+      } else {
+        remaining_components.emplace_back(std::move(components[component_idx]));
+      }
+    }
+    remaining_components.emplace_back(std::move(collapsed_component));
+    components = std::move(remaining_components);
+  }
+
+  _cost_estimators.clear();
+  return components.front().plan.lqp;
+}
+
+std::pair<size_t, std::vector<CsgCmpPair>> DpHyp::_enumerate_csg_cmp_pairs(
+    const JoinGraph& join_graph, const std::vector<Component>& components) const {
+  const auto component_count = components.size();
+
+  // Project the edges onto the components. Edges within a single component have already been placed in its plan.
+  auto component_edges = std::vector<JoinGraphVertexSet>{};
+  for (const auto& edge : join_graph.edges) {
+    auto component_edge = JoinGraphVertexSet{component_count};
+    for (auto component_idx = size_t{0}; component_idx < component_count; ++component_idx) {
+      if (components[component_idx].vertex_set.intersects(edge.vertex_set)) {
+        component_edge.set(component_idx);
+      }
+    }
+
+    if (component_edge.count() >= 2) {
+      component_edges.emplace_back(std::move(component_edge));
+    }
+  }
+
+  /**
+   * Try the exhaustive search first, as it is the common case. Otherwise, binary search for the largest vertex set
+   * size that fits into the budget (the number of CsgCmpPairs grows monotonically with the size). CsgCmpPairs of two
+   * components are bounded by the number of edges and are always enumerated, even if they exceed the budget.
+   */
+  auto result = std::pair{size_t{2}, std::vector<CsgCmpPair>{}};
+  auto min_vertex_set_size = size_t{3};
+  auto max_vertex_set_size = component_count;
+  auto vertex_set_size = component_count;
+  while (min_vertex_set_size <= max_vertex_set_size) {
+    auto csg_cmp_pairs =
+        EnumerateHyperCcp{component_count, component_edges, _max_csg_cmp_pair_count, vertex_set_size}();  // NOLINT
+    if (csg_cmp_pairs) {
+      result = {vertex_set_size, std::move(*csg_cmp_pairs)};
+      min_vertex_set_size = vertex_set_size + 1;
+    } else {
+      max_vertex_set_size = vertex_set_size - 1;
+    }
+    vertex_set_size = min_vertex_set_size + (max_vertex_set_size - min_vertex_set_size) / 2;
+  }
+
+  if (result.first == 2) {
+    result.second = *EnumerateHyperCcp{component_count, component_edges, std::numeric_limits<size_t>::max(), 2}();
+  }
+
+  return result;
+}
+
+DpHyp::BestPlans DpHyp::_evaluate_csg_cmp_pairs(const JoinGraph& join_graph, const std::vector<Component>& components,
+                                                const std::vector<CsgCmpPair>& csg_cmp_pairs) const {
+  const auto component_count = components.size();
+
+  auto best_plans = BestPlans{};
+  for (auto component_idx = size_t{0}; component_idx < component_count; ++component_idx) {
+    auto single_component_set = JoinGraphVertexSet{component_count};
+    single_component_set.set(component_idx);
+    best_plans.emplace(single_component_set, components[component_idx].plan);
+  }
+
+  // Group the CsgCmpPairs by the number of components they join. The plans of a group only depend on plans of smaller
+  // groups. Within a group, the enumeration order is kept.
+  auto csg_cmp_pairs_by_size = std::vector<std::vector<CsgCmpPair>>(component_count + 1);
+  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
+    csg_cmp_pairs_by_size[csg_cmp_pair.first.count() + csg_cmp_pair.second.count()].emplace_back(csg_cmp_pair);
+  }
+
+  for (const auto& size_csg_cmp_pairs : csg_cmp_pairs_by_size) {
+    const auto pair_count = size_csg_cmp_pairs.size();
+    if (pair_count == 0) {
+      continue;
+    }
+
+    const auto job_count = std::clamp(pair_count / MIN_CSG_CMP_PAIRS_PER_JOB, size_t{1}, _cost_estimators.size());
+    auto best_plans_per_job = std::vector<BestPlans>(job_count);
+
+    if (job_count == 1) {
+      best_plans_per_job.front() = _evaluate_csg_cmp_pair_range(join_graph, components, best_plans, size_csg_cmp_pairs,
+                                                                0, pair_count, _cost_estimators.front());
+    } else {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(job_count);
+      for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+        const auto begin = pair_count * job_idx / job_count;
+        const auto end = pair_count * (job_idx + 1) / job_count;
+        jobs.emplace_back(std::make_shared<JobTask>([&, job_idx, begin, end]() {
+          best_plans_per_job[job_idx] = _evaluate_csg_cmp_pair_range(
+              join_graph, components, best_plans, size_csg_cmp_pairs, begin, end, _cost_estimators[job_idx]);
+        }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    }
+
+    // Merge the results in the order of the jobs, so that ties are resolved as in a sequential evaluation.
+    for (auto& job_best_plans : best_plans_per_job) {
+      for (auto& [vertex_set, plan] : job_best_plans) {
+        const auto [best_plan_iter, inserted] = best_plans.try_emplace(vertex_set, plan);
+        if (!inserted && plan.cost < best_plan_iter->second.cost) {
+          best_plan_iter->second = std::move(plan);
+        }
+      }
+    }
+  }
+
+  return best_plans;
+}
+
+DpHyp::BestPlans DpHyp::_evaluate_csg_cmp_pair_range(
+    const JoinGraph& join_graph, const std::vector<Component>& components, const BestPlans& best_plans,
+    const std::vector<CsgCmpPair>& csg_cmp_pairs, const size_t begin, const size_t end,
+    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) const {
+  const auto component_count = components.size();
+  const auto vertex_count = join_graph.vertices.size();
+
+  const auto vertex_set_of_components = [&](const JoinGraphVertexSet& component_set) {
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    for (auto component_idx = component_set.find_first(); component_idx < component_count;
+         component_idx = component_set.find_next(component_idx)) {
+      vertex_set |= components[component_idx].vertex_set;
+    }
+    return vertex_set;
+  };
+
+  auto new_best_plans = BestPlans{};
+  for (auto pair_idx = begin; pair_idx < end; ++pair_idx) {
+    const auto& [csg, cmp] = csg_cmp_pairs[pair_idx];
+
+    const auto csg_plan_iter = best_plans.find(csg);
+    const auto cmp_plan_iter = best_plans.find(cmp);
+    DebugAssert(csg_plan_iter != best_plans.end() && cmp_plan_iter != best_plans.end(),
+                "Subplan missing: either the JoinGraph is invalid or EnumerateHyperCcp is buggy");
+
+    const auto join_predicates = join_graph.find_join_predicates(vertex_set_of_components(csg),
+                                                                 vertex_set_of_components(cmp));
+    auto candidate_lqp =
+        _add_join_to_plan(csg_plan_iter->second.lqp, cmp_plan_iter->second.lqp, join_predicates, cost_estimator);
+    const auto candidate_cost = cost_estimator->estimate_plan_cost(candidate_lqp);
+
+    const auto joined_component_set = csg | cmp;
+    const auto best_plan_iter = new_best_plans.find(joined_component_set);
+    if (best_plan_iter == new_best_plans.end()) {
+      new_best_plans.emplace(joined_component_set, JoinPlan{std::move(candidate_lqp), candidate_cost});
+    } else if (candidate_cost < best_plan_iter->second.cost) {
+      best_plan_iter->second = JoinPlan{std::move(candidate_lqp), candidate_cost};
+    }
+  }
+
+  return new_best_plans;
+}
+
+}  // namespace hyrise
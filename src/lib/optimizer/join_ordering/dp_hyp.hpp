@@ -0,0 +1,88 @@
+#pragma once
+
+#include <limits>
+#include <map>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "enumerate_ccp.hpp"
+#include "join_graph_edge.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm based on DPhyp, described in "Dynamic Programming Strikes Back" by Moerkotte and Neumann,
+ * https://dl.acm.org/doi/10.1145/1376616.1376672
+ *
+ * DpHyp is meant for JoinGraphs that are too large for DpCcp. Compared to DpCcp, it differs in three regards:
+ *
+ *  - Hyperedges (e.g., `a.x + b.y = c.z`) are used to connect subgraphs (see EnumerateHyperCcp). DpCcp only places
+ *    their predicates once all of their vertices happen to be joined.
+ *
+ *  - The plans of all CsgCmpPairs that join the same number of vertices only depend on plans for fewer vertices. Thus,
+ *    each such group is costed in parallel JobTasks if the scheduler is multi-threaded. Cost and cardinality estimators
+ *    (and their caches, including the JoinGraphStatisticsCache) are not thread-safe, so each job uses its own instance.
+ *
+ *  - The search is bounded: If the JoinGraph has more than `max_csg_cmp_pair_count` CsgCmpPairs, DpHyp falls back to
+ *    iterative dynamic programming (IDP-1, "Iterative Dynamic Programming: A New Class of Query Optimization
+ *    Algorithms" by Kossmann and Stocker, https://dl.acm.org/doi/10.1145/352958.352982): it finds the largest k for
+ *    which the CsgCmpPairs of at most k vertices fit into the budget, optimizes all connected subgraphs of up to k
+ *    vertices, and collapses the cheapest plan joining k vertices into a single vertex. This is repeated until the
+ *    remaining graph fits into the budget. For small JoinGraphs, the result equals the optimal plan found by DpCcp.
+ *
+ * As for DpCcp, outer, semi, and anti joins are opaque vertices of the JoinGraph (see JoinGraphBuilder).
+ */
+class DpHyp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  explicit DpHyp(const size_t init_max_csg_cmp_pair_count = DEFAULT_MAX_CSG_CMP_PAIR_COUNT);
+
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+  static constexpr auto DEFAULT_MAX_CSG_CMP_PAIR_COUNT = size_t{10'000};
+
+  // EnumerateHyperCcp represents vertex sets as 64-bit masks.
+  static constexpr auto MAX_VERTEX_COUNT = size_t{63};
+
+ private:
+  struct JoinPlan {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    Cost cost{};
+  };
+
+  // A set of JoinGraph vertices that is treated as a single vertex, either an original vertex or a set of vertices
+  // collapsed by a previous IDP iteration. DP tables are indexed by sets of components rather than by sets of vertices.
+  struct Component {
+    JoinGraphVertexSet vertex_set;
+    JoinPlan plan;
+  };
+
+  using BestPlans = std::map<JoinGraphVertexSet, JoinPlan>;
+
+  // Enumerates the CsgCmpPairs of the graph formed by `components`, limited to as many vertices per pair as the budget
+  // allows. Returns that limit and the pairs.
+  std::pair<size_t, std::vector<CsgCmpPair>> _enumerate_csg_cmp_pairs(const JoinGraph& join_graph,
+                                                                      const std::vector<Component>& components) const;
+
+  // Builds and costs the plans of all CsgCmpPairs and returns the cheapest plan for each enumerated vertex set.
+  BestPlans _evaluate_csg_cmp_pairs(const JoinGraph& join_graph, const std::vector<Component>& components,
+                                    const std::vector<CsgCmpPair>& csg_cmp_pairs) const;
+
+  // Builds and costs the plans of the pairs in [begin, end), using only plans already in `best_plans`. Returns the
+  // cheapest new plan per vertex set. Ties are resolved in favor of the earlier pair.
+  BestPlans _evaluate_csg_cmp_pair_range(const JoinGraph& join_graph, const std::vector<Component>& components,
+                                         const BestPlans& best_plans, const std::vector<CsgCmpPair>& csg_cmp_pairs,
+                                         const size_t begin, const size_t end,
+                                         const std::shared_ptr<AbstractCostEstimator>& cost_estimator) const;
+
+  const size_t _max_csg_cmp_pair_count;
+
+  // One estimator per parallel job. The first one is the estimator passed to operator().
+  std::vector<std::shared_ptr<AbstractCostEstimator>> _cost_estimators;
+};
+
+}  // namespace hyrise
@@ -0,0 +1,282 @@
+#include "enumerate_hyper_ccp.hpp"
+
+#include <bit>
+#include <set>
+
+#include "utils/assert.hpp"
+
+/**
+ * --- Glossary --- (see also enumerate_ccp.cpp)
+ *
+ * Hyperedge            An edge (u, v) between two vertex sets u and v. Binary edges are hyperedges with |u| = |v| = 1.
+ * Representative       of a vertex set: its vertex with the lowest index. The neighborhood of a subgraph contains the
+ *                      representatives of the hyperedges leaving the subgraph.
+ * B_v                  All vertices with an index lower than or equal to v
+ */
+
+namespace {
+
+using VertexMask = uint64_t;
+
+VertexMask lowest_vertex(const VertexMask vertex_set) {
+  return vertex_set & (~vertex_set + 1);
+}
+
+// All vertices with an index lower than or equal to `vertex_idx` (B_v in the paper)
+VertexMask vertices_up_to(const size_t vertex_idx) {
+  return (VertexMask{1} << (vertex_idx + 1)) - 1;
+}
+
+// Calls `functor` for all non-empty subsets of `vertex_set` in subset-first order (see
+// EnumerateCcp::_non_empty_subsets() for an explanation of the bit magic). Stops early if `functor` returns false.
+template <typename Functor>
+void for_each_non_empty_subset(const VertexMask vertex_set, const Functor& functor) {
+  if (vertex_set == 0) {
+    return;
+  }
+
+  auto subset = lowest_vertex(vertex_set);
+  while (true) {
+    if (!functor(subset)) {
+      return;
+    }
+
+    if (subset == vertex_set) {
+      return;
+    }
+
+    subset = vertex_set & (subset - vertex_set);
+  }
+}
+
+}  // namespace
+
+namespace hyrise {
+
+EnumerateHyperCcp::EnumerateHyperCcp(const size_t num_vertices, const std::vector<JoinGraphVertexSet>& edges,
+                                     const size_t max_csg_cmp_pair_count, const size_t max_vertex_set_size)
+    : _num_vertices(num_vertices),
+      _max_csg_cmp_pair_count(max_csg_cmp_pair_count),
+      _max_vertex_set_size(max_vertex_set_size),
+      _simple_neighborhoods(num_vertices) {
+  // One bit less than the mask width, so that vertices_up_to() does not overflow.
+  Assert(num_vertices < sizeof(VertexMask) * 8, "Too many vertices, EnumerateHyperCcp relies on 64-bit masks");
+  Assert(max_vertex_set_size >= 2, "CsgCmpPairs consist of at least two vertices");
+
+  for (const auto& edge : edges) {
+    Assert(edge.size() == num_vertices, "Edge does not match the number of vertices");
+
+    const auto edge_vertex_count = edge.count();
+    if (edge_vertex_count < 2) {
+      continue;
+    }
+
+    const auto edge_mask = static_cast<VertexMask>(edge.to_ulong());
+
+    if (edge_vertex_count == 2) {
+      const auto first_vertex_idx = edge.find_first();
+      const auto second_vertex_idx = edge.find_next(first_vertex_idx);
+      _simple_neighborhoods[first_vertex_idx] |= VertexMask{1} << second_vertex_idx;
+      _simple_neighborhoods[second_vertex_idx] |= VertexMask{1} << first_vertex_idx;
+      continue;
+    }
+
+    if (edge_vertex_count > MAX_HYPEREDGE_SIZE) {
+      continue;
+    }
+
+    // Materialize all ways of splitting the hyperedge into two non-empty sides. As the subset enumeration covers
+    // both `u` and its complement, both directions of each split are stored.
+    for_each_non_empty_subset(edge_mask, [&](const auto subset) {
+      if (subset != edge_mask) {
+        _complex_edges.emplace_back(subset, edge_mask & ~subset);
+      }
+      return true;
+    });
+  }
+}
+
+std::optional<std::vector<CsgCmpPair>> EnumerateHyperCcp::operator()() {
+  for (auto vertex_idx = size_t{0}; vertex_idx < _num_vertices; ++vertex_idx) {
+    _connected_subgraphs.emplace(VertexMask{1} << vertex_idx);
+  }
+
+  /**
+   * As in EnumerateCcp, iterate from the highest to the lowest vertex index and start the search for connected
+   * subgraphs and their complements from each vertex.
+   */
+  for (auto reverse_vertex_idx = size_t{0}; reverse_vertex_idx < _num_vertices; ++reverse_vertex_idx) {
+    const auto forward_vertex_idx = _num_vertices - reverse_vertex_idx - 1;
+    const auto start_vertex_set = VertexMask{1} << forward_vertex_idx;
+
+    _emit_csg(start_vertex_set);
+    _enumerate_csg_recursive(start_vertex_set, vertices_up_to(forward_vertex_idx));
+
+    if (_budget_exceeded()) {
+      return std::nullopt;
+    }
+  }
+
+  if constexpr (HYRISE_DEBUG) {
+    // Same checks as in EnumerateCcp: no duplicates, and components have been enumerated before they are used.
+    auto enumerated_subsets = std::set<JoinGraphVertexSet>{};
+    auto enumerated_ccps = std::set<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>>{};
+
+    for (auto csg_cmp_pair : _csg_cmp_pairs) {
+      Assert(csg_cmp_pair.first.count() == 1 || enumerated_subsets.contains(csg_cmp_pair.first),
+             "CSG not yet enumerated");
+      Assert(csg_cmp_pair.second.count() == 1 || enumerated_subsets.contains(csg_cmp_pair.second),
+             "CSG not yet enumerated");
+
+      enumerated_subsets.emplace(csg_cmp_pair.first | csg_cmp_pair.second);
+
+      Assert(enumerated_ccps.emplace(csg_cmp_pair).second, "Duplicate CCP was generated");
+      std::swap(csg_cmp_pair.first, csg_cmp_pair.second);
+      Assert(enumerated_ccps.emplace(csg_cmp_pair).second, "Duplicate CCP was generated");
+    }
+  }
+
+  return std::move(_csg_cmp_pairs);
+}
+
+void EnumerateHyperCcp::_emit_csg(const VertexMask csg) {
+  /**
+   * Find complements to the connected subgraph `csg`. Only complements consisting of vertices with a higher index
+   * than the lowest vertex of `csg` are considered, all others are found when the search starts from lower vertices.
+   */
+  if (static_cast<size_t>(std::popcount(csg)) >= _max_vertex_set_size) {
+    return;
+  }
+
+  const auto exclusion_set = csg | vertices_up_to(std::countr_zero(csg));
+  const auto neighborhood = _neighborhood(csg, exclusion_set);
+
+  // Iterate over the neighborhood in descending order of the vertex index
+  auto remaining_neighborhood = neighborhood;
+  while (remaining_neighborhood != 0 && !_budget_exceeded()) {
+    const auto vertex_idx = static_cast<size_t>(63 - std::countl_zero(remaining_neighborhood));
+    const auto cmp = VertexMask{1} << vertex_idx;
+    remaining_neighborhood &= ~cmp;
+
+    if (_is_connected(csg, cmp)) {
+      _emit_csg_cmp(csg, cmp);
+    }
+
+    _enumerate_cmp_recursive(csg, cmp, exclusion_set | (vertices_up_to(vertex_idx) & neighborhood));
+  }
+}
+
+void EnumerateHyperCcp::_enumerate_csg_recursive(const VertexMask csg, const VertexMask exclusion_set) {
+  /**
+   * Extend `csg` with subsets of its neighborhood. Unlike for simple graphs, not every such extension is connected:
+   * if `csg` was extended by the representative of a hyperedge, the rest of the hyperedge is still missing. Thus, only
+   * extensions known to be connected are emitted.
+   */
+  if (static_cast<size_t>(std::popcount(csg)) + 1 >= _max_vertex_set_size) {
+    return;
+  }
+
+  const auto neighborhood = _neighborhood(csg, exclusion_set);
+
+  for_each_non_empty_subset(neighborhood, [&](const auto subset) {
+    const auto extended_csg = csg | subset;
+    if (_is_known_connected_subgraph(extended_csg)) {
+      _emit_csg(extended_csg);
+    }
+    return !_budget_exceeded();
+  });
+
+  const auto extended_exclusion_set = exclusion_set | neighborhood;
+  for_each_non_empty_subset(neighborhood, [&](const auto subset) {
+    _enumerate_csg_recursive(csg | subset, extended_exclusion_set);
+    return !_budget_exceeded();
+  });
+}
+
+void EnumerateHyperCcp::_enumerate_cmp_recursive(const VertexMask csg, const VertexMask cmp,
+                                                 const VertexMask exclusion_set) {
+  /**
+   * Extend the complement `cmp` of `csg` with subsets of its neighborhood.
+   */
+  if (static_cast<size_t>(std::popcount(csg | cmp)) >= _max_vertex_set_size) {
+    return;
+  }
+
+  const auto neighborhood = _neighborhood(cmp, exclusion_set);
+
+  for_each_non_empty_subset(neighborhood, [&](const auto subset) {
+    const auto extended_cmp = cmp | subset;
+    if (_is_known_connected_subgraph(extended_cmp) && _is_connected(csg, extended_cmp)) {
+      _emit_csg_cmp(csg, extended_cmp);
+    }
+    return !_budget_exceeded();
+  });
+
+  const auto extended_exclusion_set = exclusion_set | neighborhood;
+  for_each_non_empty_subset(neighborhood, [&](const auto subset) {
+    _enumerate_cmp_recursive(csg, cmp | subset, extended_exclusion_set);
+    return !_budget_exceeded();
+  });
+}
+
+void EnumerateHyperCcp::_emit_csg_cmp(const VertexMask csg, const VertexMask cmp) {
+  const auto vertex_set = csg | cmp;
+  if (static_cast<size_t>(std::popcount(vertex_set)) > _max_vertex_set_size) {
+    return;
+  }
+
+  _connected_subgraphs.emplace(vertex_set);
+  _csg_cmp_pairs.emplace_back(JoinGraphVertexSet(_num_vertices, csg), JoinGraphVertexSet(_num_vertices, cmp));
+}
+
+EnumerateHyperCcp::VertexMask EnumerateHyperCcp::_neighborhood(const VertexMask vertex_set,
+                                                               const VertexMask exclusion_set) const {
+  auto neighborhood = VertexMask{0};
+
+  auto remaining_vertices = vertex_set;
+  while (remaining_vertices != 0) {
+    neighborhood |= _simple_neighborhoods[std::countr_zero(remaining_vertices)];
+    remaining_vertices &= remaining_vertices - 1;
+  }
+
+  const auto excluded_vertices = vertex_set | exclusion_set;
+  neighborhood &= ~excluded_vertices;
+
+  // For hyperedges, only the representative of the far side is added. Hyperedges whose far side already contains a
+  // neighbor are covered by that neighbor (they are "subsumed" in the terms of the paper).
+  for (const auto& [near_side, far_side] : _complex_edges) {
+    if ((near_side & ~vertex_set) == 0 && (far_side & excluded_vertices) == 0 && (far_side & neighborhood) == 0) {
+      neighborhood |= lowest_vertex(far_side);
+    }
+  }
+
+  return neighborhood;
+}
+
+bool EnumerateHyperCcp::_is_connected(const VertexMask vertex_set_a, const VertexMask vertex_set_b) const {
+  auto remaining_vertices = vertex_set_a;
+  while (remaining_vertices != 0) {
+    if (_simple_neighborhoods[std::countr_zero(remaining_vertices)] & vertex_set_b) {
+      return true;
+    }
+    remaining_vertices &= remaining_vertices - 1;
+  }
+
+  for (const auto& [near_side, far_side] : _complex_edges) {
+    if ((near_side & ~vertex_set_a) == 0 && (far_side & ~vertex_set_b) == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool EnumerateHyperCcp::_is_known_connected_subgraph(const VertexMask vertex_set) const {
+  return _connected_subgraphs.contains(vertex_set);
+}
+
+bool EnumerateHyperCcp::_budget_exceeded() const {
+  return _csg_cmp_pairs.size() > _max_csg_cmp_pair_count;
+}
+
+}  // namespace hyrise
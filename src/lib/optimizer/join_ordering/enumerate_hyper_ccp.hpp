@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "enumerate_ccp.hpp"
+#include "join_graph_edge.hpp"
+
+namespace hyrise {
+
+/**
+ * CsgCmpPair ("CCP") enumeration for hypergraphs as described in "Dynamic Programming Strikes Back" (DPhyp) by
+ * Moerkotte and Neumann, https://dl.acm.org/doi/10.1145/1376616.1376672
+ *
+ * In contrast to EnumerateCcp, which only considers binary edges, EnumerateHyperCcp also uses hyperedges (i.e., edges
+ * connecting more than two vertices, such as `a.x + b.y = c.z`) to connect subgraphs. An edge connecting the vertex
+ * set {a, b, c} connects two subgraphs S1 and S2 if S1 contains a non-empty part of the edge and S2 contains the rest.
+ *
+ * Input: The number of vertices and the vertex sets of the JoinGraph's edges. Local predicates (edges with a single
+ *        vertex) and uncorrelated predicates (edges without vertices) are ignored.
+ *
+ * Output: A list of CsgCmpPairs, in an order suitable for dynamic programming (see EnumerateCcp). std::nullopt if more
+ *         than `max_csg_cmp_pair_count` pairs would be enumerated. The caller can then retry with a smaller
+ *         `max_vertex_set_size`, which limits the enumeration to CsgCmpPairs with at most that many vertices in total
+ *         (as used by iterative dynamic programming, see DpHyp).
+ *
+ * Internally, vertex sets are represented as 64-bit masks instead of JoinGraphVertexSets. DPhyp needs to look up
+ * whether a vertex set is known to be connected for every enumerated subset, which is hard to do efficiently with
+ * boost::dynamic_bitset.
+ */
+class EnumerateHyperCcp final {
+ public:
+  EnumerateHyperCcp(const size_t num_vertices, const std::vector<JoinGraphVertexSet>& edges,
+                    const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max(),
+                    const size_t max_vertex_set_size = std::numeric_limits<size_t>::max());
+
+  // Corresponds to Solve in the paper
+  std::optional<std::vector<CsgCmpPair>> operator()();
+
+  // Hyperedges with more vertices than this are not used for connecting subgraphs, since all ways of splitting them
+  // into two sides are materialized. Their predicates are still placed once all of their vertices have been joined.
+  static constexpr auto MAX_HYPEREDGE_SIZE = size_t{8};
+
+ private:
+  using VertexMask = uint64_t;
+
+  // Corresponds to EmitCsg in the paper
+  void _emit_csg(const VertexMask csg);
+
+  // Corresponds to EnumerateCsgRec in the paper
+  void _enumerate_csg_recursive(const VertexMask csg, const VertexMask exclusion_set);
+
+  // Corresponds to EnumerateCmpRec in the paper
+  void _enumerate_cmp_recursive(const VertexMask csg, const VertexMask cmp, const VertexMask exclusion_set);
+
+  // Corresponds to EmitCsgCmp in the paper, without the plan construction
+  void _emit_csg_cmp(const VertexMask csg, const VertexMask cmp);
+
+  // Corresponds to N(S, X) in the paper
+  VertexMask _neighborhood(const VertexMask vertex_set, const VertexMask exclusion_set) const;
+
+  // Whether an edge (u, v) exists with u in `vertex_set_a` and v in `vertex_set_b`
+  bool _is_connected(const VertexMask vertex_set_a, const VertexMask vertex_set_b) const;
+
+  // Whether `vertex_set` is a connected subgraph that has been enumerated before (i.e., "dpTable[S] != ∅" in the paper)
+  bool _is_known_connected_subgraph(const VertexMask vertex_set) const;
+
+  bool _budget_exceeded() const;
+
+  const size_t _num_vertices;
+  const size_t _max_csg_cmp_pair_count;
+  const size_t _max_vertex_set_size;
+
+  // Neighbors via binary edges, per vertex
+  std::vector<VertexMask> _simple_neighborhoods;
+
+  // Hyperedges as (u, v) pairs. Both (u, v) and (v, u) are stored.
+  std::vector<std::pair<VertexMask, VertexMask>> _complex_edges;
+
+  std::unordered_set<VertexMask> _connected_subgraphs;
+
+  std::vector<CsgCmpPair> _csg_cmp_pairs;
+};
+
+}  // namespace hyrise
@@ -11,6 +11,7 @@
 #include "strategy/dependent_group_by_reduction_rule.hpp"
 #include "strategy/expression_reduction_rule.hpp"
 #include "strategy/in_expression_rewrite_rule.hpp"
+#include "strategy/index_join_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/join_predicate_ordering_rule.hpp"
@@ -246,6 +247,10 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_unique<IndexScanRule>());
 
+  // Run after all rules that change the inputs of joins, as the IndexJoinRule requires the index side input to be a
+  // StoredTableNode or a ValidateNode on top of one.
+  optimizer->add_rule(std::make_unique<IndexJoinRule>());
+
   optimizer->add_rule(std::make_unique<PredicateMergeRule>());
 
   return optimizer;
@@ -0,0 +1,138 @@
+#include "index_join_rule.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/index/partial_hash/partial_hash_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
+// Only if the indexed table has at least this many rows, the join is executed as an index join. For smaller tables,
+// building a hash table is cheap enough.
+constexpr float INDEX_JOIN_ROW_COUNT_THRESHOLD = 10'000.0f;
+
+// Only if we expect the probe input to have at most indexed_row_count * INDEX_JOIN_PROBE_RATIO_THRESHOLD rows, the join
+// is executed as an index join. Like the thresholds of the IndexScanRule, this value is chosen rather arbitrarily.
+constexpr float INDEX_JOIN_PROBE_RATIO_THRESHOLD = 0.01f;
+
+// Returns true if `input` is a StoredTableNode (or a ValidateNode on top of a StoredTableNode) and its table has a
+// table-level index on the column of `expression` that covers all chunks except for the last one.
+bool has_table_index(const AbstractLQPNode& input, const AbstractExpression& expression) {
+  const auto& stored_table_input = input.type == LQPNodeType::Validate ? *input.left_input() : input;
+  if (stored_table_input.type != LQPNodeType::StoredTable || expression.type != ExpressionType::LQPColumn) {
+    return false;
+  }
+
+  const auto& column_expression = static_cast<const LQPColumnExpression&>(expression);
+  if (column_expression.original_node.lock().get() != &stored_table_input) {
+    return false;
+  }
+
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(stored_table_input);
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto table_indexes = table->get_table_indexes(column_expression.original_column_id);
+  if (table_indexes.empty()) {
+    return false;
+  }
+
+  const auto indexed_chunk_count = table_indexes.front()->get_indexed_chunk_ids().size();
+  return indexed_chunk_count > 0 && indexed_chunk_count + 1 >= table->chunk_count();
+}
+
+}  // namespace
+
+namespace hyrise {
+
+std::string IndexJoinRule::name() const {
+  static const auto name = std::string{"IndexJoinRule"};
+  return name;
+}
+
+void IndexJoinRule::_apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const {
+  DebugAssert(cost_estimator, "IndexJoinRule requires cost estimator to be set");
+
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type != LQPNodeType::Join) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto join_node = std::static_pointer_cast<JoinNode>(node);
+    const auto& join_predicates = join_node->join_predicates();
+    if ((join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi) ||
+        join_predicates.size() != 1) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_predicates.front());
+    if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals ||
+        join_predicate->left_operand()->data_type() != join_predicate->right_operand()->data_type()) {
+      return LQPVisitation::VisitInputs;
+    }
+
+    const auto& cardinality_estimator = *cost_estimator->cardinality_estimator;
+    const auto index_side_candidates = join_node->join_mode == JoinMode::Semi
+                                           ? std::vector<LQPInputSide>{LQPInputSide::Right}
+                                           : std::vector<LQPInputSide>{LQPInputSide::Right, LQPInputSide::Left};
+    for (const auto index_side : index_side_candidates) {
+      auto index_input = join_node->input(index_side);
+
+      // The SemiJoinReductionRule may have reduced the index side by the probe input. As the JoinIndex only looks up
+      // the probe values anyway, we look through such a reduction and remove it if we choose the index join.
+      auto semi_join_reduction = std::shared_ptr<JoinNode>{};
+      if (index_input->type == LQPNodeType::Join) {
+        const auto input_join_node = std::static_pointer_cast<JoinNode>(index_input);
+        if (input_join_node->is_semi_reduction() && input_join_node->get_or_find_reduced_join_node() == join_node) {
+          semi_join_reduction = input_join_node;
+          index_input = input_join_node->left_input();
+        }
+      }
+
+      const auto& probe_input = join_node->input(index_side == LQPInputSide::Left ? LQPInputSide::Right
+                                                                                  : LQPInputSide::Left);
+
+      // A validated index side is a reference table, which the JoinIndex supports for Inner joins only.
+      if (index_input->type == LQPNodeType::Validate && join_node->join_mode != JoinMode::Inner) {
+        continue;
+      }
+
+      // The operands of the join predicate are not necessarily in the order of the inputs.
+      const auto& index_operand = expression_evaluable_on_lqp(join_predicate->left_operand(), *index_input)
+                                      ? join_predicate->left_operand()
+                                      : join_predicate->right_operand();
+      if (!has_table_index(*index_input, *index_operand)) {
+        continue;
+      }
+
+      const auto index_row_count = cardinality_estimator.estimate_cardinality(index_input);
+      const auto probe_row_count = cardinality_estimator.estimate_cardinality(probe_input);
+      if (index_row_count >= INDEX_JOIN_ROW_COUNT_THRESHOLD &&
+          probe_row_count <= index_row_count * INDEX_JOIN_PROBE_RATIO_THRESHOLD) {
+        if (semi_join_reduction) {
+          semi_join_reduction->set_right_input(nullptr);
+          lqp_remove_node(semi_join_reduction);
+        }
+        join_node->index_side = index_side;
+        break;
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+}  // namespace hyrise
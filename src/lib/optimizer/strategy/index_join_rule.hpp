@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace hyrise {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule finds equi-JoinNodes where one input is a StoredTableNode that has a table-level index
+ * (PartialHashIndex, see Table::create_partial_hash_index) on the join column. As tables with MVCC are always read
+ * through a ValidateNode, the input may also be a ValidateNode on top of such a StoredTableNode. If the other input is
+ * expected to be small compared to the indexed table, the rule sets the JoinNode's index_side. The LQPTranslator then
+ * creates a JoinIndex, which looks up the values of the small input in the index instead of hashing or scanning the
+ * large table. A semi join reduction of the index side (see SemiJoinReductionRule) is removed in this case.
+ *
+ * Note:
+ * Only Inner and Semi joins with a single predicate are considered. For Semi joins, the index side must be the right
+ * input and must not be validated, as the JoinIndex supports reference tables on the index side for Inner joins only.
+ * Chunks that are not covered by the index are joined using a nested loop. Thus, we only use the index if it covers
+ * all chunks of the table except for the last one, which may still be mutable.
+ */
+class IndexJoinRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+ protected:
+  void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+};
+
+}  // namespace hyrise
@@ -8,15 +8,26 @@
 
 #include "all_parameter_variant.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/key_hash/key_hash_index.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace {
+
+using namespace hyrise;  // NOLINT(build/namespaces)
+
 // Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
 // This value is kind of arbitrarily chosen, but the following paper suggests something similar:
 // Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
@@ -25,6 +36,63 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+
+// Returns the ColumnID of the stored table if the predicate is of the form `column = value`, where value is a non-NULL
+// value or a parameter.
+std::optional<ColumnID> key_lookup_column_id(const AbstractExpression& predicate,
+                                             const StoredTableNode& stored_table_node) {
+  const auto* binary_predicate = dynamic_cast<const BinaryPredicateExpression*>(&predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) {
+    return std::nullopt;
+  }
+
+  for (auto column_index = size_t{0}; column_index < 2; ++column_index) {
+    const auto& column = binary_predicate->arguments[column_index];
+    const auto& value = binary_predicate->arguments[1 - column_index];
+    if (column->type != ExpressionType::LQPColumn) {
+      continue;
+    }
+
+    const auto value_is_parameter =
+        value->type == ExpressionType::CorrelatedParameter || value->type == ExpressionType::Placeholder;
+    const auto value_is_non_null_value =
+        value->type == ExpressionType::Value && !variant_is_null(static_cast<const ValueExpression&>(*value).value);
+    if (!value_is_parameter && !value_is_non_null_value) {
+      continue;
+    }
+
+    const auto& column_expression = static_cast<const LQPColumnExpression&>(*column);
+    if (column_expression.original_node.lock().get() == &stored_table_node) {
+      return column_expression.original_column_id;
+    }
+  }
+
+  return std::nullopt;
+}
+
+// Returns true if all immutable chunks of the table are sorted by the column. In that case, the TableScan finds the
+// qualifying rows of each chunk with a binary search (see sorted_segment_search.hpp), which is as cheap as an index
+// lookup but does not need the UnionAll with a TableScan on the non-indexed chunks.
+bool is_sorted_by(const Table& table, const ColumnID column_id) {
+  auto has_immutable_chunk = false;
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) {
+      continue;
+    }
+
+    const auto& sorted_by = chunk->individually_sorted_by();
+    if (std::none_of(sorted_by.cbegin(), sorted_by.cend(),
+                     [&](const auto& sort_definition) { return sort_definition.column == column_id; })) {
+      return false;
+    }
+    has_immutable_chunk = true;
+  }
+
+  return has_immutable_chunk;
+}
+
 }  // namespace
 
 namespace hyrise {
@@ -38,8 +106,10 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(lqp_root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  _apply_key_index_lookups(lqp_root);
+
   visit_lqp(lqp_root, [&](const auto& node) {
-    if (node->type == LQPNodeType::Predicate) {
+    if (node->type == LQPNodeType::Predicate && static_cast<PredicateNode&>(*node).scan_type == ScanType::TableScan) {
       const auto& child = node->left_input();
 
       if (child->type == LQPNodeType::StoredTable) {
@@ -50,6 +120,7 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
         for (const auto& index_statistics : indexes_statistics) {
           if (_is_index_scan_applicable(index_statistics, predicate_node)) {
             predicate_node->scan_type = ScanType::IndexScan;
+            break;
           }
         }
       }
@@ -59,13 +130,82 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   });
 }
 
+void IndexScanRule::_apply_key_index_lookups(const std::shared_ptr<AbstractLQPNode>& lqp_root) {
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(lqp_root, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& stored_table_node : stored_table_nodes) {
+    const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+    const auto key_hash_indexes = table->key_hash_indexes();
+    if (key_hash_indexes.empty()) {
+      continue;
+    }
+
+    // Collect the equality predicates on columns of the stored table from the chain of PredicateNodes and ValidateNodes
+    // above the StoredTableNode. We only walk up nodes with a single output so that moving the predicates down does
+    // not affect other consumers.
+    auto key_predicate_nodes = std::unordered_map<ColumnID, std::shared_ptr<PredicateNode>>{};
+    auto node = std::shared_ptr<AbstractLQPNode>{stored_table_node};
+    while (node->output_count() == 1) {
+      node = node->outputs().front();
+      if (node->type == LQPNodeType::Validate) {
+        continue;
+      }
+
+      if (node->type != LQPNodeType::Predicate) {
+        break;
+      }
+
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      if (predicate_node->scan_type != ScanType::TableScan) {
+        break;
+      }
+
+      const auto column_id = key_lookup_column_id(*predicate_node->predicate(), *stored_table_node);
+      if (column_id) {
+        key_predicate_nodes.try_emplace(*column_id, predicate_node);
+      }
+    }
+
+    // Replace the predicates on the columns of the first fully covered index with a single KeyIndexLookup predicate
+    // directly above the StoredTableNode. As it yields all matching rows regardless of their visibility, it is placed
+    // below a potential ValidateNode.
+    for (const auto& key_hash_index : key_hash_indexes) {
+      const auto& column_ids = key_hash_index->column_ids();
+      if (!std::all_of(column_ids.cbegin(), column_ids.cend(),
+                       [&](const auto column_id) { return key_predicate_nodes.contains(column_id); })) {
+        continue;
+      }
+
+      auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+      predicates.reserve(column_ids.size());
+      for (const auto column_id : column_ids) {
+        const auto& predicate_node = key_predicate_nodes.at(column_id);
+        predicates.emplace_back(predicate_node->predicate());
+        lqp_remove_node(predicate_node);
+      }
+
+      const auto key_index_lookup_node =
+          PredicateNode::make(inflate_logical_expressions(predicates, LogicalOperator::And));
+      key_index_lookup_node->scan_type = ScanType::KeyIndexLookup;
+      lqp_insert_node_above(stored_table_node, key_index_lookup_node);
+      break;
+    }
+  }
+}
+
 bool IndexScanRule::_is_index_scan_applicable(const ChunkIndexStatistics& index_statistics,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) {
     return false;
   }
 
-  if (index_statistics.type != ChunkIndexType::GroupKey) {
+  if (!is_ordered_index_type(index_statistics.type)) {
     return false;
   }
 
@@ -86,6 +226,15 @@ bool IndexScanRule::_is_index_scan_applicable(const ChunkIndexStatistics& index_
     return false;
   }
 
+  // The column IDs of the predicate refer to the (possibly pruned) output of the StoredTableNode.
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(*predicate_node->left_input());
+  const auto& column_expression = static_cast<const LQPColumnExpression&>(
+      *stored_table_node.output_expressions()[operator_predicate.column_id]);
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  if (is_sorted_by(*table, column_expression.original_column_id)) {
+    return false;
+  }
+
   const auto row_count_table =
       cost_estimator->cardinality_estimator->estimate_cardinality(predicate_node->left_input());
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) {
@@ -102,4 +251,9 @@ bool IndexScanRule::_is_single_segment_index(const ChunkIndexStatistics& index_s
   return index_statistics.column_ids.size() == 1;
 }
 
+bool IndexScanRule::is_ordered_index_type(const ChunkIndexType index_type) {
+  return index_type == ChunkIndexType::GroupKey || index_type == ChunkIndexType::AdaptiveRadixTree ||
+         index_type == ChunkIndexType::BTree;
+}
+
 }  // namespace hyrise
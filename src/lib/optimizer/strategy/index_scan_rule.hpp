@@ -22,15 +22,28 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * All ordered single-column indexes (GroupKey, AdaptiveRadixTree, and BTree) are supported. As they answer range
+ * predicates with two bound lookups, BETWEEN, <, >, and prefix LIKEs (rewritten to BETWEEN by the
+ * ExpressionReductionRule) qualify as well. If all chunks are sorted by the predicate column, the TableScan already
+ * uses a binary search per chunk and we keep it.
+ *
+ * Furthermore, if a table has KeyHashIndexes (see Table::create_key_hash_index), equality predicates on all columns of
+ * such an index are combined into a single PredicateNode with the ScanType KeyIndexLookup. The predicates can be spread
+ * across a chain of PredicateNodes and ValidateNodes above the StoredTableNode; the new PredicateNode is placed
+ * directly above the StoredTableNode. This way, point lookups on primary keys do not scan the table, including its
+ * mutable chunks.
  */
 
 class IndexScanRule : public AbstractRule {
  public:
   std::string name() const override;
 
+  // Returns true for index types that can answer range predicates, i.e., that are supported by the IndexScan.
+  static bool is_ordered_index_type(const ChunkIndexType index_type);
+
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+  static void _apply_key_index_lookups(const std::shared_ptr<AbstractLQPNode>& lqp_root);
   bool _is_index_scan_applicable(const ChunkIndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const ChunkIndexStatistics& index_statistics);
@@ -2,14 +2,17 @@
 
 #include "cost_estimation/abstract_cost_estimator.hpp"
 #include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
+#include "utils/settings/unsigned_integer_setting.hpp"
 
 namespace hyrise {
 
@@ -70,16 +73,23 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
 
   /**
    * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Simple heuristic: Use DpCcp for any query with less than X tables, DpHyp (which limits its search space) for up to
+   * DpHyp::MAX_VERTEX_COUNT tables, and GOO for everything more complex.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
+  const auto dp_vertex_threshold =
+      UnsignedIntegerSetting::value_or_default(DP_VERTEX_THRESHOLD_SETTING, DEFAULT_DP_VERTEX_THRESHOLD);
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  DebugAssert(!join_graph->vertices.empty(), "There should be nodes in the join graph.");
-  if (join_graph->vertices.size() == 1) {
+  const auto vertex_count = join_graph->vertices.size();
+  DebugAssert(vertex_count > 0, "There should be nodes in the join graph.");
+  if (vertex_count == 1) {
     // a join graph with only one vertex is no actual join and needs no ordering
     result_lqp = lqp;
-  } else if (join_graph->vertices.size() < 9) {
+  } else if (vertex_count < dp_vertex_threshold) {
     result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+  } else if (vertex_count <= DpHyp::MAX_VERTEX_COUNT) {
+    const auto max_csg_cmp_pair_count =
+        UnsignedIntegerSetting::value_or_default(MAX_CSG_CMP_PAIRS_SETTING, DpHyp::DEFAULT_MAX_CSG_CMP_PAIR_COUNT);
+    result_lqp = DpHyp{max_csg_cmp_pair_count}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
     result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
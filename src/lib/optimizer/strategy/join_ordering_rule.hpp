@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "abstract_rule.hpp"
 
@@ -10,12 +11,21 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified. Small JoinGraphs are ordered with DpCcp, larger ones with DpHyp
+ * (with a bounded search space) and GreedyOperatorOrdering if they are too large for DpHyp. The thresholds can be
+ * changed via the settings below (see also the meta_settings table).
  */
 class JoinOrderingRule : public AbstractRule {
  public:
   std::string name() const override;
 
+  // JoinGraphs with fewer vertices than this are ordered with DpCcp.
+  static constexpr auto DP_VERTEX_THRESHOLD_SETTING = "JoinOrderingRule.dp_vertex_threshold";
+  static constexpr auto DEFAULT_DP_VERTEX_THRESHOLD = uint64_t{9};
+
+  // Number of CsgCmpPairs DpHyp evaluates before falling back to iterative dynamic programming.
+  static constexpr auto MAX_CSG_CMP_PAIRS_SETTING = "JoinOrderingRule.max_csg_cmp_pairs";
+
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
 
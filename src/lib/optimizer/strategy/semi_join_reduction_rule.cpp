@@ -69,10 +69,20 @@ void SemiJoinReductionRule::_apply_to_plan_without_subqueries(const std::shared_
         // While semi join reductions might not be immediately beneficial if the original cardinality is low, remember
         // that they might be pushed down in the LQP to a point where they are more beneficial (e.g., below an
         // Aggregate).
-        if (original_cardinality == 0 || (reduced_cardinality / original_cardinality) > MINIMUM_SELECTIVITY) {
+        if (original_cardinality == 0 ||
+            (reduced_cardinality / original_cardinality) > MINIMUM_SELECTIVITY_FOR_RUNTIME_FILTER) {
           return;
         }
 
+        // Reductions that remove fewer tuples are not worth a semi join. Instead, they use a runtime filter, which is
+        // cheaper but requires both join columns to have the same data type.
+        if ((reduced_cardinality / original_cardinality) > MINIMUM_SELECTIVITY) {
+          if (predicate_expression->left_operand()->data_type() != predicate_expression->right_operand()->data_type()) {
+            return;
+          }
+          semi_join_reduction_node->use_runtime_filter = true;
+        }
+
         // For `t1 JOIN t2 on t1.a = t2.a` where a semi join reduction is supposed to be added to t1, `t1.a = t2.a`
         // is the predicate_expression. The values from t1 are supposed to be filtered by looking at t1.a, which is
         // called the reducer_side_expression.
@@ -41,6 +41,14 @@ class PredicateNode;
  * into play. Also, predicates might be based on projections and/or joined columns, which makes propagation even more
  * complex. The approach chosen here is more flexible in that it works independently of the predicate's complexity.
  * However, different from a predicate propagation approach, it does not allow us to prune on the reduced side.
+ *
+ * Semi join reductions are executed as full semi joins (i.e., a hash join). Reductions that remove fewer tuples are not
+ * worth that effort. Still, they can pay off if they are cheap. For these reductions, we do not execute a semi join.
+ * Instead, the LQPTranslator creates a TableScan that filters the reduced input using a RuntimeFilter (i.e., the min,
+ * max, and a Bloom filter of the reducer's values). The TableScan prunes chunks whose values are outside of the
+ * reducer's range and removes rows whose values are not in the Bloom filter. Where possible, the filter is applied by
+ * the TableScan of an existing predicate on the reduced side. Runtime filters are not exact, but this is fine as semi
+ * join reductions do not change the final result anyway.
 **/
 
 class SemiJoinReductionRule : public AbstractRule {
@@ -51,6 +59,10 @@ class SemiJoinReductionRule : public AbstractRule {
   // input cardinality `i`, the output cardinality of the semi join has to be lower than `i * MINIMUM_SELECTIVITY`.
   constexpr static auto MINIMUM_SELECTIVITY = .25;
 
+  // Semi join reductions with a selectivity between MINIMUM_SELECTIVITY and MINIMUM_SELECTIVITY_FOR_RUNTIME_FILTER are
+  // executed using runtime filters. This requires both join columns to have the same data type.
+  constexpr static auto MINIMUM_SELECTIVITY_FOR_RUNTIME_FILTER = .75;
+
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
 };
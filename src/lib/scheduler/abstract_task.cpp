@@ -82,6 +82,15 @@ void AbstractTask::set_node_id(NodeID node_id) {
   _node_id = node_id;
 }
 
+void AbstractTask::set_preferred_node_id(const NodeID preferred_node_id) {
+  DebugAssert(!is_scheduled(), "Preferred node must be set before the task is scheduled.");
+  _preferred_node_id = preferred_node_id;
+}
+
+NodeID AbstractTask::preferred_node_id() const {
+  return _preferred_node_id;
+}
+
 bool AbstractTask::try_mark_as_enqueued() {
   return _try_transition_to(TaskState::Enqueued);
 }
@@ -110,6 +119,9 @@ void AbstractTask::schedule(NodeID preferred_node_id) {
     return;
   }
 
+  if (preferred_node_id == CURRENT_NODE_ID) {
+    preferred_node_id = _preferred_node_id;
+  }
   Hyrise::get().scheduler()->schedule(shared_from_this(), preferred_node_id, _priority);
 }
 
@@ -140,6 +140,14 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void set_node_id(NodeID node_id);
 
+  /**
+   * Node on which the task should be executed, e.g., the NUMA node of the chunk that it processes (see
+   * Chunk::numa_node_id()). It is used if the task is scheduled without an explicit node. The task might still be
+   * stolen by workers of other nodes. Must be set before the task is scheduled.
+   */
+  void set_preferred_node_id(const NodeID preferred_node_id);
+  NodeID preferred_node_id() const;
+
   /**
    * Callback to be executed right after the task finished. Notice the execution of the callback might happen on ANY
    * thread.
@@ -197,6 +205,7 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id{INVALID_NODE_ID};
+  NodeID _preferred_node_id{CURRENT_NODE_ID};
   SchedulePriority _priority;
   std::atomic_bool _stealable;
   std::function<void()> _done_callback;
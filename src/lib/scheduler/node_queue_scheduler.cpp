@@ -2,6 +2,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -130,7 +131,8 @@ NodeID NodeQueueScheduler::determine_queue_id(const NodeID preferred_node_id) co
     return NodeID{0};
   }
 
-  if (preferred_node_id != CURRENT_NODE_ID) {
+  // Chunks might have been placed on more nodes than there are queues (e.g., if the topology changed).
+  if (preferred_node_id != CURRENT_NODE_ID && preferred_node_id < _queue_count) {
     return preferred_node_id;
   }
 
@@ -167,25 +169,21 @@ void NodeQueueScheduler::_group_tasks(const std::vector<std::shared_ptr<Abstract
   //
   // Approach: Skip all tasks that already have predecessors or successors, as adding relationships to these could
   // introduce cyclic dependencies. Again, this is far from perfect, but better than not grouping the tasks.
+  //
+  // Only tasks that prefer the same node (e.g., because they process chunks placed on the same NUMA node) are grouped,
+  // as the tasks of a group will likely be executed on the same Worker (see Worker::execute_next).
 
-  auto round_robin_counter = 0;
-  auto common_node_id = std::optional<NodeID>{};
-
-  std::vector<std::shared_ptr<AbstractTask>> grouped_tasks(NUM_GROUPS);
+  auto round_robin_counters = std::unordered_map<NodeID, size_t>{};
+  auto grouped_tasks_by_node = std::unordered_map<NodeID, std::vector<std::shared_ptr<AbstractTask>>>{};
   for (const auto& task : tasks) {
     if (!task->predecessors().empty() || !task->successors().empty()) {
       return;
     }
 
-    if (common_node_id) {
-      // This is not really a hard assertion. As the chain will likely be executed on the same Worker (see
-      // Worker::execute_next), we would ignore all but the first node_id. At the time of writing, we did not do any
-      // smart node assignment. This assertion is only here so that this behavior is understood if we ever assign NUMA
-      // node ids.
-      DebugAssert(task->node_id() == *common_node_id, "Expected all grouped tasks to have the same node_id");
-    } else {
-      common_node_id = task->node_id();
-    }
+    const auto node_id = task->preferred_node_id();
+    auto& round_robin_counter = round_robin_counters[node_id];
+    // The groups of a node are allocated once, when the node's first task is seen.
+    auto& grouped_tasks = grouped_tasks_by_node.try_emplace(node_id, NUM_GROUPS).first->second;
 
     const auto group_id = round_robin_counter % NUM_GROUPS;
     const auto& first_task_in_group = grouped_tasks[group_id];
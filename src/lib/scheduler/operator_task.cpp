@@ -6,6 +6,7 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/limit.hpp"
 
 #include "scheduler/job_task.hpp"
 
@@ -13,6 +14,39 @@ namespace {
 
 using namespace hyrise;  // NOLINT
 
+/**
+ * Sets the row limit of a Limit's input (see AbstractOperator::set_row_limit). Operators that produce one output row
+ * per input row pass it on to their inputs. The limit is not set for operators that have other consumers, which need
+ * the complete output.
+ */
+void push_down_row_limit(const std::shared_ptr<AbstractOperator>& op, const size_t row_limit) {
+  if (op->consumer_count() != 1 || op->state() != OperatorState::Created) {
+    return;
+  }
+
+  switch (op->type()) {
+    case OperatorType::Projection:
+      op->set_row_limit(row_limit);
+      push_down_row_limit(op->mutable_left_input(), row_limit);
+      return;
+
+    case OperatorType::UnionAll:
+      op->set_row_limit(row_limit);
+      push_down_row_limit(op->mutable_left_input(), row_limit);
+      push_down_row_limit(op->mutable_right_input(), row_limit);
+      return;
+
+    case OperatorType::MorselPipeline:
+    case OperatorType::TableScan:
+    case OperatorType::Validate:
+      op->set_row_limit(row_limit);
+      return;
+
+    default:
+      return;
+  }
+}
+
 /**
  * Create tasks recursively. Called by `make_tasks_from_operator`.
  * @returns the root of the subtree that was added.
@@ -28,6 +62,12 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
     return task;
   }
 
+  if (op->type() == OperatorType::Limit && op->state() == OperatorState::Created) {
+    if (const auto row_count = static_cast<const Limit&>(*op).constant_row_count()) {
+      push_down_row_limit(op->mutable_left_input(), *row_count);
+    }
+  }
+
   if (auto left = op->mutable_left_input()) {
     const auto& left_subtree_root = add_operator_tasks_recursively(left, tasks);
     left_subtree_root->set_as_predecessor_of(task);
@@ -170,8 +170,9 @@ void Session::_handle_bind_command() {
 void Session::_sync() {
   _postgres_protocol_handler->read_sync_packet();
   if (_transaction_context) {
-    _transaction_context->commit();
+    const auto committed = _transaction_context->commit();
     _transaction_context.reset();
+    AssertInput(committed, "Transaction was rolled back because it violates a key constraint.");
   }
   _postgres_protocol_handler->send_ready_for_query();
 }
@@ -11,6 +11,11 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelined_execution(const UsePipelinedExecution use_pipelined_execution) {
+  _use_pipelined_execution = use_pipelined_execution;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::with_optimizer(const std::shared_ptr<Optimizer>& optimizer) {
   _optimizer = optimizer;
   return *this;
@@ -40,7 +45,8 @@ SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, _use_pipelined_execution, optimizer, _pqp_cache,
+                              _lqp_cache);
   return pipeline;
 }
 
@@ -28,6 +28,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - Pipelined execution is disabled, i.e., chains of scans, validates, and projections are not executed morsel-wise
+ *    (see MorselPipeline).
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -38,6 +40,7 @@ class SQLPipelineBuilder final {
   explicit SQLPipelineBuilder(const std::string& sql);
 
   SQLPipelineBuilder& with_mvcc(const UseMvcc use_mvcc);
+  SQLPipelineBuilder& with_pipelined_execution(const UsePipelinedExecution use_pipelined_execution);
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
@@ -54,6 +57,7 @@ class SQLPipelineBuilder final {
   const std::string _sql;
 
   UseMvcc _use_mvcc{UseMvcc::Yes};
+  UsePipelinedExecution _use_pipelined_execution{UsePipelinedExecution::No};
   std::shared_ptr<TransactionContext> _transaction_context;
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
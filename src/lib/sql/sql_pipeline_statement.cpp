@@ -12,6 +12,7 @@
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "memory/arena_memory_resource.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -19,6 +20,7 @@
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
+#include "operators/morsel_pipeline.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/job_task.hpp"
 #include "sql/sql_pipeline_builder.hpp"
@@ -29,13 +31,15 @@
 namespace hyrise {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
+                                           const UseMvcc use_mvcc, const UsePipelinedExecution use_pipelined_execution,
+                                           const std::shared_ptr<Optimizer>& optimizer,
                                            const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
                                            const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _use_pipelined_execution(use_pipelined_execution),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
@@ -197,11 +201,21 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     _physical_plan->set_transaction_context_recursively(_transaction_context);
   }
 
+  // Operator-internal allocations of this statement are served from an arena that is released after the execution.
+  _memory_resource = std::make_shared<ArenaMemoryResource>();
+  _physical_plan->set_memory_resource_recursively(_memory_resource);
+
   // Cache newly created plan for the according sql statement (only if not already cached)
   if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
     pqp_cache->set(_sql_string, _physical_plan);
   }
 
+  // The cache holds the plan without pipelines, so that the setting can differ between executions of the same query.
+  // The copies of the operators keep their transaction context.
+  if (_use_pipelined_execution == UsePipelinedExecution::Yes) {
+    _physical_plan = MorselPipeline::create_pipelines(_physical_plan);
+  }
+
   _metrics->lqp_translation_duration = done - started;
 
   return _physical_plan;
@@ -236,7 +250,13 @@ std::vector<std::shared_ptr<AbstractTask>> SQLPipelineStatement::_get_transactio
     case hsql::kCommitTransaction:
       AssertInput(_transaction_context && !_transaction_context->is_auto_commit(),
                   "Cannot commit since there is no active transaction.");
-      return {std::make_shared<JobTask>([this] { _transaction_context->commit(); })};
+      return {std::make_shared<JobTask>([this] {
+        // If the commit fails because of a constraint violation, the transaction has been rolled back as conflicted
+        // and get_result_table() reports the statement as failed.
+        const auto committed = _transaction_context->commit();
+        Assert(committed || _transaction_context->phase() == TransactionPhase::RolledBackAfterConflict,
+               "Failed commit did not roll back the transaction.");
+      })};
     case hsql::kRollbackTransaction:
       AssertInput(_transaction_context && !_transaction_context->is_auto_commit(),
                   "Cannot rollback since there is no active transaction.");
@@ -274,12 +294,16 @@ std::pair<SQLPipelineStatus, const std::shared_ptr<const Table>&> SQLPipelineSta
 
   Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
 
+  // All operators have been executed, so their internal allocations can be released at once.
+  _memory_resource.reset();
+
   if (has_failed()) {
     return {SQLPipelineStatus::Failure, _result_table};
   }
 
-  if (_use_mvcc == UseMvcc::Yes && _transaction_context->is_auto_commit()) {
-    _transaction_context->commit();
+  // The commit fails if the statement violates a key constraint that is enforced at commit time.
+  if (_use_mvcc == UseMvcc::Yes && _transaction_context->is_auto_commit() && !_transaction_context->commit()) {
+    return {SQLPipelineStatus::Failure, _result_table};
   }
 
   if (_transaction_context) {
@@ -17,6 +17,8 @@
 
 namespace hyrise {
 
+class ArenaMemoryResource;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translation_duration{};
@@ -55,7 +57,8 @@ class SQLPipelineStatement : public Noncopyable {
  public:
   // Prefer using the SQLPipelineBuilder for constructing SQLPipelineStatements conveniently
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                       const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
+                       const UseMvcc use_mvcc, const UsePipelinedExecution use_pipelined_execution,
+                       const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
                        const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
 
@@ -116,6 +119,7 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const UsePipelinedExecution _use_pipelined_execution;
 
   const std::shared_ptr<Optimizer> _optimizer;
 
@@ -129,6 +133,10 @@ class SQLPipelineStatement : public Noncopyable {
   std::vector<std::shared_ptr<AbstractTask>> _tasks;
 
   std::shared_ptr<const Table> _result_table;
+
+  // Memory resource for the operator-internal allocations of the physical plan (see
+  // AbstractOperator::memory_resource()). Released once the plan has been executed.
+  std::shared_ptr<ArenaMemoryResource> _memory_resource;
   // Assume there is an output table. Only change if nullptr is returned from execution.
   bool _query_has_output{true};
   SQLTranslationInfo _translation_info;
@@ -97,6 +97,10 @@ std::shared_ptr<MvccData> Chunk::mvcc_data() const {
   return _mvcc_data;
 }
 
+bool Chunk::has_indexes() const {
+  return !_indexes.empty();
+}
+
 std::vector<std::shared_ptr<AbstractChunkIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
   auto result = std::vector<std::shared_ptr<AbstractChunkIndex>>();
@@ -113,9 +117,14 @@ void Chunk::finalize() {
   if (has_mvcc_data() && !_mvcc_data->max_begin_cid) {
     const auto chunk_size = size();
     Assert(chunk_size > 0, "finalize() should not be called on an empty chunk");
-    _mvcc_data->max_begin_cid = CommitID{0};
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      _mvcc_data->max_begin_cid = std::max(*_mvcc_data->max_begin_cid, _mvcc_data->get_begin_cid(chunk_offset));
+    if (const auto uniform_begin_cid = _mvcc_data->uniform_begin_cid()) {
+      // All rows share the begin CID (e.g., bulk-loaded chunks), so we do not need to look at them one by one.
+      _mvcc_data->max_begin_cid = *uniform_begin_cid;
+    } else {
+      _mvcc_data->max_begin_cid = CommitID{0};
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        _mvcc_data->max_begin_cid = std::max(*_mvcc_data->max_begin_cid, _mvcc_data->get_begin_cid(chunk_offset));
+      }
     }
 
     Assert(_mvcc_data->max_begin_cid != MvccData::MAX_COMMIT_ID,
@@ -124,6 +133,11 @@ void Chunk::finalize() {
   }
 }
 
+void Chunk::set_immutable() {
+  Assert(is_mutable(), "Chunk is already immutable.");
+  _is_mutable = false;
+}
+
 std::vector<std::shared_ptr<AbstractChunkIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
   auto segments = _get_segments_for_ids(column_ids);
   return get_indexes(segments);
@@ -182,7 +196,7 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indexes is not implemented yet.
-  if (!_indexes.empty()) {
+  if (has_indexes()) {
     Fail("Cannot migrate Chunk with Indexes.");
   }
 
@@ -194,6 +208,14 @@ void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   _segments = std::move(new_segments);
 }
 
+std::optional<NodeID> Chunk::numa_node_id() const {
+  return _numa_node_id;
+}
+
+void Chunk::set_numa_node_id(const NodeID numa_node_id) {
+  _numa_node_id = numa_node_id;
+}
+
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const {
   return _alloc;
 }
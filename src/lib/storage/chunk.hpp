@@ -87,6 +87,8 @@ class Chunk : private Noncopyable {
 
   std::shared_ptr<MvccData> mvcc_data() const;
 
+  bool has_indexes() const;
+
   std::vector<std::shared_ptr<AbstractChunkIndex>> get_indexes(
       const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
   std::vector<std::shared_ptr<AbstractChunkIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
@@ -121,6 +123,16 @@ class Chunk : private Noncopyable {
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
+  /**
+   * NUMA node on which the data of the chunk is placed (see place_chunks_on_numa_nodes()). Operators schedule the jobs
+   * that process the chunk on this node. Chunks that reference a placed chunk (e.g., the output of a TableScan) inherit
+   * its node. Not set for chunks that have not been placed.
+   * @{
+   */
+  std::optional<NodeID> numa_node_id() const;
+  void set_numa_node_id(const NodeID numa_node_id);
+  /** @} */
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -186,6 +198,13 @@ class Chunk : private Noncopyable {
    */
   void finalize();
 
+  /**
+   * Makes the chunk immutable without finalizing its MVCC data. This is used for chunks whose segments cannot grow
+   * (e.g., because they are shared with another chunk, see Insert) while their rows are not yet committed. Setting
+   * max_begin_cid once the rows are committed or rolled back is the inserter's responsibility.
+   */
+  void set_immutable();
+
  private:
   std::vector<std::shared_ptr<const AbstractSegment>> _get_segments_for_ids(
       const std::vector<ColumnID>& column_ids) const;
@@ -196,6 +215,7 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccData> _mvcc_data;
   Indexes _indexes;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
+  std::optional<NodeID> _numa_node_id;
   bool _is_mutable = true;
   std::vector<SortColumnDefinition> _sorted_by;
   mutable std::atomic<ChunkOffset::base_type> _invalid_row_count{ChunkOffset::base_type{0}};
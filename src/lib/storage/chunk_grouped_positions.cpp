@@ -0,0 +1,100 @@
+#include "chunk_grouped_positions.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+size_t ChunkGroupedPositions::memory_usage() const {
+  return sizeof(*this) + chunk_ids.capacity() * sizeof(ChunkID) + run_ends.capacity() * sizeof(ChunkOffset) +
+         chunk_offsets.capacity() * sizeof(ChunkOffset) + original_positions.capacity() * sizeof(ChunkOffset) +
+         null_positions.capacity() * sizeof(ChunkOffset);
+}
+
+ChunkGroupedPositions group_positions_by_chunk_id(const std::shared_ptr<const AbstractPosList>& pos_list,
+                                                  const size_t referenced_chunk_count) {
+  Assert(pos_list, "Cannot group positions of a nullptr.");
+  Assert(pos_list->size() <= std::numeric_limits<ChunkOffset::base_type>::max(),
+         "PosList is too large to store its positions as ChunkOffsets.");
+
+  auto grouped_positions = ChunkGroupedPositions{};
+
+  resolve_pos_list_type(pos_list, [&](const auto& resolved_pos_list) {
+    // First pass: count the positions per referenced chunk and collect the NULL positions.
+    auto position_counts = std::vector<ChunkOffset::base_type>(referenced_chunk_count);
+    auto original_position = ChunkOffset{0};
+    for (const auto row_id : *resolved_pos_list) {
+      if (row_id.is_null()) {
+        grouped_positions.null_positions.emplace_back(original_position);
+      } else {
+        DebugAssert(row_id.chunk_id < referenced_chunk_count, "RowID references a chunk that does not exist.");
+        ++position_counts[row_id.chunk_id];
+      }
+      ++original_position;
+    }
+
+    // Create a run for every referenced chunk. From now on, position_counts holds the next write position of a chunk.
+    auto run_end = ChunkOffset{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+      const auto position_count = position_counts[chunk_id];
+      if (position_count == 0) {
+        continue;
+      }
+
+      position_counts[chunk_id] = run_end;
+      run_end += position_count;
+      grouped_positions.chunk_ids.emplace_back(chunk_id);
+      grouped_positions.run_ends.emplace_back(run_end);
+    }
+
+    // Second pass: scatter the positions into their runs.
+    grouped_positions.chunk_offsets.resize(run_end);
+    grouped_positions.original_positions.resize(run_end);
+    original_position = ChunkOffset{0};
+    for (const auto row_id : *resolved_pos_list) {
+      if (!row_id.is_null()) {
+        const auto write_position = position_counts[row_id.chunk_id]++;
+        grouped_positions.chunk_offsets[write_position] = row_id.chunk_offset;
+        grouped_positions.original_positions[write_position] = original_position;
+      }
+      ++original_position;
+    }
+  });
+
+  // Sort the ChunkOffsets within each run. Runs are usually already sorted (e.g., if the PosList was created by a
+  // TableScan), so we only sort the runs that are not.
+  const auto run_count = grouped_positions.chunk_ids.size();
+  auto run_positions = std::vector<std::pair<ChunkOffset, ChunkOffset>>{};
+  for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+    const auto chunk_offsets_begin = grouped_positions.chunk_offsets.begin() + grouped_positions.run_begin(run_index);
+    const auto chunk_offsets_end = grouped_positions.chunk_offsets.begin() + grouped_positions.run_ends[run_index];
+    if (std::is_sorted(chunk_offsets_begin, chunk_offsets_end)) {
+      continue;
+    }
+
+    const auto original_positions_begin =
+        grouped_positions.original_positions.begin() + grouped_positions.run_begin(run_index);
+    run_positions.clear();
+    std::transform(chunk_offsets_begin, chunk_offsets_end, original_positions_begin, std::back_inserter(run_positions),
+                   [](const auto chunk_offset, const auto original_position) {
+                     return std::pair{chunk_offset, original_position};
+                   });
+    std::sort(run_positions.begin(), run_positions.end());
+
+    std::transform(run_positions.begin(), run_positions.end(), chunk_offsets_begin,
+                   [](const auto& run_position) { return run_position.first; });
+    std::transform(run_positions.begin(), run_positions.end(), original_positions_begin,
+                   [](const auto& run_position) { return run_position.second; });
+  }
+
+  return grouped_positions;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/pos_lists/abstract_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+// A compact representation of a PosList in which the positions are grouped by their ChunkID. It is used to dereference
+// the positions chunk by chunk instead of jumping between the referenced chunks for every position. Instead of a RowID
+// (8 bytes) per position, only the 32-bit ChunkOffsets are stored, while the ChunkIDs are run-length encoded (one entry
+// per referenced chunk). Within a run, the ChunkOffsets are sorted so that the referenced segment is accessed in
+// order. For each position, we keep its index in the original PosList so that the dereferenced values can be written
+// to the correct positions. NULL positions (as, e.g., emitted by outer joins) are only stored by their index.
+//
+// For example, grouping [(1,3), (0,2), NULL, (1,2)] gives us the ChunkIDs [0, 1] with the run ends [1, 3], the
+// ChunkOffsets [2, 2, 3], the original positions [1, 3, 0], and the NULL positions [2].
+struct ChunkGroupedPositions {
+  // Index of the first position of the run with the given index.
+  ChunkOffset run_begin(const size_t run_index) const {
+    return run_index == 0 ? ChunkOffset{0} : run_ends[run_index - 1];
+  }
+
+  size_t memory_usage() const;
+
+  std::vector<ChunkID> chunk_ids;
+  std::vector<ChunkOffset> run_ends;
+  std::vector<ChunkOffset> chunk_offsets;
+  std::vector<ChunkOffset> original_positions;
+  std::vector<ChunkOffset> null_positions;
+};
+
+// Groups the positions of a PosList that references a table with `referenced_chunk_count` chunks using a counting sort
+// by ChunkID. Unlike split_pos_list_by_chunk_id, this does not create a PosList per referenced chunk.
+ChunkGroupedPositions group_positions_by_chunk_id(const std::shared_ptr<const AbstractPosList>& pos_list,
+                                                  const size_t referenced_chunk_count);
+
+}  // namespace hyrise
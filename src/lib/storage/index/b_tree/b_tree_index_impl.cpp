@@ -65,7 +65,7 @@ template <typename DataType>
 void BTreeIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const AbstractSegment>& segment,
                                             std::vector<ChunkOffset>& null_positions) {
   std::vector<std::pair<ChunkOffset, DataType>> values;
-  null_positions.reserve(values.size());
+  values.reserve(segment->size());
 
   // Materialize
   segment_iterate<DataType>(*segment, [&](const auto& position) {
@@ -82,21 +82,24 @@ void BTreeIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const Abstract
     return;
   }
 
-  // Sort
-  std::sort(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
+  // Sort. Keeping the chunk offsets of equal values in ascending order lets the consumers of a range lookup access the
+  // segment in order.
+  std::stable_sort(values.begin(), values.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; });
   _chunk_offsets.resize(values.size());
   for (size_t i = 0; i < values.size(); i++) {
     _chunk_offsets[i] = values[i].first;
   }
 
-  // Build index
+  // Build index. As the keys arrive in ascending order, we append them using the end() hint. This skips the descent
+  // from the root for each key, and the b-tree splits its rightmost nodes such that all other nodes stay full.
   DataType current_value = values[0].second;
-  _btree[current_value] = 0;
+  _btree.insert(_btree.end(), {current_value, 0});
   _add_to_heap_memory_usage(current_value);
   for (size_t i = 0; i < values.size(); i++) {
     if (values[i].second != current_value) {
       current_value = values[i].second;
-      _btree[current_value] = i;
+      _btree.insert(_btree.end(), {current_value, i});
       _add_to_heap_memory_usage(current_value);
     }
   }
@@ -0,0 +1,225 @@
+#include "key_hash_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+KeyHashIndex::KeyHashIndex(const Table& table, const TableKeyConstraint& key_constraint)
+    : _column_ids{key_constraint.columns().cbegin(), key_constraint.columns().cend()} {
+  Assert(table.type() == TableType::Data, "KeyHashIndex can only be created on data tables.");
+
+  _data_types.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    _data_types.emplace_back(table.column_data_type(column_id));
+  }
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    insert(*chunk, chunk_id, ChunkOffset{0}, chunk->size());
+  }
+}
+
+const std::vector<ColumnID>& KeyHashIndex::column_ids() const {
+  return _column_ids;
+}
+
+void KeyHashIndex::insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                          const ChunkOffset end_offset) {
+  const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+
+  // Rows with a NULL key value are not indexed.
+  auto has_null_value = std::vector<bool>(row_count);
+  const auto key_hashes = _key_hashes(chunk, begin_offset, end_offset, has_null_value);
+
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    if (has_null_value[row_index]) {
+      continue;
+    }
+    _row_ids_by_key_hash.emplace(key_hashes[row_index],
+                                 RowID{chunk_id, static_cast<ChunkOffset>(begin_offset + row_index)});
+  }
+}
+
+RowIDPosList KeyHashIndex::lookup(const Table& table, const std::vector<AllTypeVariant>& key_values) const {
+  const auto column_count = _column_ids.size();
+  Assert(key_values.size() == column_count, "Expected one value per key column.");
+
+  // Cast the values to the data types of the key columns so that they hash like the values in the segments.
+  auto casted_key_values = std::vector<AllTypeVariant>{};
+  casted_key_values.reserve(column_count);
+  auto key_hash = size_t{0};
+  for (auto key_column_index = size_t{0}; key_column_index < column_count; ++key_column_index) {
+    if (variant_is_null(key_values[key_column_index])) {
+      return RowIDPosList{};
+    }
+
+    const auto casted_value = lossless_variant_cast(key_values[key_column_index], _data_types[key_column_index]);
+    if (!casted_value) {
+      return RowIDPosList{};
+    }
+
+    resolve_data_type(_data_types[key_column_index], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      boost::hash_combine(key_hash, boost::get<ColumnDataType>(*casted_value));
+    });
+    casted_key_values.emplace_back(*casted_value);
+  }
+
+  // Different keys might share a hash value, so we have to compare the actual values of the candidate rows.
+  auto matches = RowIDPosList{};
+  const auto [candidates_begin, candidates_end] = _row_ids_by_key_hash.equal_range(key_hash);
+  for (auto candidate_iter = candidates_begin; candidate_iter != candidates_end; ++candidate_iter) {
+    const auto& row_id = candidate_iter->second;
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    auto is_match = true;
+    for (auto key_column_index = size_t{0}; key_column_index < column_count && is_match; ++key_column_index) {
+      const auto& segment = chunk->get_segment(_column_ids[key_column_index]);
+      is_match = (*segment)[row_id.chunk_offset] == casted_key_values[key_column_index];
+    }
+
+    if (is_match) {
+      matches.emplace_back(row_id);
+    }
+  }
+
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+bool KeyHashIndex::has_duplicates(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                  const ChunkOffset end_offset, const TransactionID transaction_id,
+                                  const std::vector<RowRange>& own_inserted_rows) const {
+  const auto chunk = table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot check rows of a physically deleted chunk.");
+  const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+
+  auto has_null_value = std::vector<bool>(row_count);
+  const auto key_hashes = _key_hashes(*chunk, begin_offset, end_offset, has_null_value);
+
+  // Rows that were deleted or rolled back have an end CID (rolled-back inserts have an end CID of 0). Rows that are
+  // still being inserted or deleted by other transactions count as duplicates: Even though the other transaction
+  // might still roll back, we cannot wait for it without serializing inserts. For tables without MVCC data, all rows
+  // are considered.
+  const auto is_live = [&](const Chunk& row_chunk, const ChunkOffset chunk_offset) {
+    const auto& mvcc_data = row_chunk.mvcc_data();
+    return !mvcc_data || mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID;
+  };
+
+  const auto is_deleted_by_own_transaction = [&](const Chunk& row_chunk, const ChunkOffset chunk_offset) {
+    const auto& mvcc_data = row_chunk.mvcc_data();
+    return mvcc_data && transaction_id != TransactionID{0} && mvcc_data->get_tid(chunk_offset) == transaction_id &&
+           mvcc_data->get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID;
+  };
+
+  // Rows that the transaction inserted and deleted again have neither a TID (see Delete) nor a begin CID.
+  const auto is_inserted_and_deleted_by_own_transaction = [&](const Chunk& row_chunk, const RowID row_id) {
+    const auto& mvcc_data = row_chunk.mvcc_data();
+    if (!mvcc_data || mvcc_data->get_tid(row_id.chunk_offset) != INVALID_TRANSACTION_ID ||
+        mvcc_data->get_begin_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID) {
+      return false;
+    }
+
+    return std::any_of(own_inserted_rows.cbegin(), own_inserted_rows.cend(), [&](const auto& row_range) {
+      return row_range.chunk_id == row_id.chunk_id && row_id.chunk_offset >= row_range.begin_offset &&
+             row_id.chunk_offset < row_range.end_offset;
+    });
+  };
+
+  const auto column_count = _column_ids.size();
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    const auto chunk_offset = static_cast<ChunkOffset>(begin_offset + row_index);
+    if (has_null_value[row_index] || !is_live(*chunk, chunk_offset) ||
+        is_inserted_and_deleted_by_own_transaction(*chunk, RowID{chunk_id, chunk_offset})) {
+      continue;
+    }
+
+    const auto [candidates_begin, candidates_end] = _row_ids_by_key_hash.equal_range(key_hashes[row_index]);
+    for (auto candidate_iter = candidates_begin; candidate_iter != candidates_end; ++candidate_iter) {
+      const auto& candidate_row_id = candidate_iter->second;
+      if (candidate_row_id == RowID{chunk_id, chunk_offset}) {
+        continue;
+      }
+
+      const auto candidate_chunk = table.get_chunk(candidate_row_id.chunk_id);
+      if (!candidate_chunk || !is_live(*candidate_chunk, candidate_row_id.chunk_offset) ||
+          is_deleted_by_own_transaction(*candidate_chunk, candidate_row_id.chunk_offset) ||
+          is_inserted_and_deleted_by_own_transaction(*candidate_chunk, candidate_row_id)) {
+        continue;
+      }
+
+      auto is_duplicate = true;
+      for (auto key_column_index = size_t{0}; key_column_index < column_count && is_duplicate; ++key_column_index) {
+        const auto column_id = _column_ids[key_column_index];
+        is_duplicate = (*chunk->get_segment(column_id))[chunk_offset] ==
+                       (*candidate_chunk->get_segment(column_id))[candidate_row_id.chunk_offset];
+      }
+
+      if (is_duplicate) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+size_t KeyHashIndex::estimate_memory_usage() const {
+  // The concurrent map stores one list node per entry and one bucket pointer per bucket.
+  const auto entry_size = sizeof(std::pair<const size_t, RowID>) + 2 * sizeof(void*);
+  return sizeof(KeyHashIndex) + _row_ids_by_key_hash.size() * entry_size +
+         _row_ids_by_key_hash.unsafe_bucket_count() * sizeof(void*);
+}
+
+std::vector<size_t> KeyHashIndex::_key_hashes(const Chunk& chunk, const ChunkOffset begin_offset,
+                                             const ChunkOffset end_offset, std::vector<bool>& has_null_value) const {
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk.size(), "Invalid chunk offsets.");
+  const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+  DebugAssert(has_null_value.size() == row_count, "Expected one NULL flag per row.");
+
+  // Combine the hashes of the key values column by column.
+  auto key_hashes = std::vector<size_t>(row_count);
+
+  const auto column_count = _column_ids.size();
+  for (auto key_column_index = size_t{0}; key_column_index < column_count; ++key_column_index) {
+    const auto& segment = chunk.get_segment(_column_ids[key_column_index]);
+    resolve_data_type(_data_types[key_column_index], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_with_iterators<ColumnDataType>(*segment, [&](const auto begin, const auto /*end*/) {
+        auto iter = begin + begin_offset;
+        for (auto row_index = size_t{0}; row_index < row_count; ++row_index, ++iter) {
+          if (iter->is_null()) {
+            has_null_value[row_index] = true;
+            continue;
+          }
+          boost::hash_combine(key_hashes[row_index], iter->value());
+        }
+      });
+    });
+  }
+
+  return key_hashes;
+}
+
+}  // namespace hyrise
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <tbb/concurrent_unordered_map.h>
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/constraints/table_key_constraint.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class Chunk;
+class Table;
+
+/**
+ * Table-level hash index over the columns of a TableKeyConstraint. In contrast to the PartialHashIndex, it covers
+ * mutable chunks as well: Insert adds the rows it appends to the table (see Table::create_key_hash_index), so that
+ * point lookups on the key (e.g., `WHERE w_id = ? AND d_id = ?`) do not have to scan the unencoded tail of the table.
+ *
+ * The index maps the hash of a row's key values to the row's RowID. Entries are never removed: Rows that were deleted,
+ * updated, or rolled back stay in the index and the caller has to resolve their visibility using the MvccData of the
+ * referenced chunks (e.g., by a Validate operator on top of the lookup result). Rows with a NULL value in one of the
+ * key columns are not indexed as no equality predicate can match them.
+ *
+ * The index is also used to enforce the key constraint: Before a transaction that inserted rows is committed,
+ * has_duplicates() checks whether one of the inserted keys already exists (see Insert::_on_validate_commit).
+ *
+ * Concurrent inserts and lookups are latch-free, which is why we use a tbb::concurrent_unordered_multimap here instead
+ * of the std::shared_mutex of the PartialHashIndex. The concurrent map does not support concurrent erasure, which we do
+ * not need.
+ */
+class KeyHashIndex {
+ public:
+  // The rows [begin_offset, end_offset) of a chunk.
+  struct RowRange {
+    ChunkID chunk_id;
+    ChunkOffset begin_offset;
+    ChunkOffset end_offset;
+  };
+
+  // Indexes all rows that are currently stored in `table`.
+  KeyHashIndex(const Table& table, const TableKeyConstraint& key_constraint);
+
+  // The indexed columns in ascending order.
+  const std::vector<ColumnID>& column_ids() const;
+
+  // Adds the rows in [begin_offset, end_offset) of the chunk to the index. Can be called concurrently.
+  void insert(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+
+  /**
+   * Returns the sorted RowIDs of all indexed rows whose key columns equal `key_values`, which are ordered like
+   * column_ids(). The visibility of the rows is not checked. Values that cannot be losslessly cast to the data type
+   * of the respective column and NULL values do not match any row.
+   */
+  RowIDPosList lookup(const Table& table, const std::vector<AllTypeVariant>& key_values) const;
+
+  /**
+   * Returns true if a row in [begin_offset, end_offset) of the chunk has the same key values as another row that is,
+   * or might become, visible. Rows that were deleted or rolled back are ignored. `transaction_id` is the transaction
+   * that inserted the rows of the range, if any. Rows that this transaction is about to delete do not count as
+   * duplicates, which allows updates that keep the key. Rows of the range are compared with each other as well, so
+   * the check also covers bulk inserts and validating a complete table (with TransactionID{0}).
+   *
+   * `own_inserted_rows` are all rows of the table that the transaction inserted. When a transaction deletes a row that
+   * it inserted itself, Delete resets the row's TID, so that the row can no longer be told apart from a row that is
+   * still being inserted. Such rows of `own_inserted_rows` are ignored as they are dead once the transaction commits.
+   */
+  bool has_duplicates(const Table& table, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset, const TransactionID transaction_id,
+                      const std::vector<RowRange>& own_inserted_rows = {}) const;
+
+  size_t estimate_memory_usage() const;
+
+ private:
+  // Computes the combined hashes of the key values of the rows in [begin_offset, end_offset). Rows with a NULL key
+  // value are flagged in `has_null_value`.
+  std::vector<size_t> _key_hashes(const Chunk& chunk, const ChunkOffset begin_offset, const ChunkOffset end_offset,
+                                  std::vector<bool>& has_null_value) const;
+
+  const std::vector<ColumnID> _column_ids;
+  std::vector<DataType> _data_types;
+
+  tbb::concurrent_unordered_multimap<size_t, RowID> _row_ids_by_key_hash;
+};
+
+}  // namespace hyrise
@@ -2,6 +2,7 @@
 
 #include "flat_map_iterator.hpp"
 #include "partial_hash_index_impl.hpp"
+#include "utils/assert.hpp"
 
 namespace hyrise {
 
@@ -86,6 +87,31 @@ class PartialHashIndex {
     functor(not_equals_range_right.first, not_equals_range_right.second);
   }
 
+  /**
+   * Searches for the positions of a batch of values with a single lock acquisition. For each value with at least one
+   * occurrence, the functor is called with the value's position in `values` and the RowIDs of its occurrences. In
+   * contrast to the methods above, the values are not type-erased and no iterators are
+   * created, which makes this the method of choice for operators that probe the index many times, e.g., the JoinIndex.
+   *
+   * @param functor is a generic function object accepting a size_t and a const std::vector<RowID>& as arguments
+   * @param values are the entries searched for, their type must match the data type of the indexed column
+   */
+  template <typename DataType, typename Functor>
+  void range_equals_batched(const Functor& functor, const std::vector<DataType>& values) const {
+    auto matches = std::vector<const std::vector<RowID>*>{};
+    const auto lock = std::shared_lock<std::shared_mutex>(_data_access_mutex);
+    DebugAssert(dynamic_cast<const PartialHashIndexImpl<DataType>*>(_impl.get()),
+                "Data type of the values does not match the indexed column.");
+    static_cast<const PartialHashIndexImpl<DataType>&>(*_impl).range_equals_batched(values, matches);
+
+    const auto value_count = values.size();
+    for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+      if (matches[value_idx]) {
+        functor(value_idx, *matches[value_idx]);
+      }
+    }
+  }
+
   /**
    * Inserts entries for the given chunks into this index. If index entries already exist for a given chunk, entries
    * for that chunk are not inserted again.
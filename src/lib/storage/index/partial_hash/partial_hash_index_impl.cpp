@@ -93,6 +93,34 @@ BasePartialHashIndexImpl::IteratorRange PartialHashIndexImpl<DataType>::range_eq
                         CreateFlatMapIterator<DataType>::from_map_iterator(++end));
 }
 
+template <typename DataType>
+void PartialHashIndexImpl<DataType>::range_equals_batched(const std::vector<DataType>& values,
+                                                          std::vector<const std::vector<RowID>*>& matches) const {
+  const auto value_count = values.size();
+
+  // Hash all values before probing the map. This keeps the hashing loop free of dependent memory accesses, and the
+  // lookups of independent values in the second loop can overlap their cache misses.
+  auto hashes = std::vector<size_t>(value_count);
+  const auto hash_function = _positions.hash_function();
+  for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+    hashes[value_idx] = hash_function(values[value_idx]);
+  }
+
+  matches.resize(value_count);
+  const auto positions_end = _positions.cend();
+  for (auto value_idx = size_t{0}; value_idx < value_count; ++value_idx) {
+    const auto iter = _positions.find(values[value_idx], hashes[value_idx]);
+    if (iter == positions_end) {
+      matches[value_idx] = nullptr;
+      continue;
+    }
+
+    // The caller reads the RowIDs only after the whole batch has been looked up, so we request them early.
+    __builtin_prefetch(iter->second.data());
+    matches[value_idx] = &iter->second;
+  }
+}
+
 template <typename DataType>
 BasePartialHashIndexImpl::IteratorRangePair PartialHashIndexImpl<DataType>::range_not_equals(
     const AllTypeVariant& value) const {
@@ -87,6 +87,12 @@ class PartialHashIndexImpl : public BasePartialHashIndexImpl {
   BasePartialHashIndexImpl::IteratorRange range_equals(const AllTypeVariant& value) const final;
   BasePartialHashIndexImpl::IteratorRangePair range_not_equals(const AllTypeVariant& value) const final;
 
+  /**
+   * Looks up a batch of values and stores a pointer to the RowIDs of each value's occurrences in `matches` (nullptr if
+   * the value is not indexed). See PartialHashIndex::range_equals_batched.
+   */
+  void range_equals_batched(const std::vector<DataType>& values, std::vector<const std::vector<RowID>*>& matches) const;
+
   tsl::sparse_set<ChunkID> get_indexed_chunk_ids() const final;
 
  private:
@@ -1,34 +1,63 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "utils/assert.hpp"
 
 namespace hyrise {
 
-MvccData::MvccData(const size_t size, CommitID begin_commit_id) {
+namespace {
+
+// Publishes `new_values` in `values` unless another thread was faster. Returns the published array.
+template <typename T>
+T* publish(std::atomic<T*>& values, std::unique_ptr<T[]> new_values) {
+  auto* expected_values = static_cast<T*>(nullptr);
+  if (values.compare_exchange_strong(expected_values, new_values.get())) {
+    return new_values.release();
+  }
+  return expected_values;
+}
+
+}  // namespace
+
+MvccData::MvccData(const size_t size, CommitID begin_commit_id)
+    : _size{size},
+      _uniform_begin_cid{begin_commit_id},
+      _end_cid_pages{std::make_unique<std::atomic<CommitID*>[]>(_page_count())},
+      _tid_pages{std::make_unique<std::atomic<std::atomic<TransactionID>*>[]>(_page_count())} {
   DebugAssert(size > 0, "No point in having empty MVCC data, as it cannot grow");
 
-  _begin_cids.resize(size, begin_commit_id);
-  _end_cids.resize(size, MAX_COMMIT_ID);
-  _tids.resize(size, copyable_atomic<TransactionID>{INVALID_TRANSACTION_ID});
+  _update_max_commit_id(begin_commit_id);
   std::atomic_thread_fence(std::memory_order_seq_cst);
 }
 
+MvccData::~MvccData() {
+  delete[] _begin_cids.load();
+
+  const auto page_count = _page_count();
+  for (auto page_index = size_t{0}; page_index < page_count; ++page_index) {
+    delete[] _end_cid_pages[page_index].load();
+    delete[] _tid_pages[page_index].load();
+  }
+}
+
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
   stream << "TIDs: ";
-  for (const auto& tid : mvcc_data._tids) {
-    stream << tid.load() << ", ";
+  for (auto offset = ChunkOffset{0}; offset < mvcc_data._size; ++offset) {
+    stream << mvcc_data.get_tid(offset) << ", ";
   }
   stream << std::endl;
 
   stream << "BeginCIDs: ";
-  for (const auto& begin_cid : mvcc_data._begin_cids) {
-    stream << begin_cid << ", ";
+  for (auto offset = ChunkOffset{0}; offset < mvcc_data._size; ++offset) {
+    stream << mvcc_data.get_begin_cid(offset) << ", ";
   }
   stream << std::endl;
 
   stream << "EndCIDs: ";
-  for (const auto& end_cid : mvcc_data._end_cids) {
-    stream << end_cid << ", ";
+  for (auto offset = ChunkOffset{0}; offset < mvcc_data._size; ++offset) {
+    stream << mvcc_data.get_end_cid(offset) << ", ";
   }
   stream << std::endl;
 
@@ -36,51 +65,321 @@ std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data) {
 }
 
 CommitID MvccData::get_begin_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  return _begin_cids[offset];
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto* const begin_cids = _begin_cids.load(std::memory_order_acquire);
+  return begin_cids ? begin_cids[offset] : _uniform_begin_cid;
 }
 
 void MvccData::set_begin_cid(const ChunkOffset offset, const CommitID commit_id) {
-  DebugAssert(offset < _begin_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  _begin_cids[offset] = commit_id;
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  auto* begin_cids = _begin_cids.load(std::memory_order_acquire);
+  if (!begin_cids) {
+    if (commit_id == _uniform_begin_cid) {
+      return;
+    }
+    begin_cids = _get_or_allocate_begin_cids();
+  }
+
+  begin_cids[offset] = commit_id;
+  _update_max_commit_id(commit_id);
 }
 
 CommitID MvccData::get_end_cid(const ChunkOffset offset) const {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  return _end_cids[offset];
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto* const end_cids = _end_cid_pages[offset / PAGE_SIZE].load(std::memory_order_acquire);
+  const auto end_cid = end_cids ? end_cids[offset % PAGE_SIZE] : MAX_COMMIT_ID;
+  return end_cid == MAX_COMMIT_ID ? _chunk_end_cid.load(std::memory_order_acquire) : end_cid;
 }
 
 void MvccData::set_end_cid(const ChunkOffset offset, const CommitID commit_id) {
-  DebugAssert(offset < _end_cids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  _end_cids[offset] = commit_id;
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto page_index = offset / PAGE_SIZE;
+  auto* end_cids = _end_cid_pages[page_index].load(std::memory_order_acquire);
+  if (!end_cids) {
+    if (commit_id == MAX_COMMIT_ID) {
+      return;
+    }
+    end_cids = _get_or_allocate_end_cid_page(page_index);
+  }
+
+  end_cids[offset % PAGE_SIZE] = commit_id;
+  _update_max_commit_id(commit_id);
 }
 
 TransactionID MvccData::get_tid(const ChunkOffset offset) const {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
-  return _tids[offset];
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto* const tids = _tid_pages[offset / PAGE_SIZE].load(std::memory_order_acquire);
+  return tids ? tids[offset % PAGE_SIZE].load() : INVALID_TRANSACTION_ID;
 }
 
 void MvccData::set_tid(const ChunkOffset offset, const TransactionID new_transaction_id,
                        const std::memory_order memory_order) {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto page_index = offset / PAGE_SIZE;
+  auto* tids = _tid_pages[page_index].load(std::memory_order_acquire);
+  if (!tids) {
+    if (new_transaction_id == INVALID_TRANSACTION_ID) {
+      return;
+    }
+    tids = _get_or_allocate_tid_page(page_index);
+  }
 
-  _tids[offset].store(new_transaction_id, memory_order);
+  tids[offset % PAGE_SIZE].store(new_transaction_id, memory_order);
 }
 
 bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                                     TransactionID new_transaction_id) {
-  DebugAssert(offset < _tids.size(), "offset out of bounds; MvccData insufficently preallocated?");
+  DebugAssert(offset < _size, "offset out of bounds; MvccData insufficently preallocated?");
+  const auto page_index = offset / PAGE_SIZE;
+  auto* tids = _tid_pages[page_index].load(std::memory_order_acquire);
+  if (!tids) {
+    // All rows of unallocated pages are unlocked.
+    if (expected_transaction_id != INVALID_TRANSACTION_ID) {
+      return false;
+    }
+    tids = _get_or_allocate_tid_page(page_index);
+  }
+
+  return tids[offset % PAGE_SIZE].compare_exchange_strong(expected_transaction_id, new_transaction_id);
+}
+
+void MvccData::set_chunk_end_cid(const CommitID commit_id) {
+  _chunk_end_cid.store(commit_id);
+  _update_max_commit_id(commit_id);
+}
+
+std::optional<CommitID> MvccData::uniform_begin_cid() const {
+  if (_begin_cids.load(std::memory_order_acquire)) {
+    return std::nullopt;
+  }
+  return _uniform_begin_cid;
+}
+
+CommitID MvccData::max_end_cid() const {
+  // All rows that were deleted individually were deleted before the rest of the chunk.
+  const auto chunk_end_cid = _chunk_end_cid.load();
+  if (chunk_end_cid != MAX_COMMIT_ID) {
+    return chunk_end_cid;
+  }
+
+  auto max_end_cid = CommitID{0};
+
+  const auto page_count = _page_count();
+  for (auto page_index = size_t{0}; page_index < page_count; ++page_index) {
+    const auto* const end_cids = _end_cid_pages[page_index].load(std::memory_order_acquire);
+    if (!end_cids) {
+      continue;
+    }
+
+    const auto page_size = _page_size(page_index);
+    for (auto index = size_t{0}; index < page_size; ++index) {
+      if (end_cids[index] != MAX_COMMIT_ID) {
+        max_end_cid = std::max(max_end_cid, end_cids[index]);
+      }
+    }
+  }
+
+  return max_end_cid;
+}
+
+MvccData::VisibilityBitmap MvccData::compute_visibility(const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                                       const ChunkOffset row_count, const bool check_tids) const {
+  DebugAssert(row_count <= _size, "row_count out of bounds; MvccData insufficently preallocated?");
+  constexpr auto BLOCK_SIZE = size_t{64};
+  static_assert(PAGE_SIZE % BLOCK_SIZE == 0, "Blocks must not span multiple pages.");
+
+  const auto block_count = (static_cast<size_t>(row_count) + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  auto bitmap = VisibilityBitmap(block_count);
+
+  // If the chunk has been deleted entirely, all rows have been deleted at or before the chunk's end CID.
+  if (snapshot_commit_id >= _chunk_end_cid.load()) {
+    return bitmap;
+  }
+
+  const auto* const begin_cids = _begin_cids.load(std::memory_order_acquire);
+  const auto uniform_begun = snapshot_commit_id >= _uniform_begin_cid;
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * BLOCK_SIZE;
+    const auto block_size = std::min(BLOCK_SIZE, static_cast<size_t>(row_count) - block_begin);
+    const auto block_mask = block_size == BLOCK_SIZE ? ~uint64_t{0} : (uint64_t{1} << block_size) - 1;
+
+    const auto page_index = block_begin / PAGE_SIZE;
+    const auto page_offset = block_begin % PAGE_SIZE;
+    const auto* const end_cids = _end_cid_pages[page_index].load(std::memory_order_acquire);
+
+    // See Validate::is_row_visible: A row is visible if `snapshot_commit_id < end_cid` and either
+    // `snapshot_commit_id >= begin_cid` or the row was inserted by our transaction (which then also holds its lock).
+    // Rows without allocated end CIDs or begin CIDs have the default values.
+    auto not_ended_mask = block_mask;
+    auto begun_mask = uniform_begun ? block_mask : uint64_t{0};
+
+    if (end_cids) {
+      not_ended_mask = 0;
+      // This empty block is used to convince clang-format to keep the pragma indented (see AbstractTableScanImpl).
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:not_ended_mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        not_ended_mask |= static_cast<uint64_t>(snapshot_commit_id < end_cids[page_offset + index]) << index;
+      }
+    }
+
+    if (begin_cids && not_ended_mask) {
+      begun_mask = 0;
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:begun_mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        begun_mask |= static_cast<uint64_t>(snapshot_commit_id >= begin_cids[block_begin + index]) << index;
+      }
+    }
+
+    const auto* const tids = check_tids ? _tid_pages[page_index].load(std::memory_order_acquire) : nullptr;
+    if (tids && not_ended_mask) {
+      auto own_mask = uint64_t{0};
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        own_mask |= static_cast<uint64_t>(tids[page_offset + index].load() == our_tid) << index;
+      }
+      begun_mask ^= own_mask;
+    }
+
+    bitmap[block_index] = not_ended_mask & begun_mask;
+  }
+
+  return bitmap;
+}
+
+std::shared_ptr<const MvccData::VisibilityBitmap> MvccData::visibility(const CommitID snapshot_commit_id,
+                                                                       const ChunkOffset row_count) const {
+  if (auto bitmap = cached_visibility(snapshot_commit_id, row_count)) {
+    return bitmap;
+  }
+
+  auto bitmap = std::make_shared<const VisibilityBitmap>(
+      compute_visibility(INVALID_TRANSACTION_ID, snapshot_commit_id, row_count, false));
+
+  // Concurrent transactions might replace each other's results, which only reduces the hit rate.
+  std::atomic_store(&_cached_visibility,
+                    std::make_shared<const CachedVisibility>(CachedVisibility{snapshot_commit_id, row_count, bitmap}));
+  return bitmap;
+}
+
+std::shared_ptr<const MvccData::VisibilityBitmap> MvccData::cached_visibility(const CommitID snapshot_commit_id,
+                                                                              const ChunkOffset row_count) const {
+  const auto cached_visibility = std::atomic_load(&_cached_visibility);
+  if (!cached_visibility) {
+    return nullptr;
+  }
+
+  // Rows that were appended after the visibility was cached are not covered by the bitmap. As rows appended by Insert
+  // are only visible after they are committed, which increases max_commit_id(), this check is only needed for rows
+  // that are appended without a transaction (see Chunk::append).
+  if (row_count > cached_visibility->row_count) {
+    return nullptr;
+  }
+
+  // If no begin or end CID is in (min(snapshots), max(snapshots)], both snapshots see the same rows. Rows that are
+  // currently being inserted or deleted still have a MAX_COMMIT_ID and look the same to both snapshots, too.
+  if (max_commit_id() > std::min(snapshot_commit_id, cached_visibility->snapshot_commit_id)) {
+    return nullptr;
+  }
 
-  return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
+  return cached_visibility->bitmap;
+}
+
+CommitID MvccData::max_commit_id() const {
+  return _max_commit_id.load();
+}
+
+void MvccData::_update_max_commit_id(const CommitID commit_id) {
+  if (commit_id == MAX_COMMIT_ID) {
+    return;
+  }
+
+  auto max_commit_id = _max_commit_id.load();
+  while (commit_id > max_commit_id && !_max_commit_id.compare_exchange_weak(max_commit_id, commit_id)) {}
 }
 
 size_t MvccData::memory_usage() const {
-  auto bytes = size_t{0};
-  bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
-  bytes += _tids.size() * sizeof(decltype(_tids)::value_type);
-  bytes += _begin_cids.size() * sizeof(decltype(_begin_cids)::value_type);
-  bytes += _end_cids.size() * sizeof(decltype(_end_cids)::value_type);
+  auto bytes = sizeof(*this);
+  bytes += _page_count() * (sizeof(std::atomic<CommitID*>) + sizeof(std::atomic<std::atomic<TransactionID>*>));
+
+  if (_begin_cids.load()) {
+    bytes += _size * sizeof(CommitID);
+  }
+
+  const auto page_count = _page_count();
+  for (auto page_index = size_t{0}; page_index < page_count; ++page_index) {
+    if (_end_cid_pages[page_index].load()) {
+      bytes += _page_size(page_index) * sizeof(CommitID);
+    }
+    if (_tid_pages[page_index].load()) {
+      bytes += _page_size(page_index) * sizeof(std::atomic<TransactionID>);
+    }
+  }
+
   return bytes;
 }
 
+size_t MvccData::memory_savings() const {
+  auto saved_bytes = size_t{0};
+  if (!_begin_cids.load()) {
+    saved_bytes += _size * sizeof(CommitID);
+  }
+
+  const auto page_count = _page_count();
+  for (auto page_index = size_t{0}; page_index < page_count; ++page_index) {
+    if (!_end_cid_pages[page_index].load()) {
+      saved_bytes += _page_size(page_index) * sizeof(CommitID);
+    }
+    if (!_tid_pages[page_index].load()) {
+      saved_bytes += _page_size(page_index) * sizeof(std::atomic<TransactionID>);
+    }
+  }
+
+  return saved_bytes;
+}
+
+size_t MvccData::_page_count() const {
+  return (_size + PAGE_SIZE - 1) / PAGE_SIZE;
+}
+
+size_t MvccData::_page_size(const size_t page_index) const {
+  return std::min(PAGE_SIZE, _size - page_index * PAGE_SIZE);
+}
+
+CommitID* MvccData::_get_or_allocate_begin_cids() {
+  if (auto* begin_cids = _begin_cids.load(std::memory_order_acquire)) {
+    return begin_cids;
+  }
+
+  auto new_begin_cids = std::make_unique<CommitID[]>(_size);
+  std::fill_n(new_begin_cids.get(), _size, _uniform_begin_cid);
+  return publish(_begin_cids, std::move(new_begin_cids));
+}
+
+CommitID* MvccData::_get_or_allocate_end_cid_page(const size_t page_index) {
+  if (auto* end_cids = _end_cid_pages[page_index].load(std::memory_order_acquire)) {
+    return end_cids;
+  }
+
+  const auto page_size = _page_size(page_index);
+  auto new_end_cids = std::make_unique<CommitID[]>(page_size);
+  std::fill_n(new_end_cids.get(), page_size, MAX_COMMIT_ID);
+  return publish(_end_cid_pages[page_index], std::move(new_end_cids));
+}
+
+std::atomic<TransactionID>* MvccData::_get_or_allocate_tid_page(const size_t page_index) {
+  if (auto* tids = _tid_pages[page_index].load(std::memory_order_acquire)) {
+    return tids;
+  }
+
+  // std::atomic is value-initialized, i.e., all TIDs are INVALID_TRANSACTION_ID.
+  auto new_tids = std::make_unique<std::atomic<TransactionID>[]>(_page_size(page_index));
+  return publish(_tid_pages[page_index], std::move(new_tids));
+}
+
 }  // namespace hyrise
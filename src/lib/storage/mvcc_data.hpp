@@ -1,15 +1,23 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <optional>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <vector>
 
 #include "types.hpp"
-#include "utils/copyable_atomic.hpp"
 
 namespace hyrise {
 
 /**
  * Stores visibility information for multiversion concurrency control.
+ *
+ * To keep the MVCC data of bulk-loaded and rarely modified chunks small, it is allocated lazily:
+ *  - As long as no begin CID differs from the one passed to the constructor, the begin CIDs are not stored per row.
+ *  - End CIDs and TIDs are stored in pages of PAGE_SIZE rows, which are allocated when a row of the page is deleted or
+ *    locked for the first time. Until then, all rows of the page have an end CID of MAX_COMMIT_ID and no TID.
+ * Once allocated, the storage is not freed before the MvccData is destroyed, as other threads might still access it.
  */
 struct MvccData {
   friend class Chunk;
@@ -19,14 +27,26 @@ struct MvccData {
   // The last commit id is reserved for uncommitted changes
   static constexpr CommitID MAX_COMMIT_ID = CommitID{std::numeric_limits<CommitID::base_type>::max() - 1};
 
+  // Number of rows per lazily allocated page of end CIDs and TIDs. A multiple of 64, so that the blocks of
+  // compute_visibility() do not span multiple pages.
+  static constexpr auto PAGE_SIZE = size_t{4096};
+
+  // Selection bitmap with one bit per row: Bit `chunk_offset % 64` of word `chunk_offset / 64` is set if the row is
+  // visible. See compute_visibility().
+  using VisibilityBitmap = std::vector<uint64_t>;
+
   // This is used for optimizing the validation process. It is set during Chunk::finalize(). Consult
   // Validate::_on_execute for further details.
   std::optional<CommitID> max_begin_cid;
 
   // Creates MVCC data that supports a maximum of `size` rows. If the underlying chunk has less rows, the extra rows
-  // here are ignored. This is to avoid resizing the vectors, which would cause reallocations and require locking.
+  // here are ignored. This is to avoid resizing the storage, which would cause reallocations and require locking.
   explicit MvccData(const size_t size, CommitID begin_commit_id);
 
+  MvccData(const MvccData&) = delete;
+  MvccData& operator=(const MvccData&) = delete;
+  ~MvccData();
+
   /**
    * The thread sanitizer (tsan) complains about concurrent writes and reads to begin/end_cids. That is because it is
    * unaware of their thread-safety being guaranteed by the update of the global last_cid. Furthermore, we exploit that
@@ -45,13 +65,80 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  // Sets the end CID of all rows that have not been deleted before without allocating the pages of end CIDs. Used by
+  // Delete when a transaction deletes all rows of an immutable chunk, which it has locked before.
+  void set_chunk_end_cid(const CommitID commit_id);
+
+  // Returns the begin CID of all rows if the begin CIDs are not stored per row (see above).
+  std::optional<CommitID> uniform_begin_cid() const;
+
+  // Returns the highest end CID of a deleted row or CommitID{0} if no row has been deleted. Only visits the allocated
+  // pages (or none if the whole chunk has been deleted).
+  CommitID max_end_cid() const;
+
+  /**
+   * Evaluates Validate::is_row_visible for the rows [0, row_count) in one pass, 64 rows at a time. Transactions that
+   * did not modify any rows (`check_tids` is false) cannot have locked a row, so only the begin and end CIDs are
+   * compared. This happens without branches and is vectorized by the compiler. Otherwise, the TIDs are read as well.
+   */
+  VisibilityBitmap compute_visibility(const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                      const ChunkOffset row_count, const bool check_tids) const;
+
+  /**
+   * Returns the visibility of the rows [0, row_count) for a transaction that did not modify any rows. The result of
+   * the last computation is cached: It is also valid for other snapshots as long as no begin or end CID of the chunk
+   * lies between both snapshots, i.e., if max_commit_id() is not higher than either snapshot. Thus, repeated queries
+   * with newer snapshots do not re-evaluate chunks that did not change. cached_visibility() only performs the lookup
+   * and returns nullptr if no valid result is cached.
+   */
+  std::shared_ptr<const VisibilityBitmap> visibility(const CommitID snapshot_commit_id,
+                                                     const ChunkOffset row_count) const;
+  std::shared_ptr<const VisibilityBitmap> cached_visibility(const CommitID snapshot_commit_id,
+                                                            const ChunkOffset row_count) const;
+
+  // Highest commit ID that has been written as begin or end CID (excluding the MAX_COMMIT_ID of uncommitted rows).
+  CommitID max_commit_id() const;
+
   size_t memory_usage() const;
 
+  // Bytes that the lazy allocation currently saves compared to storing the begin CID, end CID, and TID of every row.
+  size_t memory_savings() const;
+
  private:
-  // These vectors are pre-allocated. Do not resize them as someone might be reading them concurrently.
-  pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
-  pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
-  pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+  struct CachedVisibility {
+    CommitID snapshot_commit_id;
+    ChunkOffset row_count;
+    std::shared_ptr<const VisibilityBitmap> bitmap;
+  };
+
+  void _update_max_commit_id(const CommitID commit_id);
+
+  size_t _page_count() const;
+  size_t _page_size(const size_t page_index) const;
+  CommitID* _get_or_allocate_begin_cids();
+  CommitID* _get_or_allocate_end_cid_page(const size_t page_index);
+  std::atomic<TransactionID>* _get_or_allocate_tid_page(const size_t page_index);
+
+  const size_t _size;
+
+  // Begin CID of all rows as long as _begin_cids is not allocated.
+  const CommitID _uniform_begin_cid;
+
+  // The arrays are allocated by the first writer that needs them and published with a compare-and-swap. Readers that
+  // still see a nullptr use the default values instead.
+  std::atomic<CommitID*> _begin_cids{nullptr};                             // < commit id when record was added
+  std::unique_ptr<std::atomic<CommitID*>[]> _end_cid_pages;                // < commit id when record was deleted
+  std::unique_ptr<std::atomic<std::atomic<TransactionID>*>[]> _tid_pages;  // < 0 unless locked by a transaction
+
+  // End CID of all rows that would otherwise have an end CID of MAX_COMMIT_ID (see set_chunk_end_cid()).
+  std::atomic<CommitID> _chunk_end_cid{MAX_COMMIT_ID};
+
+  // Updated before the commit ID is published as the last commit ID, so that every transaction whose snapshot includes
+  // a commit to this chunk also sees the updated value.
+  std::atomic<CommitID> _max_commit_id{CommitID{0}};
+
+  // Accessed with std::atomic_load/std::atomic_store as multiple Validates might use and replace it concurrently.
+  mutable std::shared_ptr<const CachedVisibility> _cached_visibility;
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
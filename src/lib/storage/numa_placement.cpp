@@ -0,0 +1,47 @@
+#include "numa_placement.hpp"
+
+#include <memory>
+
+#include "hyrise.hpp"
+#include "memory/numa_memory_resource.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+NodeID numa_node_for_chunk(const ChunkID chunk_id, const ChunkID chunk_count, const size_t node_count,
+                           const NumaPlacementPolicy policy) {
+  DebugAssert(chunk_id < chunk_count, "Chunk is not part of the table.");
+  DebugAssert(node_count > 0, "Expected at least one node.");
+
+  switch (policy) {
+    case NumaPlacementPolicy::Interleaved:
+      return NodeID{static_cast<NodeID::base_type>(chunk_id % node_count)};
+    case NumaPlacementPolicy::Partitioned: {
+      const auto chunks_per_node = (static_cast<size_t>(chunk_count) + node_count - 1) / node_count;
+      return NodeID{static_cast<NodeID::base_type>(chunk_id / chunks_per_node)};
+    }
+  }
+  Fail("Invalid enum value.");
+}
+
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table, const NumaPlacementPolicy policy) {
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  if (node_count <= 1) {
+    return;
+  }
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable() || chunk->has_indexes()) {
+      continue;
+    }
+
+    const auto node_id = numa_node_for_chunk(chunk_id, chunk_count, node_count, policy);
+    chunk->migrate(NumaMemoryResource::get(node_id));
+    chunk->set_numa_node_id(node_id);
+  }
+}
+
+}  // namespace hyrise
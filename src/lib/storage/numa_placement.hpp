@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace hyrise {
+
+class Table;
+
+enum class NumaPlacementPolicy {
+  // Chunk i is placed on node i % node_count, so that scans of any chunk range are spread across all nodes.
+  Interleaved,
+  // The chunks are split into node_count contiguous ranges with one range per node.
+  Partitioned
+};
+
+// Returns the node on which the given chunk is placed according to the policy.
+NodeID numa_node_for_chunk(const ChunkID chunk_id, const ChunkID chunk_count, const size_t node_count,
+                           const NumaPlacementPolicy policy);
+
+/**
+ * Migrates the immutable chunks of the table to the nodes of the current topology (see Hyrise::get().topology) using
+ * NumaMemoryResource and sets their numa_node_id(). Does nothing if the topology has a single node. Chunks with
+ * indexes and mutable chunks, which might still be appended to, are not migrated. As the segments of a chunk are
+ * replaced, the table must not be accessed concurrently, e.g., call this before adding the table to the
+ * StorageManager.
+ */
+void place_chunks_on_numa_nodes(const std::shared_ptr<Table>& table,
+                                const NumaPlacementPolicy policy = NumaPlacementPolicy::Interleaved);
+
+}  // namespace hyrise
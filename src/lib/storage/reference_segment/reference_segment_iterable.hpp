@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/chunk_grouped_positions.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
@@ -46,99 +47,184 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
       const auto referenced_segment =
           referenced_table->get_chunk(position_filter->common_chunk_id())->get_segment(referenced_column_id);
 
-      bool functor_was_called = false;
+      _with_referenced_segment_iterators(*referenced_segment, position_filter, functor);
+    } else {
+      using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
+
+      // For larger PosLists, we dereference all positions chunk by chunk before calling the functor (see
+      // _dereference_batched()). The iterators then read the dereferenced values instead of using the accessors.
+      auto accessors = std::shared_ptr<Accessors>{};
+      auto dereferenced_values = std::shared_ptr<const DereferencedValues>{};
+      if (position_filter->size() >= MIN_POSITIONS_FOR_BATCHED_DEREFERENCING) {
+        dereferenced_values = _dereference_batched(*referenced_table, referenced_column_id, position_filter);
+      } else {
+        accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
+      }
+
+      resolve_pos_list_type(position_filter, [&](auto resolved_position_filter) {
+        const auto position_begin_it = resolved_position_filter->begin();
+        const auto position_end_it = resolved_position_filter->end();
+
+        using PosListIteratorType = std::decay_t<decltype(position_begin_it)>;
+
+        auto begin = MultipleChunkIterator<PosListIteratorType>{
+            referenced_table, referenced_column_id, accessors, dereferenced_values, position_begin_it,
+            position_begin_it};
+        auto end = MultipleChunkIterator<PosListIteratorType>{
+            referenced_table, referenced_column_id, accessors, dereferenced_values, position_begin_it, position_end_it};
+
+        functor(begin, end);
+      });
+    }
+  }
 
-      if constexpr (erase_reference_segment_type == EraseReferencedSegmentType::No) {
-        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
-          using SegmentType = std::decay_t<decltype(typed_segment)>;
+  size_t _on_size() const {
+    return _segment.size();
+  }
 
-          // This is ugly, but it allows us to define segment types that we are not interested in and save a lot of
-          // compile time during development. While new segment types should be added here,
+  // PosLists referencing multiple chunks with at least this many positions are dereferenced in batches.
+  static constexpr auto MIN_POSITIONS_FOR_BATCHED_DEREFERENCING = size_t{1'000};
+
+  // Number of positions that the writes of the batched dereferencing are prefetched ahead.
+  static constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+ private:
+  const ReferenceSegment& _segment;
+
+  // Values of all positions of a PosList, in the order of the PosList.
+  struct DereferencedValues {
+    std::vector<T> values;
+    std::vector<bool> null_values;
+  };
+
+  // Calls the functor with the iterators of the referenced segment's iterable, filtered by a PosList that references
+  // the segment's chunk only.
+  template <typename Functor>
+  static void _with_referenced_segment_iterators(const AbstractSegment& referenced_segment,
+                                                 const std::shared_ptr<const AbstractPosList>& position_filter,
+                                                 const Functor& functor) {
+    bool functor_was_called = false;
+
+    if constexpr (erase_reference_segment_type == EraseReferencedSegmentType::No) {
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+        // This is ugly, but it allows us to define segment types that we are not interested in and save a lot of
+        // compile time during development. While new segment types should be added here,
 #ifdef HYRISE_ERASE_DICTIONARY
-          if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
-            return;
-          }
+        if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+          return;
+        }
 #endif
 
 #ifdef HYRISE_ERASE_RUNLENGTH
-          if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
-            return;
-          }
+        if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+          return;
+        }
 #endif
 
 #ifdef HYRISE_ERASE_FIXEDSTRINGDICTIONARY
-          if constexpr (std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) {
-            return;
-          }
+        if constexpr (std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) {
+          return;
+        }
 #endif
 
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-          if constexpr (std::is_same_v<T, int32_t>) {
-            if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
-              return;
-            }
-          }
-#endif
-
-          // Always erase LZ4Segment accessors
-          if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) {
+        if constexpr (std::is_same_v<T, int32_t>) {
+          if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
             return;
           }
+        }
+#endif
 
-          if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
-            const auto segment_iterable = create_iterable_from_segment<T>(typed_segment);
-            segment_iterable.with_iterators(position_filter, functor);
+        // Always erase LZ4Segment accessors
+        if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) {
+          return;
+        }
 
-            functor_was_called = true;
-          } else {
-            Fail("Found ReferenceSegment pointing to ReferenceSegment");
-          }
-        });
+        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+          const auto segment_iterable = create_iterable_from_segment<T>(typed_segment);
+          segment_iterable.with_iterators(position_filter, functor);
 
-        if (!functor_was_called) {
-          PerformanceWarning("ReferenceSegmentIterable for referenced segment type erased by compile-time setting");
+          functor_was_called = true;
+        } else {
+          Fail("Found ReferenceSegment pointing to ReferenceSegment");
         }
+      });
 
-      } else {
-        PerformanceWarning("Using type-erased accessor as the ReferenceSegmentIterable is type-erased itself");
+      if (!functor_was_called) {
+        PerformanceWarning("ReferenceSegmentIterable for referenced segment type erased by compile-time setting");
       }
 
-      if (functor_was_called) {
-        return;
-      }
+    } else {
+      PerformanceWarning("Using type-erased accessor as the ReferenceSegmentIterable is type-erased itself");
+    }
 
-      // The functor was not called yet, because we did not instantiate specialized code for the segment type.
+    if (functor_was_called) {
+      return;
+    }
 
-      const auto segment_iterable = create_any_segment_iterable<T>(*referenced_segment);
-      segment_iterable.with_iterators(position_filter, functor);
-    } else {
-      using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
+    // The functor was not called yet, because we did not instantiate specialized code for the segment type.
 
-      auto accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
+    const auto segment_iterable = create_any_segment_iterable<T>(referenced_segment);
+    segment_iterable.with_iterators(position_filter, functor);
+  }
 
-      resolve_pos_list_type(position_filter, [&](auto resolved_position_filter) {
-        const auto position_begin_it = resolved_position_filter->begin();
-        const auto position_end_it = resolved_position_filter->end();
+  // Dereferences the positions of a PosList that references multiple chunks. Instead of switching between the
+  // referenced chunks' accessors for every position (which are virtual calls), the positions are grouped by chunk (see
+  // ChunkGroupedPositions). For each referenced chunk, the segment is read through its typed iterable in the order of
+  // the ChunkOffsets. The values are scattered to their positions in the PosList, and these writes are prefetched.
+  static std::shared_ptr<const DereferencedValues> _dereference_batched(
+      const Table& referenced_table, const ColumnID referenced_column_id,
+      const std::shared_ptr<const AbstractPosList>& position_filter) {
+    const auto grouped_positions = group_positions_by_chunk_id(position_filter, referenced_table.chunk_count());
+
+    auto dereferenced_values = std::make_shared<DereferencedValues>();
+    auto& values = dereferenced_values->values;
+    auto& null_values = dereferenced_values->null_values;
+    values.resize(position_filter->size());
+    null_values.resize(position_filter->size());
+    for (const auto null_position : grouped_positions.null_positions) {
+      null_values[null_position] = true;
+    }
 
-        using PosListIteratorType = std::decay_t<decltype(position_begin_it)>;
+    // The PosList passed to the referenced segment's iterable is reused for all referenced chunks.
+    auto chunk_position_filter = std::make_shared<RowIDPosList>();
+    chunk_position_filter->guarantee_single_chunk();
 
-        auto begin = MultipleChunkIterator<PosListIteratorType>{referenced_table, referenced_column_id, accessors,
-                                                                position_begin_it, position_begin_it};
-        auto end = MultipleChunkIterator<PosListIteratorType>{referenced_table, referenced_column_id, accessors,
-                                                              position_begin_it, position_end_it};
+    const auto& original_positions = grouped_positions.original_positions;
+    const auto run_count = grouped_positions.chunk_ids.size();
+    for (auto run_index = size_t{0}; run_index < run_count; ++run_index) {
+      const auto chunk_id = grouped_positions.chunk_ids[run_index];
+      const auto run_begin = size_t{grouped_positions.run_begin(run_index)};
+      const auto run_end = size_t{grouped_positions.run_ends[run_index]};
 
-        functor(begin, end);
+      chunk_position_filter->clear();
+      for (auto position_index = run_begin; position_index < run_end; ++position_index) {
+        chunk_position_filter->emplace_back(chunk_id, grouped_positions.chunk_offsets[position_index]);
+      }
+
+      const auto referenced_segment = referenced_table.get_chunk(chunk_id)->get_segment(referenced_column_id);
+      auto position_index = run_begin;
+      _with_referenced_segment_iterators(*referenced_segment, chunk_position_filter, [&](auto it, const auto end) {
+        for (; it != end; ++it, ++position_index) {
+          if (position_index + PREFETCH_DISTANCE < run_end) {
+            __builtin_prefetch(&values[original_positions[position_index + PREFETCH_DISTANCE]], 1);
+          }
+
+          const auto original_position = original_positions[position_index];
+          if (it->is_null()) {
+            null_values[original_position] = true;
+          } else {
+            values[original_position] = it->value();
+          }
+        }
       });
     }
-  }
 
-  size_t _on_size() const {
-    return _segment.size();
+    return dereferenced_values;
   }
 
- private:
-  const ReferenceSegment& _segment;
-
  private:
   // The iterator for cases where we potentially iterate over multiple referenced chunks
   template <typename PosListIteratorType>
@@ -152,12 +238,14 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     explicit MultipleChunkIterator(
         const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
         const std::shared_ptr<std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>>& accessors,
+        const std::shared_ptr<const DereferencedValues>& dereferenced_values,
         const PosListIteratorType& begin_pos_list_it, const PosListIteratorType& pos_list_it)
         : _referenced_table{referenced_table},
           _referenced_column_id{referenced_column_id},
           _begin_pos_list_it{begin_pos_list_it},
           _pos_list_it{pos_list_it},
-          _accessors{accessors} {}
+          _accessors{accessors},
+          _dereferenced_values{dereferenced_values} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
@@ -185,6 +273,11 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     SegmentPosition<T> dereference() const {
       const auto pos_list_offset = static_cast<ChunkOffset>(_pos_list_it - _begin_pos_list_it);
 
+      if (_dereferenced_values) {
+        return SegmentPosition<T>{_dereferenced_values->values[pos_list_offset],
+                                  _dereferenced_values->null_values[pos_list_offset], pos_list_offset};
+      }
+
       if (_pos_list_it->is_null()) {
         return SegmentPosition<T>{T{}, true, pos_list_offset};
       }
@@ -220,6 +313,9 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
     // PointAccessIterators share vector with one accessor per chunk
     std::shared_ptr<std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>> _accessors;
+
+    // Set if the PosList was dereferenced in batches, nullptr otherwise
+    std::shared_ptr<const DereferencedValues> _dereferenced_values;
   };
 };
 
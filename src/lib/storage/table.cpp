@@ -14,8 +14,10 @@
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/key_hash/key_hash_index.hpp"
 #include "storage/index/partial_hash/partial_hash_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
@@ -613,11 +615,45 @@ void Table::create_partial_hash_index(const ColumnID column_id, const std::vecto
   _table_indexes_statistics.emplace_back(TableIndexStatistics{{column_id}, chunks_to_index});
 }
 
+void Table::create_key_hash_index(const TableKeyConstraint& table_key_constraint) {
+  Assert(_type == TableType::Data, "KeyHashIndexes can only be created on data tables.");
+  Assert(_table_key_constraints.contains(table_key_constraint), "KeyHashIndexes require a key constraint.");
+  Assert(std::none_of(_key_hash_indexes.cbegin(), _key_hash_indexes.cend(),
+                      [&](const auto& index) {
+                        return std::equal(index->column_ids().cbegin(), index->column_ids().cend(),
+                                          table_key_constraint.columns().cbegin(),
+                                          table_key_constraint.columns().cend());
+                      }),
+         "KeyHashIndex already exists.");
+
+  const auto key_hash_index = std::make_shared<KeyHashIndex>(*this, table_key_constraint);
+
+  // Validate the existing rows chunk by chunk. Bulk loads that create the index after loading the data are checked
+  // this way instead of row by row.
+  const auto chunk_count = _chunks.size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    if (!chunk) {
+      continue;
+    }
+
+    Assert(!key_hash_index->has_duplicates(*this, chunk_id, ChunkOffset{0}, chunk->size(), TransactionID{0}),
+           "Table data violates the key constraint of the KeyHashIndex.");
+  }
+
+  _key_hash_indexes.emplace_back(key_hash_index);
+}
+
+std::vector<std::shared_ptr<KeyHashIndex>> Table::key_hash_indexes() const {
+  return _key_hash_indexes;
+}
+
 template void Table::create_chunk_index<GroupKeyIndex>(const std::vector<ColumnID>& column_ids,
                                                        const std::string& name);
 template void Table::create_chunk_index<CompositeGroupKeyIndex>(const std::vector<ColumnID>& column_ids,
                                                                 const std::string& name);
 template void Table::create_chunk_index<AdaptiveRadixTreeIndex>(const std::vector<ColumnID>& column_ids,
                                                                 const std::string& name);
+template void Table::create_chunk_index<BTreeIndex>(const std::vector<ColumnID>& column_ids, const std::string& name);
 
 }  // namespace hyrise
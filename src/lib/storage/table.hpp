@@ -23,6 +23,7 @@
 
 namespace hyrise {
 
+class KeyHashIndex;
 class TableStatistics;
 
 /**
@@ -196,6 +197,16 @@ class Table : private Noncopyable {
    */
   void create_partial_hash_index(const ColumnID column_id, const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * Creates a KeyHashIndex on the columns of one of the table's key constraints. In contrast to other indexes, it
+   * covers all chunks (including mutable ones) and is maintained by the Insert operator, which also enforces the key
+   * constraint when committing (see Insert::_on_validate_commit). The existing rows have to satisfy the constraint.
+   * The index must not be created while other transactions modify the table.
+   */
+  void create_key_hash_index(const TableKeyConstraint& table_key_constraint);
+
+  std::vector<std::shared_ptr<KeyHashIndex>> key_hash_indexes() const;
+
   template <typename Index>
   void create_chunk_index(const std::vector<ColumnID>& column_ids, const std::string& name = "");
 
@@ -277,6 +288,7 @@ class Table : private Noncopyable {
   std::vector<ChunkIndexStatistics> _chunk_indexes_statistics;
   std::vector<TableIndexStatistics> _table_indexes_statistics;
   pmr_vector<std::shared_ptr<PartialHashIndex>> _table_indexes;
+  std::vector<std::shared_ptr<KeyHashIndex>> _key_hash_indexes;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
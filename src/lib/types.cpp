@@ -24,6 +24,13 @@ bool is_binary_numeric_predicate_condition(const PredicateCondition predicate_co
          predicate_condition == PredicateCondition::GreaterThanEquals;
 }
 
+bool is_inequality_predicate_condition(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
 bool is_between_predicate_condition(PredicateCondition predicate_condition) {
   return predicate_condition == PredicateCondition::BetweenInclusive ||
          predicate_condition == PredicateCondition::BetweenLowerExclusive ||
@@ -190,6 +190,9 @@ bool is_binary_predicate_condition(const PredicateCondition predicate_condition)
 // @return whether the PredicateCondition takes exactly two arguments and is not one of LIKE or IN
 bool is_binary_numeric_predicate_condition(const PredicateCondition predicate_condition);
 
+// @return whether the PredicateCondition is one of <, <=, >, >=
+bool is_inequality_predicate_condition(const PredicateCondition predicate_condition);
+
 bool is_between_predicate_condition(PredicateCondition predicate_condition);
 
 bool is_lower_inclusive_between(PredicateCondition predicate_condition);
@@ -232,6 +235,8 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+enum class UsePipelinedExecution : bool { Yes = true, No = false };
+
 enum class RollbackReason : bool { User, Conflict };
 
 enum class MemoryUsageCalculationMode { Sampled, Full };
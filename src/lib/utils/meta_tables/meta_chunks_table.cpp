@@ -9,7 +9,9 @@ MetaChunksTable::MetaChunksTable()
                                                {"chunk_id", DataType::Int, false},
                                                {"row_count", DataType::Long, false},
                                                {"invalid_row_count", DataType::Long, false},
-                                               {"cleanup_commit_id", DataType::Long, true}}) {}
+                                               {"cleanup_commit_id", DataType::Long, true},
+                                               {"mvcc_memory_usage", DataType::Long, true},
+                                               {"mvcc_memory_savings", DataType::Long, true}}) {}
 
 const std::string& MetaChunksTable::name() const {
   static const auto name = std::string{"chunks"};
@@ -30,8 +32,15 @@ std::shared_ptr<Table> MetaChunksTable::_on_generate() const {
       const auto cleanup_commit_id = chunk->get_cleanup_commit_id()
                                          ? AllTypeVariant{static_cast<int64_t>(*chunk->get_cleanup_commit_id())}
                                          : NULL_VALUE;
+      // The MVCC data is allocated lazily, mvcc_memory_savings holds the bytes saved by that (see MvccData).
+      const auto& mvcc_data = chunk->mvcc_data();
+      const auto mvcc_memory_usage =
+          mvcc_data ? AllTypeVariant{static_cast<int64_t>(mvcc_data->memory_usage())} : NULL_VALUE;
+      const auto mvcc_memory_savings =
+          mvcc_data ? AllTypeVariant{static_cast<int64_t>(mvcc_data->memory_savings())} : NULL_VALUE;
       output_table->append({pmr_string{table_name}, static_cast<int32_t>(chunk_id), static_cast<int64_t>(chunk->size()),
-                            static_cast<int64_t>(chunk->invalid_row_count()), cleanup_commit_id});
+                            static_cast<int64_t>(chunk->invalid_row_count()), cleanup_commit_id, mvcc_memory_usage,
+                            mvcc_memory_savings});
     }
   }
 
@@ -28,7 +28,9 @@ class AbstractSetting : public Noncopyable, public std::enable_shared_from_this<
 
   virtual const std::string& description() const = 0;
 
-  virtual const std::string& get() = 0;
+  // Returns the current value by value, so that callers never hold a reference to state that a concurrent set() may
+  // modify.
+  virtual std::string get() = 0;
 
   virtual void set(const std::string& value) = 0;
 
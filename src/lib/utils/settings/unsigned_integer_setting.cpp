@@ -0,0 +1,49 @@
+#include "unsigned_integer_setting.hpp"
+
+#include <charconv>
+
+#include "hyrise.hpp"
+#include "utils/assert.hpp"
+
+namespace hyrise {
+
+UnsignedIntegerSetting::UnsignedIntegerSetting(const std::string& init_name, const std::string& init_description,
+                                               const uint64_t init_value)
+    : AbstractSetting(init_name),
+      _description(init_description),
+      _value(init_value) {}
+
+const std::string& UnsignedIntegerSetting::description() const {
+  return _description;
+}
+
+std::string UnsignedIntegerSetting::get() {
+  return std::to_string(_value.load());
+}
+
+void UnsignedIntegerSetting::set(const std::string& value) {
+  auto parsed_value = uint64_t{0};
+  const auto* const value_end = value.data() + value.size();
+  const auto [parse_end, error] = std::from_chars(value.data(), value_end, parsed_value);
+  AssertInput(!value.empty() && error == std::errc{} && parse_end == value_end,
+              "Value '" + value + "' for setting " + name + " is not a non-negative integer.");
+
+  _value = parsed_value;
+}
+
+uint64_t UnsignedIntegerSetting::value() const {
+  return _value.load();
+}
+
+uint64_t UnsignedIntegerSetting::value_or_default(const std::string& setting_name, const uint64_t default_value) {
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  if (!settings_manager.has_setting(setting_name)) {
+    return default_value;
+  }
+
+  const auto setting = std::dynamic_pointer_cast<UnsignedIntegerSetting>(settings_manager.get_setting(setting_name));
+  Assert(setting, "Setting " + setting_name + " has an unexpected type.");
+  return setting->value();
+}
+
+}  // namespace hyrise
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+
+#include "abstract_setting.hpp"
+
+namespace hyrise {
+
+/**
+ * A setting holding a non-negative integer, such as a threshold or a budget. Components read the value via value(),
+ * which does not involve any string conversion or locking and can thus be called on hot paths (e.g., once per
+ * optimized query). set() accepts decimal numbers only and throws an InvalidInputException otherwise.
+ */
+class UnsignedIntegerSetting : public AbstractSetting {
+ public:
+  UnsignedIntegerSetting(const std::string& init_name, const std::string& init_description, const uint64_t init_value);
+
+  const std::string& description() const final;
+
+  std::string get() final;
+
+  void set(const std::string& value) final;
+
+  uint64_t value() const;
+
+  // Returns the value of the registered UnsignedIntegerSetting with the given name or default_value if no such setting
+  // is registered.
+  static uint64_t value_or_default(const std::string& setting_name, const uint64_t default_value);
+
+ private:
+  const std::string _description;
+  std::atomic<uint64_t> _value;
+};
+
+}  // namespace hyrise
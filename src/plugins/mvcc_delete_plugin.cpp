@@ -60,14 +60,8 @@ void MvccDeletePlugin::_logical_delete_loop() {
         }
 
         // Calculate metric 2 – Chunk Hotness
-        auto highest_end_commit_id = CommitID{0};
-        const auto chunk_size = chunk->size();
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          const auto commit_id = chunk->mvcc_data()->get_end_cid(chunk_offset);
-          if (commit_id != MvccData::MAX_COMMIT_ID && commit_id > highest_end_commit_id) {
-            highest_end_commit_id = commit_id;
-          }
-        }
+        // Only the pages of the MVCC data that hold deleted rows have to be visited (see MvccData).
+        const auto highest_end_commit_id = chunk->mvcc_data()->max_end_cid();
 
         const auto criterion2 =
             highest_end_commit_id + DELETE_THRESHOLD_LAST_COMMIT <= Hyrise::get().transaction_manager.last_commit_id();
@@ -168,7 +162,11 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
     return false;
   }
 
-  transaction_context->commit();
+  // The commit fails if validating the re-inserted rows rolled the transaction back.
+  if (!transaction_context->commit()) {
+    return false;
+  }
+
   // Mark chunk as logically deleted
   chunk->set_cleanup_commit_id(transaction_context->commit_id());
   return true;
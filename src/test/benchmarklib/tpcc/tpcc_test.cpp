@@ -35,7 +35,7 @@ class TPCCTest : public BaseTest {
       auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
       insert->set_transaction_context(transaction_context);
       insert->execute();
-      transaction_context->commit();
+      EXPECT_TRUE(transaction_context->commit());
     }
   }
 
@@ -2,6 +2,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -81,7 +82,7 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
   const auto prev_last_commit_id = manager().last_commit_id();
 
   auto try_commit_context_2 = [&]() {
-    context_2->commit_async(empty_callback);
+    EXPECT_TRUE(context_2->commit_async(empty_callback));
 
     EXPECT_EQ(prev_last_commit_id, manager().last_commit_id());
   };
@@ -99,7 +100,7 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
    * - context_1 commits, followed by context_2
    *
    */
-  context_1->commit_async(empty_callback);
+  EXPECT_TRUE(context_1->commit_async(empty_callback));
 
   EXPECT_EQ(context_2->commit_id(), manager().last_commit_id());
 }
@@ -117,7 +118,7 @@ TEST_F(TransactionContextTest, CommitShouldIncreaseCommitIDIfReadWrite) {
   validate_op->execute();
   delete_op->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 1);
 }
@@ -133,7 +134,7 @@ TEST_F(TransactionContextTest, CommitShouldNotIncreaseCommitIDIfReadOnly) {
   get_table_op->execute();
   validate_op->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
 }
@@ -148,8 +149,8 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   auto context_2_committed = false;
   auto callback_2 = [&context_2_committed](TransactionID) { context_2_committed = true; };
 
-  context_2->commit_async(callback_2);
-  context_1->commit_async(callback_1);
+  EXPECT_TRUE(context_2->commit_async(callback_2));
+  EXPECT_TRUE(context_1->commit_async(callback_1));
 
   EXPECT_TRUE(context_1_committed);
   EXPECT_TRUE(context_2_committed);
@@ -161,7 +162,7 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
 TEST_F(TransactionContextTest, CommitWithFailedOperator) {
   auto context = manager().new_transaction_context(AutoCommit::No);
   context->rollback(RollbackReason::Conflict);
-  EXPECT_ANY_THROW(context->commit());
+  EXPECT_ANY_THROW(std::ignore = context->commit());
 }
 
 }  // namespace hyrise
@@ -1,10 +1,17 @@
 #include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
 
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "operators/abstract_read_write_operator.hpp"
+#include "sql/sql_pipeline_builder.hpp"
 
 namespace hyrise {
 
@@ -12,24 +19,67 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::unordered_multiset<CommitID> get_active_snapshot_commit_ids() {
+    const auto& manager = Hyrise::get().transaction_manager;
+    auto snapshot_commit_ids = manager._overflow_snapshot_commit_ids;
+    for (const auto& slot : manager._snapshot_slots) {
+      if (slot.snapshot_commit_id != TransactionManager::UNUSED_SNAPSHOT_SLOT) {
+        snapshot_commit_ids.insert(slot.snapshot_commit_id);
+      }
+    }
+    return snapshot_commit_ids;
   }
 
-  static void register_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
+  static size_t register_transaction(CommitID snapshot_commit_id) {
+    return Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
   }
 
-  static void deregister_transaction(CommitID snapshot_commit_id) {
-    Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id);
+  static void deregister_transaction(CommitID snapshot_commit_id, size_t snapshot_slot) {
+    Hyrise::get().transaction_manager._deregister_transaction(snapshot_commit_id, snapshot_slot);
   }
+
+  static void set_group_commit_leader_active(const bool leader_active) {
+    Hyrise::get().transaction_manager._group_commit_leader_active = leader_active;
+  }
+
+  static constexpr auto SNAPSHOT_SLOT_COUNT = TransactionManager::SNAPSHOT_SLOT_COUNT;
+  static constexpr auto OVERFLOW_SNAPSHOT_SLOT = TransactionManager::OVERFLOW_SNAPSHOT_SLOT;
 };
 
-/** Check if all active snapshot commit ids of uncommitted
- * transaction contexts are tracked correctly.
- * Normally, deregister_transaction() is called in the
- * destructor of the transaction context but is called
- * manually for this test.
+// Read-write operator whose records cannot be committed.
+class FailingCommitOperator : public AbstractReadWriteOperator {
+ public:
+  FailingCommitOperator() : AbstractReadWriteOperator(OperatorType::Mock) {}
+
+  const std::string& name() const override {
+    static const auto name = std::string{"FailingCommitOperator"};
+    return name;
+  }
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> /*context*/) override {
+    return nullptr;
+  }
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& /*copied_left_input*/,
+      const std::shared_ptr<AbstractOperator>& /*copied_right_input*/,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& /*copied_ops*/) const override {
+    Fail("Unexpected function call");
+  }
+
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& /*parameters*/) override {}
+
+  void _on_commit_records(const CommitID /*commit_id*/) override {
+    throw std::runtime_error{"Records cannot be committed."};
+  }
+
+  void _on_rollback_records() override {}
+};
+
+/**
+ * Check if all active snapshot commit ids of uncommitted transaction contexts are tracked correctly. The transaction
+ * contexts deregister their snapshot commit id when they are destroyed.
  */
 TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   auto& manager = Hyrise::get().transaction_manager;
@@ -37,52 +87,276 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
 
-  const auto t1_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t2_context = manager.new_transaction_context(AutoCommit::No);
-  const auto t3_context = manager.new_transaction_context(AutoCommit::No);
+  auto t1_context = manager.new_transaction_context(AutoCommit::No);
+  auto t2_context = manager.new_transaction_context(AutoCommit::No);
+  auto t3_context = manager.new_transaction_context(AutoCommit::No);
 
-  const CommitID t1_snapshot_commit_id = t1_context->snapshot_commit_id();
-  const CommitID t2_snapshot_commit_id = t2_context->snapshot_commit_id();
-  const CommitID t3_snapshot_commit_id = t3_context->snapshot_commit_id();
-  const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
+  const auto vec = std::vector<CommitID>{t1_context->snapshot_commit_id(), t2_context->snapshot_commit_id(),
+                                         t3_context->snapshot_commit_id()};
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
+  for (const auto snapshot_commit_id : vec) {
+    EXPECT_TRUE(get_active_snapshot_commit_ids().contains(snapshot_commit_id));
+  }
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
-  t1_context->commit();
-  deregister_transaction(t1_context->snapshot_commit_id());
+  EXPECT_TRUE(t1_context->commit());
+  t1_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_context->snapshot_commit_id()));
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t3_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
-  t3_context->commit();
-  deregister_transaction(t3_context->snapshot_commit_id());
+  EXPECT_TRUE(t3_context->commit());
+  t3_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().contains(t2_context->snapshot_commit_id()));
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
-  t2_context->commit();
-  deregister_transaction(t2_context->snapshot_commit_id());
+  EXPECT_TRUE(t2_context->commit());
+  t2_context = nullptr;
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, LowestActiveSnapshotCommitID) {
+  const auto& manager = Hyrise::get().transaction_manager;
+
+  const auto slot_5 = register_transaction(CommitID{5});
+  const auto slot_3 = register_transaction(CommitID{3});
+  const auto slot_7 = register_transaction(CommitID{7});
+  EXPECT_NE(slot_5, slot_3);
+  EXPECT_NE(slot_3, slot_7);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{3});
+
+  // The slot has to match the snapshot commit id.
+  EXPECT_THROW(deregister_transaction(CommitID{5}, slot_3), std::logic_error);
+
+  deregister_transaction(CommitID{3}, slot_3);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+
+  const auto slot_6 = register_transaction(CommitID{6});
+  EXPECT_NE(slot_6, slot_5);
+  EXPECT_NE(slot_6, slot_7);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+
+  deregister_transaction(CommitID{5}, slot_5);
+  deregister_transaction(CommitID{6}, slot_6);
+  deregister_transaction(CommitID{7}, slot_7);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, OverflowSnapshotCommitIDs) {
+  const auto& manager = Hyrise::get().transaction_manager;
+
+  auto slots = std::vector<size_t>{};
+  for (auto slot_index = size_t{0}; slot_index < SNAPSHOT_SLOT_COUNT; ++slot_index) {
+    slots.emplace_back(register_transaction(CommitID{10}));
+  }
+  EXPECT_EQ(std::unordered_set<size_t>(slots.cbegin(), slots.cend()).size(), SNAPSHOT_SLOT_COUNT);
+
+  // All slots are taken, further snapshot commit ids are tracked in the overflow set.
+  EXPECT_EQ(register_transaction(CommitID{4}), OVERFLOW_SNAPSHOT_SLOT);
+  EXPECT_EQ(register_transaction(CommitID{5}), OVERFLOW_SNAPSHOT_SLOT);
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), SNAPSHOT_SLOT_COUNT + 2);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{4});
+
+  deregister_transaction(CommitID{4}, OVERFLOW_SNAPSHOT_SLOT);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{5});
+  deregister_transaction(CommitID{5}, OVERFLOW_SNAPSHOT_SLOT);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{10});
+
+  for (const auto slot : slots) {
+    deregister_transaction(CommitID{10}, slot);
+  }
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentRegistration) {
+  const auto& manager = Hyrise::get().transaction_manager;
+  const auto blocker_slot = register_transaction(CommitID{2});
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = CommitID::base_type{0}; thread_id < 8; ++thread_id) {
+    threads.emplace_back([thread_id]() {
+      for (auto iteration = 0; iteration < 1000; ++iteration) {
+        const auto snapshot_commit_id = CommitID{3 + thread_id};
+        deregister_transaction(snapshot_commit_id, register_transaction(snapshot_commit_id));
+      }
+    });
+  }
+
+  for (auto check = 0; check < 100; ++check) {
+    EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{2});
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  deregister_transaction(CommitID{2}, blocker_slot);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, GroupCommit) {
+  auto& manager = Hyrise::get().transaction_manager;
+  EXPECT_FALSE(manager.group_commit());
+  manager.set_group_commit(true);
+  EXPECT_TRUE(manager.group_commit());
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto insert = [](const std::shared_ptr<TransactionContext>& context, const int32_t value) {
+    auto pipeline = SQLPipelineBuilder{"INSERT INTO t VALUES (" + std::to_string(value) + ")"}
+                        .with_transaction_context(context)
+                        .create_pipeline();
+    EXPECT_EQ(pipeline.get_result_table().first, SQLPipelineStatus::Success);
+  };
+
+  // Without concurrent commits, each group consists of a single transaction.
+  const auto initial_commit_id = manager.last_commit_id();
+  const auto context_1 = manager.new_transaction_context(AutoCommit::No);
+  insert(context_1, 1);
+  EXPECT_TRUE(context_1->commit());
+  EXPECT_EQ(context_1->commit_id(), CommitID{initial_commit_id + 1});
+  EXPECT_EQ(manager.last_commit_id(), CommitID{initial_commit_id + 1});
+
+  // While another leader is busy, committing transactions are queued ...
+  set_group_commit_leader_active(true);
+  const auto context_2 = manager.new_transaction_context(AutoCommit::No);
+  const auto context_3 = manager.new_transaction_context(AutoCommit::No);
+  insert(context_2, 2);
+  insert(context_3, 3);
+
+  auto committed_transaction_count = size_t{0};
+  const auto callback = [&](const TransactionID /*transaction_id*/) { ++committed_transaction_count; };
+  EXPECT_TRUE(context_2->commit_async(callback));
+  EXPECT_TRUE(context_3->commit_async(callback));
+  EXPECT_EQ(committed_transaction_count, 0);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committing);
+  EXPECT_EQ(context_3->phase(), TransactionPhase::Committing);
+  EXPECT_EQ(manager.last_commit_id(), CommitID{initial_commit_id + 1});
+
+  // ... and committed together with the transaction that becomes the next leader.
+  set_group_commit_leader_active(false);
+  const auto context_4 = manager.new_transaction_context(AutoCommit::No);
+  insert(context_4, 4);
+  EXPECT_TRUE(context_4->commit());
+
+  EXPECT_EQ(committed_transaction_count, 2);
+  for (const auto& context : {context_2, context_3, context_4}) {
+    EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+    EXPECT_EQ(context->commit_id(), CommitID{initial_commit_id + 2});
+  }
+  EXPECT_EQ(manager.last_commit_id(), CommitID{initial_commit_id + 2});
+
+  const auto [status, result_table] = SQLPipelineBuilder{"SELECT * FROM t"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 4);
+}
+
+TEST_F(TransactionManagerTest, GroupCommitWithConcurrentCommitters) {
+  auto& manager = Hyrise::get().transaction_manager;
+  manager.set_group_commit(true);
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  // Every synchronous commit has to return even if other threads keep queueing transactions, i.e., a leader must not
+  // be kept busy by the commits of other transactions.
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto COMMITS_PER_THREAD = 50;
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(THREAD_COUNT);
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto commit_id = 0; commit_id < COMMITS_PER_THREAD; ++commit_id) {
+        const auto context = manager.new_transaction_context(AutoCommit::No);
+        auto pipeline = SQLPipelineBuilder{"INSERT INTO t VALUES (" + std::to_string(thread_id) + ")"}
+                            .with_transaction_context(context)
+                            .create_pipeline();
+        EXPECT_EQ(pipeline.get_result_table().first, SQLPipelineStatus::Success);
+        EXPECT_TRUE(context->commit());
+        EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto [status, result_table] = SQLPipelineBuilder{"SELECT * FROM t"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), THREAD_COUNT * COMMITS_PER_THREAD);
+}
+
+TEST_F(TransactionManagerTest, GroupCommitWithFailingTransactions) {
+  auto& manager = Hyrise::get().transaction_manager;
+  manager.set_group_commit(true);
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  const auto insert = [](const std::shared_ptr<TransactionContext>& context, const int32_t value) {
+    auto pipeline = SQLPipelineBuilder{"INSERT INTO t VALUES (" + std::to_string(value) + ")"}
+                        .with_transaction_context(context)
+                        .create_pipeline();
+    EXPECT_EQ(pipeline.get_result_table().first, SQLPipelineStatus::Success);
+  };
+
+  // The records of the FailingCommitOperator are committed first. Thus, the inserts of the failing transactions are
+  // not committed yet when the commit fails and can be rolled back.
+  const auto create_failing_transaction = [&](const int32_t value) {
+    const auto context = manager.new_transaction_context(AutoCommit::No);
+    const auto failing_operator = std::make_shared<FailingCommitOperator>();
+    failing_operator->set_transaction_context(context);
+    failing_operator->execute();
+    insert(context, value);
+    return context;
+  };
+
+  // Two transactions are queued while another leader is busy. One of them fails.
+  const auto initial_commit_id = manager.last_commit_id();
+  set_group_commit_leader_active(true);
+  const auto failing_context = create_failing_transaction(1);
+  const auto context_2 = manager.new_transaction_context(AutoCommit::No);
+  insert(context_2, 2);
+
+  auto callback_count = size_t{0};
+  const auto callback = [&](const TransactionID /*transaction_id*/) { ++callback_count; };
+  EXPECT_TRUE(failing_context->commit_async(callback));
+  EXPECT_TRUE(context_2->commit_async(callback));
+  set_group_commit_leader_active(false);
+
+  // The next committer leads the group. As its own transaction fails, too, the exception is rethrown to it.
+  const auto failing_waiting_context = create_failing_transaction(3);
+  EXPECT_THROW(static_cast<void>(failing_waiting_context->commit()), std::runtime_error);
+
+  // The other transaction of the group is committed. The failed ones are rolled back, and the asynchronous committer
+  // is notified nonetheless.
+  EXPECT_EQ(callback_count, 2);
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(failing_context->phase(), TransactionPhase::RolledBackAfterConflict);
+  EXPECT_EQ(failing_waiting_context->phase(), TransactionPhase::RolledBackAfterConflict);
+  EXPECT_EQ(manager.last_commit_id(), CommitID{initial_commit_id + 1});
+
+  // Later commits are not affected.
+  const auto context_4 = manager.new_transaction_context(AutoCommit::No);
+  insert(context_4, 4);
+  EXPECT_TRUE(context_4->commit());
+  EXPECT_EQ(manager.last_commit_id(), CommitID{initial_commit_id + 2});
 
-  // To prevent exceptions in TransactionContext destructor
-  register_transaction(t1_snapshot_commit_id);
-  register_transaction(t2_snapshot_commit_id);
-  register_transaction(t3_snapshot_commit_id);
+  const auto [status, result_table] = SQLPipelineBuilder{"SELECT * FROM t"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_EQ(result_table->row_count(), 2);
 }
 
 }  // namespace hyrise
@@ -0,0 +1,217 @@
+#include "base_test.hpp"
+
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/evaluation/expression_program.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class ExpressionProgramTest : public BaseTest {
+ public:
+  void SetUp() override {
+    table_a = load_table("resources/test_data/tbl/expression_evaluator/input_a.tbl", ChunkOffset{3});
+    a = PQPColumnExpression::from_table(*table_a, "a");
+    b = PQPColumnExpression::from_table(*table_a, "b");
+    c = PQPColumnExpression::from_table(*table_a, "c");
+    e = PQPColumnExpression::from_table(*table_a, "e");
+    f = PQPColumnExpression::from_table(*table_a, "f");
+    s1 = PQPColumnExpression::from_table(*table_a, "s1");
+
+    table_bools = load_table("resources/test_data/tbl/expression_evaluator/input_bools.tbl");
+    bool_a = PQPColumnExpression::from_table(*table_bools, "a");
+    bool_b = PQPColumnExpression::from_table(*table_bools, "b");
+    bool_c = PQPColumnExpression::from_table(*table_bools, "c");
+
+    // Larger than ExpressionProgram::BATCH_SIZE, so that chunks are processed in several batches.
+    const auto column_definitions =
+        TableColumnDefinitions{{"x", DataType::Int, true}, {"y", DataType::Long, false}, {"z", DataType::Double, true}};
+    table_large = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2'500});
+    for (auto row_id = int32_t{0}; row_id < 3'000; ++row_id) {
+      const auto x_value = row_id % 11 == 0 ? AllTypeVariant{} : AllTypeVariant{row_id % 7};
+      const auto z_value = row_id % 13 == 0 ? AllTypeVariant{} : AllTypeVariant{row_id / 3.0};
+      table_large->append({x_value, int64_t{row_id}, z_value});
+    }
+    x = PQPColumnExpression::from_table(*table_large, "x");
+    y = PQPColumnExpression::from_table(*table_large, "y");
+    z = PQPColumnExpression::from_table(*table_large, "z");
+  }
+
+  // Compares the result of the program with the result of the ExpressionEvaluator for each chunk.
+  static void expect_same_segments(const std::shared_ptr<Table>& table,
+                                   const std::shared_ptr<AbstractExpression>& expression) {
+    const auto program = ExpressionProgram::compile(expression, *table);
+    ASSERT_TRUE(program) << "Could not compile " << *expression;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto expected_segment = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_segment(*expression);
+      const auto actual_segment = program->evaluate_to_segment(*table->get_chunk(chunk_id));
+
+      EXPECT_EQ(actual_segment->data_type(), expected_segment->data_type()) << *expression;
+      // The ExpressionEvaluator makes some results nullable even if they cannot contain NULLs (see ExpressionProgram).
+      // The NULLs themselves are compared below.
+      EXPECT_TRUE(!actual_segment->is_nullable() || expected_segment->is_nullable()) << *expression;
+      ASSERT_EQ(actual_segment->size(), expected_segment->size()) << *expression;
+
+      const auto segment_size = expected_segment->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        const auto expected_value = (*expected_segment)[chunk_offset];
+        const auto actual_value = (*actual_segment)[chunk_offset];
+        if (variant_is_null(expected_value)) {
+          EXPECT_TRUE(variant_is_null(actual_value)) << *expression << " at " << chunk_offset;
+        } else {
+          EXPECT_EQ(actual_value, expected_value) << *expression << " at " << chunk_offset;
+        }
+      }
+    }
+  }
+
+  static void expect_same_pos_lists(const std::shared_ptr<Table>& table,
+                                    const std::shared_ptr<AbstractExpression>& expression) {
+    const auto program = ExpressionProgram::compile(expression, *table);
+    ASSERT_TRUE(program) << "Could not compile " << *expression;
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto expected_pos_list = ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_pos_list(*expression);
+      const auto actual_pos_list = program->evaluate_to_pos_list(*table->get_chunk(chunk_id), chunk_id);
+      EXPECT_EQ(actual_pos_list, expected_pos_list) << *expression;
+    }
+  }
+
+  std::shared_ptr<Table> table_a, table_bools, table_large;
+  std::shared_ptr<PQPColumnExpression> a, b, c, e, f, s1, bool_a, bool_b, bool_c, x, y, z;
+};
+
+TEST_F(ExpressionProgramTest, UnsupportedExpressions) {
+  EXPECT_FALSE(ExpressionProgram::compile(s1, *table_a));
+  EXPECT_FALSE(ExpressionProgram::compile(like_(s1, "%a%"), *table_a));
+  EXPECT_FALSE(ExpressionProgram::compile(in_(a, list_(1, 2)), *table_a));
+  EXPECT_FALSE(ExpressionProgram::compile(add_(a, cast_(s1, DataType::Int)), *table_a));
+  EXPECT_FALSE(ExpressionProgram::compile(and_(greater_than_(a, 1), like_(s1, "%a%")), *table_a));
+  EXPECT_FALSE(ExpressionProgram::compile(case_(greater_than_(a, 1), s1, "b"), *table_a));
+}
+
+TEST_F(ExpressionProgramTest, ResultTypeAndNullability) {
+  const auto program_a = ExpressionProgram::compile(add_(a, e), *table_a);
+  ASSERT_TRUE(program_a);
+  EXPECT_EQ(program_a->result_data_type(), DataType::Float);
+  EXPECT_FALSE(program_a->result_is_nullable());
+
+  const auto program_b = ExpressionProgram::compile(less_than_(a, c), *table_a);
+  ASSERT_TRUE(program_b);
+  EXPECT_EQ(program_b->result_data_type(), DataType::Int);
+  EXPECT_TRUE(program_b->result_is_nullable());
+
+  const auto program_c = ExpressionProgram::compile(is_null_(c), *table_a);
+  ASSERT_TRUE(program_c);
+  EXPECT_FALSE(program_c->result_is_nullable());
+}
+
+TEST_F(ExpressionProgramTest, NullabilityIsDerivedFromOperands) {
+  const auto expect_nullable = [&](const std::shared_ptr<AbstractExpression>& expression, const bool nullable) {
+    const auto program = ExpressionProgram::compile(expression, *table_a);
+    ASSERT_TRUE(program) << "Could not compile " << *expression;
+    EXPECT_EQ(program->result_is_nullable(), nullable) << *expression;
+  };
+
+  // Division and modulo are only nullable if the divisor can be zero or if an operand is nullable.
+  expect_nullable(div_(a, 2), false);
+  expect_nullable(mod_(e, 3), false);
+  expect_nullable(div_(a, b), true);
+  expect_nullable(mod_(a, 0), true);
+  expect_nullable(div_(c, 2), true);
+
+  // AND and OR are nullable if one of their sides is.
+  expect_nullable(and_(greater_than_(a, 1), less_than_(b, 3)), false);
+  expect_nullable(or_(greater_than_(a, 1), less_than_(c, 3)), true);
+
+  // For CASE, a NULL condition selects ELSE. Thus, only THEN and ELSE determine the nullability.
+  expect_nullable(case_(greater_than_(c, 1), a, b), false);
+  expect_nullable(case_(greater_than_(a, 1), a, null_()), true);
+
+  expect_same_segments(table_a, div_(a, 2));
+  expect_same_segments(table_a, and_(greater_than_(a, 1), less_than_(b, 3)));
+  expect_same_segments(table_a, case_(greater_than_(c, 1), a, b));
+}
+
+TEST_F(ExpressionProgramTest, CommonSubExpressions) {
+  // a + b is computed once.
+  const auto program = ExpressionProgram::compile(mul_(add_(a, b), add_(a, b)), *table_a);
+  ASSERT_TRUE(program);
+  EXPECT_EQ(program->instruction_count(), 2);
+}
+
+TEST_F(ExpressionProgramTest, Arithmetics) {
+  expect_same_segments(table_a, add_(a, b));
+  expect_same_segments(table_a, add_(a, c));
+  expect_same_segments(table_a, sub_(e, a));
+  expect_same_segments(table_a, mul_(f, c));
+  expect_same_segments(table_a, div_(a, b));
+  expect_same_segments(table_a, div_(f, sub_(a, 1)));
+  expect_same_segments(table_a, mod_(b, a));
+  expect_same_segments(table_a, mod_(e, 3));
+  expect_same_segments(table_a, mod_(f, e));
+  expect_same_segments(table_a, unary_minus_(c));
+  expect_same_segments(table_a, add_(a, null_()));
+  expect_same_segments(table_a, add_(5, 3));
+  expect_same_segments(table_large, add_(y, z));
+}
+
+TEST_F(ExpressionProgramTest, Predicates) {
+  expect_same_segments(table_a, equals_(a, 2));
+  expect_same_segments(table_a, not_equals_(a, c));
+  expect_same_segments(table_a, less_than_(e, a));
+  expect_same_segments(table_a, less_than_equals_(c, f));
+  expect_same_segments(table_a, greater_than_(a, e));
+  expect_same_segments(table_a, greater_than_equals_(c, 33));
+  expect_same_segments(table_a, between_inclusive_(a, 2, 3));
+  expect_same_segments(table_a, between_exclusive_(c, 30, b));
+  expect_same_segments(table_a, between_upper_exclusive_(e, null_(), 100));
+  expect_same_segments(table_a, is_null_(c));
+  expect_same_segments(table_a, is_not_null_(add_(a, c)));
+  expect_same_segments(table_a, equals_(a, null_()));
+}
+
+TEST_F(ExpressionProgramTest, TernaryLogic) {
+  expect_same_segments(table_bools, and_(bool_a, bool_c));
+  expect_same_segments(table_bools, and_(bool_c, bool_a));
+  expect_same_segments(table_bools, or_(bool_a, bool_c));
+  expect_same_segments(table_bools, or_(bool_c, bool_b));
+  expect_same_segments(table_bools, and_(or_(bool_a, bool_c), bool_b));
+  expect_same_segments(table_bools, or_(and_(bool_c, bool_a), and_(bool_b, bool_c)));
+  expect_same_segments(table_bools, and_(bool_c, null_()));
+  expect_same_segments(table_bools, or_(null_(), bool_a));
+}
+
+TEST_F(ExpressionProgramTest, Case) {
+  expect_same_segments(table_a, case_(greater_than_(a, 2), b, f));
+  expect_same_segments(table_a, case_(c, a, null_()));
+  expect_same_segments(table_a, case_(greater_than_(a, 10), 1, 2));
+  expect_same_segments(table_a, case_(less_than_(a, 10), c, e));
+  expect_same_segments(table_a, case_(greater_than_(a, 1), case_(equals_(a, 2), mul_(a, b), div_(b, c)), mul_(a, b)));
+  expect_same_segments(table_bools, case_(and_(bool_a, bool_c), bool_b, case_(bool_c, 5, 7)));
+}
+
+TEST_F(ExpressionProgramTest, MultipleBatches) {
+  ChunkEncoder::encode_chunks(table_large, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::Dictionary});
+
+  expect_same_segments(table_large, add_(x, y));
+  expect_same_segments(table_large, div_(z, x));
+  expect_same_segments(table_large, case_(greater_than_(x, 3), mul_(x, z), case_(equals_(x, 0), y, add_(x, z))));
+  expect_same_segments(table_large, and_(greater_than_(x, 2), less_than_(z, 500)));
+  expect_same_segments(table_large, or_(is_null_(x), greater_than_(y, 2'000)));
+
+  expect_same_pos_lists(table_large, less_than_(x, 3));
+  expect_same_pos_lists(table_large, between_inclusive_(z, 100, 200));
+  expect_same_pos_lists(table_large, and_(greater_than_(x, 2), less_than_(z, 500)));
+  expect_same_pos_lists(table_large, or_(is_null_(z), and_(equals_(x, 1), greater_than_(y, 1'000))));
+}
+
+}  // namespace hyrise
@@ -47,12 +47,62 @@ TEST_F(LikeMatcherTest, Matching) {
   EXPECT_TRUE(match("Hello World!! (Nice day)", "H%(%day)"));
   EXPECT_TRUE(match("Smiley: ^-^", "%^_^%"));
   EXPECT_TRUE(match("Questionmark: ?", "%_?%"));
+  EXPECT_TRUE(match("Brackets: [a]", "%[_]"));
+  EXPECT_TRUE(match("Hello", "H_l%"));
+  EXPECT_TRUE(match("Hello World", "H%o%o%d"));
+  EXPECT_TRUE(match("Hello World", "%l_o%W%"));
+  EXPECT_TRUE(match("Line\nBreak", "Line_Break"));
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("", "%%"));
 }
 
 TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_FALSE(match("Hello", "%l_o%"));
+  EXPECT_FALSE(match("Hello World", "%o%W"));
+  EXPECT_FALSE(match("Hello World", "H%o%o%o%d"));
+  EXPECT_FALSE(match("abab", "ab%bab"));
+  EXPECT_FALSE(match("Brackets: [a]", "%[ab]"));
+}
+
+TEST_F(LikeMatcherTest, PatternVariants) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::StartsWithPattern>(LikeMatcher{"abc%"}.pattern_variant()));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::EndsWithPattern>(LikeMatcher{"%abc"}.pattern_variant()));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::ContainsPattern>(LikeMatcher{"%abc%"}.pattern_variant()));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::MultipleContainsPattern>(LikeMatcher{"%a%b%"}.pattern_variant()));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::MultipleContainsPattern>(LikeMatcher{"%"}.pattern_variant()));
+
+  // MultipleContainsPatterns have to end with '%'.
+  const auto like_matcher = LikeMatcher{"%a%b"};
+  const auto* glob_pattern = std::get_if<LikeMatcher::GlobPattern>(&like_matcher.pattern_variant());
+  ASSERT_TRUE(glob_pattern);
+  ASSERT_EQ(glob_pattern->parts.size(), 3u);
+  EXPECT_EQ(glob_pattern->parts[0].string, "");
+  EXPECT_EQ(glob_pattern->parts[1].string, "a");
+  EXPECT_EQ(glob_pattern->parts[2].string, "b");
+  EXPECT_EQ(glob_pattern->min_size, 2u);
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  EXPECT_EQ(LikeMatcher::find("Hello", ""), 0u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "", 5), 5u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "", 6), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find("Hello", "l"), 2u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "l", 3), 3u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "lo"), 3u);
+  EXPECT_EQ(LikeMatcher::find("Hello", "Hello!"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find("Hello", "l_"), std::string_view::npos);
+
+  // Long enough to be searched in blocks. Candidates where only the first and the last character match are skipped.
+  const auto string = std::string(100, 'a') + "axya" + std::string(50, 'a') + "axa";
+  EXPECT_EQ(LikeMatcher::find(string, "axa"), 154u);
+  EXPECT_EQ(LikeMatcher::find(string, "xya"), 101u);
+  EXPECT_EQ(LikeMatcher::find(string, "xya", 102), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(string, "aaaa", 10), 10u);
+  EXPECT_EQ(LikeMatcher::find(string, std::string(50, 'a') + "x"), 51u);
 }
 
 TEST_F(LikeMatcherTest, LowerUpperBound) {
@@ -648,6 +648,34 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelated) {
   EXPECT_FALSE(pqp_b->executed());
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelatedWithRepeatedParameters) {
+  // Correlated subqueries are executed once per distinct parameter value and in batches. Use more distinct values than
+  // a single batch holds, repeated values, and repeated NULLs to make sure each row receives the result for its value.
+  const auto row_count = 250;
+  auto values = pmr_vector<int32_t>(row_count);
+  auto nulls = pmr_vector<bool>(row_count);
+  auto expected = std::vector<std::optional<int32_t>>(row_count);
+  for (auto row_idx = 0; row_idx < row_count; ++row_idx) {
+    values[row_idx] = row_idx % 100;
+    nulls[row_idx] = values[row_idx] == 99;
+    if (!nulls[row_idx]) {
+      expected[row_idx] = values[row_idx] >= 1 && values[row_idx] <= 4;
+    }
+  }
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"v", DataType::Int, true}}, TableType::Data);
+  table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(nulls))});
+  const auto v = PQPColumnExpression::from_table(*table, "v");
+
+  // PQP that returns the column "a" (1, 2, 3, 4) added to the current value in "v"
+  const auto table_wrapper_a = std::make_shared<TableWrapper>(table_a);
+  const auto add_v = add_(correlated_parameter_(ParameterID{0}, v), a);
+  const auto pqp = std::make_shared<Projection>(table_wrapper_a, expression_vector(add_v));
+  const auto subquery = pqp_subquery_(pqp, DataType::Int, true, std::make_pair(ParameterID{0}, ColumnID{0}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table, *in_(5, subquery), expected));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, NotInListLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_())), {std::nullopt}));
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_(), 3)), {std::nullopt}));
@@ -48,7 +48,7 @@ TEST_F(HyriseTest, GetAndResetHyrise) {
   get_table->execute();
   validate->execute();
   delete_op->execute();
-  transaction_context->commit();
+  EXPECT_TRUE(transaction_context->commit());
 
   EXPECT_EQ(hyrise.transaction_manager.last_commit_id(), CommitID{2});
 
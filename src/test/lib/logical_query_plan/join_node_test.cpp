@@ -95,6 +95,11 @@ TEST_F(JoinNodeTest, HashingAndEqualityCheck) {
 
   EXPECT_NE(_semi_join_node->hash(), _semi_join_reduction_node->hash());
   EXPECT_NE(*_semi_join_reduction_node, *_semi_join_node);
+
+  other_join_node_d->index_side = LQPInputSide::Right;
+  EXPECT_NE(*other_join_node_d, *_inner_join_node);
+  EXPECT_NE(other_join_node_d->hash(), _inner_join_node->hash());
+  EXPECT_EQ(*other_join_node_d, *other_join_node_d->deep_copy());
 }
 
 TEST_F(JoinNodeTest, Copy) {
@@ -39,6 +39,7 @@
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -628,6 +629,85 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, SemiJoinReductionToRuntimeFilterScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  const auto predicate_node = PredicateNode::make(greater_than_(int_float_b, 5), int_float_node);
+  const auto reduction_node = JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float2_a),
+    predicate_node,
+    int_float2_node);
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+    reduction_node,
+    int_float2_node);
+  // clang-format on
+  reduction_node->mark_as_semi_reduction(join_node);
+  reduction_node->use_runtime_filter = true;
+
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - Instead of a semi join, the TableScan of the predicate applies a runtime filter built from the right
+   * input of the reduction.
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  const auto table_scan_op = std::dynamic_pointer_cast<const TableScan>(join_op->left_input());
+  ASSERT_TRUE(table_scan_op);
+  EXPECT_EQ(*table_scan_op->predicate(), *greater_than_(PQPColumnExpression::from_table(*table_int_float, "b"), 5));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(table_scan_op->left_input()));
+  EXPECT_EQ(table_scan_op->right_input(), join_op->right_input());
+  EXPECT_EQ(table_scan_op->runtime_filter_column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+
+  // Without a predicate on the reduced side, a TableScan that removes NULL values applies the runtime filter.
+  // clang-format off
+  const auto other_reduction_node = JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float2_a),
+    int_float_node,
+    int_float2_node);
+  const auto other_join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+    other_reduction_node,
+    int_float2_node);
+  // clang-format on
+  other_reduction_node->mark_as_semi_reduction(other_join_node);
+  other_reduction_node->use_runtime_filter = true;
+
+  const auto other_join_op = LQPTranslator{}.translate_node(other_join_node);
+  const auto not_null_scan_op = std::dynamic_pointer_cast<const TableScan>(other_join_op->left_input());
+  ASSERT_TRUE(not_null_scan_op);
+  EXPECT_EQ(*not_null_scan_op->predicate(), *is_not_null_(PQPColumnExpression::from_table(*table_int_float, "a")));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(not_null_scan_op->left_input()));
+  EXPECT_EQ(not_null_scan_op->runtime_filter_column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+
+  // If the predicate has other consumers, its TableScan must not apply the filter. Instead, a TableScan that removes
+  // NULL values applies the filter on top of the shared TableScan.
+  // clang-format off
+  const auto shared_predicate_node = PredicateNode::make(greater_than_(int_float_b, 5), int_float_node);
+  const auto shared_reduction_node = JoinNode::make(JoinMode::Semi, equals_(int_float_a, int_float2_a),
+    shared_predicate_node,
+    int_float2_node);
+  const auto shared_join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+    shared_reduction_node,
+    int_float2_node);
+  const auto union_node = UnionNode::make(SetOperationMode::All,
+    shared_join_node,
+    shared_predicate_node);
+  // clang-format on
+  shared_reduction_node->mark_as_semi_reduction(shared_join_node);
+  shared_reduction_node->use_runtime_filter = true;
+
+  const auto union_op = std::dynamic_pointer_cast<UnionAll>(LQPTranslator{}.translate_node(union_node));
+  ASSERT_TRUE(union_op);
+  const auto shared_scan_op = std::dynamic_pointer_cast<const TableScan>(union_op->right_input());
+  ASSERT_TRUE(shared_scan_op);
+  EXPECT_FALSE(shared_scan_op->runtime_filter_column_ids().has_value());
+  const auto filter_scan_op = std::dynamic_pointer_cast<const TableScan>(union_op->left_input()->left_input());
+  ASSERT_TRUE(filter_scan_op);
+  EXPECT_EQ(*filter_scan_op->predicate(), *is_not_null_(PQPColumnExpression::from_table(*table_int_float, "a")));
+  EXPECT_EQ(filter_scan_op->left_input(), shared_scan_op);
+  EXPECT_EQ(filter_scan_op->runtime_filter_column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   /**
    * Build LQP and translate to PQP
@@ -646,6 +726,39 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIE) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto join_node = JoinNode::make(JoinMode::Inner,
+                                        expression_vector(less_than_(int_float_b, int_float2_b),
+                                                          not_equals_(int_float_a, int_float2_a),
+                                                          greater_than_equals_(int_float2_a, int_float_a)),
+                                        int_float_node, int_float2_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - Joins with two inequality predicates use the JoinIE. The second inequality predicate becomes the first
+   * secondary predicate.
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinIE>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->primary_predicate().predicate_condition, PredicateCondition::LessThan);
+  ASSERT_EQ(join_op->secondary_predicates().size(), 2);
+  EXPECT_EQ(join_op->secondary_predicates()[0].column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->secondary_predicates()[0].predicate_condition, PredicateCondition::LessThanEquals);
+  EXPECT_EQ(join_op->secondary_predicates()[1].predicate_condition, PredicateCondition::NotEquals);
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+
+  // Without a second inequality predicate, the JoinSortMerge is used.
+  const auto other_join_node = JoinNode::make(
+      JoinMode::Inner,
+      expression_vector(less_than_(int_float_b, int_float2_b), not_equals_(int_float_a, int_float2_a)),
+      int_float_node, int_float2_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(LQPTranslator{}.translate_node(other_join_node)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   /**
    * Build LQP and translate to PQP
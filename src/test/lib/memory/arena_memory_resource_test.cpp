@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "memory/arena_memory_resource.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class ArenaMemoryResourceTest : public BaseTest {};
+
+TEST_F(ArenaMemoryResourceTest, AllocateFromRegions) {
+  auto memory_resource = ArenaMemoryResource{};
+  EXPECT_EQ(memory_resource.region_bytes(), 0);
+
+  auto* const first_pointer = static_cast<std::byte*>(memory_resource.allocate(100, 8));
+  auto* const second_pointer = static_cast<std::byte*>(memory_resource.allocate(100, 64));
+  EXPECT_EQ(memory_resource.region_bytes(), ArenaMemoryResource::INITIAL_REGION_SIZE);
+
+  // Allocations are bumped through the region and respect the alignment.
+  EXPECT_GE(second_pointer, first_pointer + 100);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(second_pointer) % 64, 0);
+
+  // Deallocations do not free memory.
+  memory_resource.deallocate(first_pointer, 100, 8);
+  memory_resource.deallocate(second_pointer, 100, 64);
+  EXPECT_EQ(memory_resource.region_bytes(), ArenaMemoryResource::INITIAL_REGION_SIZE);
+
+  // Exhausting the first region requests a larger one.
+  for (auto allocation_count = size_t{0}; allocation_count <= ArenaMemoryResource::INITIAL_REGION_SIZE / 1'000;
+       ++allocation_count) {
+    memory_resource.allocate(1'000);
+  }
+  EXPECT_EQ(memory_resource.region_bytes(), 3 * ArenaMemoryResource::INITIAL_REGION_SIZE);
+}
+
+TEST_F(ArenaMemoryResourceTest, LargeAllocations) {
+  auto memory_resource = ArenaMemoryResource{};
+
+  // Large allocations are forwarded to the upstream resource and do not consume region memory.
+  auto* const pointer = memory_resource.allocate(ArenaMemoryResource::LARGE_ALLOCATION_THRESHOLD);
+  EXPECT_EQ(memory_resource.region_bytes(), 0);
+  memory_resource.deallocate(pointer, ArenaMemoryResource::LARGE_ALLOCATION_THRESHOLD);
+}
+
+TEST_F(ArenaMemoryResourceTest, PolymorphicAllocator) {
+  auto memory_resource = ArenaMemoryResource{};
+  auto values = pmr_vector<int32_t>(PolymorphicAllocator<int32_t>{&memory_resource});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    values.push_back(value);
+  }
+
+  EXPECT_EQ(values.size(), 1'000);
+  EXPECT_EQ(values.back(), 999);
+  EXPECT_GT(memory_resource.region_bytes(), 0);
+  EXPECT_TRUE(memory_resource.is_equal(memory_resource));
+  EXPECT_FALSE(memory_resource.is_equal(ArenaMemoryResource{}));
+}
+
+TEST_F(ArenaMemoryResourceTest, ThreadLocalRegions) {
+  auto memory_resource = ArenaMemoryResource{};
+  constexpr auto THREAD_COUNT = size_t{4};
+  constexpr auto ALLOCATION_COUNT = size_t{100};
+
+  // Each thread writes to its own allocations. Overlapping allocations would be detected by the checks below.
+  auto pointers_per_thread = std::vector<std::vector<uint64_t*>>(THREAD_COUNT);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto allocation_id = size_t{0}; allocation_id < ALLOCATION_COUNT; ++allocation_id) {
+        auto* const pointer = static_cast<uint64_t*>(memory_resource.allocate(sizeof(uint64_t), alignof(uint64_t)));
+        *pointer = thread_id * ALLOCATION_COUNT + allocation_id;
+        pointers_per_thread[thread_id].push_back(pointer);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto thread_id = size_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    for (auto allocation_id = size_t{0}; allocation_id < ALLOCATION_COUNT; ++allocation_id) {
+      EXPECT_EQ(*pointers_per_thread[thread_id][allocation_id], thread_id * ALLOCATION_COUNT + allocation_id);
+    }
+  }
+
+  // Every thread bumps through its own region.
+  EXPECT_EQ(memory_resource.region_bytes(), THREAD_COUNT * ArenaMemoryResource::INITIAL_REGION_SIZE);
+}
+
+}  // namespace hyrise
@@ -0,0 +1,44 @@
+#include "base_test.hpp"
+
+#include "memory/tracking_memory_resource.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class TrackingMemoryResourceTest : public BaseTest {};
+
+TEST_F(TrackingMemoryResourceTest, AllocateAndDeallocate) {
+  auto memory_resource = TrackingMemoryResource{};
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 0);
+
+  auto* const first_pointer = memory_resource.allocate(64);
+  auto* const second_pointer = memory_resource.allocate(32);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 96);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 96);
+
+  memory_resource.deallocate(first_pointer, 64);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 32);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 96);
+
+  memory_resource.deallocate(second_pointer, 32);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 96);
+}
+
+TEST_F(TrackingMemoryResourceTest, PolymorphicAllocator) {
+  auto memory_resource = TrackingMemoryResource{};
+
+  {
+    auto values = pmr_vector<int32_t>(PolymorphicAllocator<int32_t>{&memory_resource});
+    values.resize(100);
+    EXPECT_GE(memory_resource.allocated_bytes(), 100 * sizeof(int32_t));
+  }
+
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0);
+  EXPECT_GE(memory_resource.peak_allocated_bytes(), 100 * sizeof(int32_t));
+  EXPECT_TRUE(memory_resource.is_equal(memory_resource));
+  EXPECT_FALSE(memory_resource.is_equal(TrackingMemoryResource{}));
+}
+
+}  // namespace hyrise
@@ -47,7 +47,7 @@ TEST_F(ChangeMetaTableTest, Insert) {
   change_meta_table->set_transaction_context(context);
   change_meta_table->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(meta_mock_table->insert_calls(), 1);
   EXPECT_EQ(meta_mock_table->insert_values(), right_input->get_output()->get_row(0));
@@ -60,7 +60,7 @@ TEST_F(ChangeMetaTableTest, Delete) {
   change_meta_table->set_transaction_context(context);
   change_meta_table->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(meta_mock_table->remove_calls(), 1);
   EXPECT_EQ(meta_mock_table->remove_values(), left_input->get_output()->get_row(0));
@@ -73,7 +73,7 @@ TEST_F(ChangeMetaTableTest, Update) {
   change_meta_table->set_transaction_context(context);
   change_meta_table->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(meta_mock_table->update_calls(), 1);
   EXPECT_EQ(meta_mock_table->update_selected_values(), left_input->get_output()->get_row(0));
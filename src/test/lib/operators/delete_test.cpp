@@ -17,6 +17,7 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -62,7 +63,7 @@ void OperatorsDeleteTest::helper(bool commit) {
 
   auto expected_end_cid = CommitID{0u};
   if (commit) {
-    transaction_context->commit();
+    EXPECT_TRUE(transaction_context->commit());
     expected_end_cid = transaction_context->commit_id();
   } else {
     transaction_context->rollback(RollbackReason::User);
@@ -119,7 +120,7 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_TRUE(delete_op2->execute_failed());
 
   // MVCC commit.
-  t1_context->commit();
+  EXPECT_TRUE(t1_context->commit());
   t2_context->rollback(RollbackReason::Conflict);
 
   // Get validated table which should have only one row deleted.
@@ -156,7 +157,7 @@ TEST_F(OperatorsDeleteTest, EmptyDelete) {
   EXPECT_FALSE(delete_op->execute_failed());
 
   // MVCC commit.
-  tx_context_modification->commit();
+  EXPECT_TRUE(tx_context_modification->commit());
 
   // Get validated table which should be the original one
   auto tx_context_verification = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
@@ -194,7 +195,7 @@ TEST_F(OperatorsDeleteTest, UpdateAfterDeleteFails) {
 
   delete_op->execute();
 
-  t1_context->commit();
+  EXPECT_TRUE(t1_context->commit());
 
   EXPECT_FALSE(delete_op->execute_failed());
 
@@ -257,7 +258,7 @@ TEST_F(OperatorsDeleteTest, DeleteOwnInsert) {
     if (value == 456.7f) {
       context->rollback(RollbackReason::User);
     } else {
-      context->commit();
+      EXPECT_TRUE(context->commit());
     }
 
     Hyrise::get().storage_manager.drop_table(table_name_for_insert);
@@ -296,7 +297,7 @@ TEST_F(OperatorsDeleteTest, UseTransactionContextAfterCommit) {
   validate->execute();
   delete_op->execute();
 
-  t1_context->commit();
+  EXPECT_TRUE(t1_context->commit());
 
   delete_op2->set_transaction_context(t1_context);
 
@@ -320,7 +321,7 @@ TEST_F(OperatorsDeleteTest, RunOnUnvalidatedTable) {
   delete_op1->set_transaction_context(t1_context);
   // This one works and deletes some rows
   delete_op1->execute();
-  t1_context->commit();
+  EXPECT_TRUE(t1_context->commit());
 
   auto t2_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   auto delete_op2 = std::make_shared<Delete>(table_scan);
@@ -349,7 +350,7 @@ TEST_F(OperatorsDeleteTest, PrunedInputTable) {
   delete_op->execute();
   EXPECT_FALSE(delete_op->execute_failed());
 
-  transaction_context->commit();
+  EXPECT_TRUE(transaction_context->commit());
 
   const auto expected_end_cid = transaction_context->commit_id();
   EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{0}), expected_end_cid);
@@ -362,4 +363,96 @@ TEST_F(OperatorsDeleteTest, PrunedInputTable) {
   EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_end_cid(ChunkOffset{1}), expected_end_cid);
 }
 
+TEST_F(OperatorsDeleteTest, DeleteEntireChunks) {
+  auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  // Deletes all rows of the first and the last chunk, but only one row of the second chunk.
+  const auto get_table = std::make_shared<GetTable>(_table2_name);
+  get_table->execute();
+  const auto table_scan = create_table_scan(get_table, ColumnID{1}, PredicateCondition::NotEquals, 9);
+  table_scan->execute();
+
+  const auto delete_op = std::make_shared<Delete>(table_scan);
+  delete_op->set_transaction_context(transaction_context);
+  delete_op->execute();
+  EXPECT_FALSE(delete_op->execute_failed());
+
+  EXPECT_TRUE(transaction_context->commit());
+  const auto commit_id = transaction_context->commit_id();
+
+  // Entirely deleted chunks store a single end CID for all rows.
+  for (const auto chunk_id : {ChunkID{0}, ChunkID{2}}) {
+    const auto chunk = _table2->get_chunk(chunk_id);
+    const auto& mvcc_data = chunk->mvcc_data();
+    EXPECT_EQ(mvcc_data->max_end_cid(), commit_id);
+    EXPECT_EQ(chunk->invalid_row_count(), chunk->size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_EQ(mvcc_data->get_end_cid(chunk_offset), commit_id);
+    }
+  }
+
+  const auto& mvcc_data = _table2->get_chunk(ChunkID{1})->mvcc_data();
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{0}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{1}), commit_id);
+  EXPECT_EQ(mvcc_data->get_end_cid(ChunkOffset{2}), commit_id);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{1})->invalid_row_count(), 2u);
+}
+
+TEST_F(OperatorsDeleteTest, UnsortedMultiChunkPosList) {
+  const auto create_input = [&](RowIDPosList row_ids) {
+    const auto pos_list = std::make_shared<RowIDPosList>(std::move(row_ids));
+    const auto segments = Segments{std::make_shared<ReferenceSegment>(_table2, ColumnID{0}, pos_list),
+                                   std::make_shared<ReferenceSegment>(_table2, ColumnID{1}, pos_list)};
+    const auto table = std::make_shared<Table>(_table2->column_definitions(), TableType::References);
+    table->append_chunk(segments);
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  // Another transaction locks the first row of the last chunk.
+  auto t1_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto delete_op1 = std::make_shared<Delete>(create_input({RowID{ChunkID{2}, ChunkOffset{0}}}));
+  delete_op1->set_transaction_context(t1_context);
+  delete_op1->execute();
+  EXPECT_FALSE(delete_op1->execute_failed());
+
+  // The RowIDs are processed in sorted order, so the rows before the conflicting one are locked and later unlocked.
+  auto t2_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto delete_op2 = std::make_shared<Delete>(
+      create_input({RowID{ChunkID{2}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}},
+                    RowID{ChunkID{2}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{0}}}));
+  delete_op2->set_transaction_context(t2_context);
+  delete_op2->execute();
+  EXPECT_TRUE(delete_op2->execute_failed());
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{0}), t2_context->transaction_id());
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{2}), t2_context->transaction_id());
+  EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_tid(ChunkOffset{1}), TransactionID{0});
+
+  t2_context->rollback(RollbackReason::Conflict);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{0}), TransactionID{0});
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_tid(ChunkOffset{2}), TransactionID{0});
+  EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_tid(ChunkOffset{0}), t1_context->transaction_id());
+
+  // Without the conflict, all rows are deleted.
+  t1_context->rollback(RollbackReason::User);
+  auto t3_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto delete_op3 = std::make_shared<Delete>(
+      create_input({RowID{ChunkID{2}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}},
+                    RowID{ChunkID{2}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{0}}}));
+  delete_op3->set_transaction_context(t3_context);
+  delete_op3->execute();
+  EXPECT_FALSE(delete_op3->execute_failed());
+  EXPECT_TRUE(t3_context->commit());
+
+  const auto commit_id = t3_context->commit_id();
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{0}), commit_id);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{1}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->mvcc_data()->get_end_cid(ChunkOffset{2}), commit_id);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{0})->invalid_row_count(), 2u);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_end_cid(ChunkOffset{0}), commit_id);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{2})->mvcc_data()->get_end_cid(ChunkOffset{1}), commit_id);
+  EXPECT_EQ(_table2->get_chunk(ChunkID{2})->invalid_row_count(), 2u);
+}
+
 }  // namespace hyrise
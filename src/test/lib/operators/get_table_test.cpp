@@ -91,7 +91,7 @@ TEST_F(OperatorsGetTableTest, PassThroughInvalidRowCount) {
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
 
-  transaction_context->commit();
+  EXPECT_TRUE(transaction_context->commit());
 
   auto get_table_2 = std::make_shared<GetTable>("int_int_float");
   get_table_2->execute();
@@ -200,7 +200,7 @@ TEST_F(OperatorsGetTableTest, ExcludePhysicallyDeletedChunks) {
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   /*
    * Not setting cleanup commit ids is intentional,
@@ -242,7 +242,7 @@ TEST_F(OperatorsGetTableTest, PrunedChunksCombined) {
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   /*
    * Not setting cleanup commit ids is intentional,
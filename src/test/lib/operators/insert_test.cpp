@@ -12,7 +12,11 @@
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/abstract_encoded_segment.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/constraints/table_key_constraint.hpp"
 #include "storage/table.hpp"
 
 namespace hyrise {
@@ -39,7 +43,7 @@ TEST_F(OperatorsInsertTest, SelfInsert) {
 
   insert->execute();
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   // Check that row has been inserted.
   EXPECT_EQ(table->row_count(), 6u);
@@ -75,7 +79,7 @@ TEST_F(OperatorsInsertTest, InsertRespectChunkSize) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 4u);
   EXPECT_EQ(table->get_chunk(ChunkID{0})->size(), 3u);
@@ -102,7 +106,7 @@ TEST_F(OperatorsInsertTest, MultipleChunks) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 7u);
   EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 1u);
@@ -130,7 +134,7 @@ TEST_F(OperatorsInsertTest, CompressedChunks) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 7u);
   EXPECT_EQ(table->get_chunk(ChunkID{6})->size(), 2u);
@@ -213,7 +217,7 @@ TEST_F(OperatorsInsertTest, InsertStringNullValue) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 2u);
   EXPECT_EQ(table->row_count(), 8u);
@@ -239,7 +243,7 @@ TEST_F(OperatorsInsertTest, InsertIntFloatNullValues) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 4u);
   EXPECT_EQ(table->row_count(), 8u);
@@ -288,7 +292,7 @@ TEST_F(OperatorsInsertTest, InsertSingleNullFromDummyProjection) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_EQ(table->chunk_count(), 2u);
   EXPECT_EQ(table->row_count(), 5u);
@@ -315,9 +319,173 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   insert->set_transaction_context(context);
   insert->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, EnforceKeyConstraintAtCommit) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY};
+  table->add_soft_key_constraint(key_constraint);
+  table->create_key_hash_index(key_constraint);
+  Hyrise::get().storage_manager.add_table("key_table", table);
+
+  const auto execute = [](const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table().first;
+  };
+
+  EXPECT_EQ(execute("INSERT INTO key_table VALUES (1, 10)"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO key_table VALUES (2, 20)"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO key_table VALUES (1, 30)"), SQLPipelineStatus::Failure);
+
+  // The rows of a single statement are checked against each other as well.
+  EXPECT_EQ(execute("INSERT INTO key_table SELECT a + 2, b FROM key_table"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO key_table SELECT 5, b FROM key_table"), SQLPipelineStatus::Failure);
+
+  // Updates that keep the key do not conflict with the rows they delete. Deleted keys can be inserted again.
+  EXPECT_EQ(execute("UPDATE key_table SET b = 11 WHERE a = 1"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("DELETE FROM key_table WHERE a = 2"), SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("INSERT INTO key_table VALUES (2, 21)"), SQLPipelineStatus::Success);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, 11});
+  expected_table->append({2, 21});
+  expected_table->append({3, 10});
+  expected_table->append({4, 20});
+
+  const auto [status, result_table] =
+      SQLPipelineBuilder{"SELECT * FROM key_table ORDER BY a"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_ORDERED(result_table, expected_table);
+}
+
+TEST_F(OperatorsInsertTest, EnforceKeyConstraintForRowsModifiedByOwnTransaction) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY};
+  table->add_soft_key_constraint(key_constraint);
+  table->create_key_hash_index(key_constraint);
+  Hyrise::get().storage_manager.add_table("key_table", table);
+
+  const auto execute = [](const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table().first;
+  };
+
+  // Rows that the transaction inserted and then updated or deleted again do not conflict with the rows inserted later
+  // in the same transaction.
+  EXPECT_EQ(execute("BEGIN; INSERT INTO key_table VALUES (1, 10); UPDATE key_table SET b = 11 WHERE a = 1; COMMIT;"),
+            SQLPipelineStatus::Success);
+  EXPECT_EQ(execute("BEGIN; INSERT INTO key_table VALUES (2, 20); DELETE FROM key_table WHERE a = 2; "
+                    "INSERT INTO key_table VALUES (2, 21); COMMIT;"),
+            SQLPipelineStatus::Success);
+
+  // Live rows still conflict.
+  EXPECT_EQ(execute("BEGIN; INSERT INTO key_table VALUES (3, 30); DELETE FROM key_table WHERE a = 3; "
+                    "INSERT INTO key_table VALUES (1, 12); COMMIT;"),
+            SQLPipelineStatus::Failure);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, 11});
+  expected_table->append({2, 21});
+
+  const auto [status, result_table] =
+      SQLPipelineBuilder{"SELECT * FROM key_table ORDER BY a"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_ORDERED(result_table, expected_table);
+}
+
+TEST_F(OperatorsInsertTest, EnforceKeyConstraintForConcurrentInserts) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}}, KeyConstraintType::UNIQUE};
+  table->add_soft_key_constraint(key_constraint);
+  table->create_key_hash_index(key_constraint);
+  Hyrise::get().storage_manager.add_table("key_table", table);
+
+  auto context_1 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto context_2 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto pipeline_1 =
+      SQLPipelineBuilder{"INSERT INTO key_table VALUES (1, 10)"}.with_transaction_context(context_1).create_pipeline();
+  auto pipeline_2 =
+      SQLPipelineBuilder{"INSERT INTO key_table VALUES (1, 20)"}.with_transaction_context(context_2).create_pipeline();
+  EXPECT_EQ(pipeline_1.get_result_table().first, SQLPipelineStatus::Success);
+  EXPECT_EQ(pipeline_2.get_result_table().first, SQLPipelineStatus::Success);
+
+  // Neither transaction waits for the other one. The first one to commit sees the uncommitted row of the other one and
+  // is rolled back, which allows the other one to commit.
+  EXPECT_FALSE(context_1->commit());
+  EXPECT_EQ(context_1->phase(), TransactionPhase::RolledBackAfterConflict);
+  EXPECT_TRUE(context_2->commit());
+  EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({1, 20});
+
+  const auto [status, result_table] =
+      SQLPipelineBuilder{"SELECT * FROM key_table"}.create_pipeline().get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_ORDERED(result_table, expected_table);
+}
+
+TEST_F(OperatorsInsertTest, BulkInsertEncodesFullChunks) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // 3 Rows
+  const auto table = load_table("resources/test_data/tbl/int.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("test1", table);
+
+  // 10 Rows
+  Hyrise::get().storage_manager.add_table("test2", load_table("resources/test_data/tbl/10_ints.tbl", ChunkOffset{3}));
+
+  const auto validated_row_count = [&]() {
+    const auto get_table = std::make_shared<GetTable>("test1");
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+    validate->execute();
+    return validate->get_output()->row_count();
+  };
+
+  for (const auto commit : {false, true}) {
+    const auto chunk_count = table->chunk_count();
+    const auto get_table = std::make_shared<GetTable>("test2");
+    get_table->execute();
+
+    const auto insert = std::make_shared<Insert>("test1", get_table, SegmentEncodingSpec{EncodingType::Dictionary});
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+
+    // The inserted rows fill five new chunks, which are encoded before the commit.
+    ASSERT_EQ(table->chunk_count(), chunk_count + 5);
+    for (auto chunk_id = chunk_count; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      EXPECT_EQ(chunk->size(), 2u);
+      EXPECT_FALSE(chunk->is_mutable());
+      EXPECT_TRUE(chunk->pruning_statistics());
+      const auto encoded_segment = std::dynamic_pointer_cast<AbstractEncodedSegment>(chunk->get_segment(ColumnID{0}));
+      ASSERT_TRUE(encoded_segment);
+      EXPECT_EQ(encoded_segment->encoding_type(), EncodingType::Dictionary);
+    }
+    EXPECT_EQ((*table->get_chunk(ChunkID{chunk_count + 4})->get_segment(ColumnID{0}))[ChunkOffset{1}],
+              AllTypeVariant{234});
+    EXPECT_EQ(validated_row_count(), 3u);
+
+    if (commit) {
+      EXPECT_TRUE(context->commit());
+    } else {
+      context->rollback(RollbackReason::User);
+    }
+
+    const auto expected_max_begin_cid = commit ? context->commit_id() : CommitID{0};
+    const auto& max_begin_cid = table->get_chunk(chunk_count)->mvcc_data()->max_begin_cid;
+    ASSERT_TRUE(max_begin_cid);
+    EXPECT_EQ(*max_begin_cid, expected_max_begin_cid);
+    EXPECT_EQ(validated_row_count(), commit ? 13u : 3u);
+  }
+}
+
 }  // namespace hyrise
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <iterator>
 
 #include "base_test.hpp"
 
@@ -96,6 +97,39 @@ TEST_F(JoinHashStepsTest, LargeHashTableExistenceOnly) {
   }
 }
 
+TEST_F(JoinHashStepsTest, FinalizedHashTableWithSharedLowerBits) {
+  // All values share their lower bits, as is the case for the values of a radix partition. Value i has i + 1 positions.
+  auto table = PosHashTable<int64_t>{JoinHashBuildMode::AllPositions, 1'000};
+  for (auto index = uint32_t{0}; index < 100; ++index) {
+    for (auto position = uint32_t{0}; position <= index; ++position) {
+      table.emplace(int64_t{index} << 10u, RowID{ChunkID{index}, ChunkOffset{position}});
+    }
+  }
+  table.finalize();
+
+  EXPECT_EQ(table.distinct_value_count(), size_t{100});
+  EXPECT_EQ(table.position_count(), size_t{5'050});
+
+  for (auto index = uint32_t{0}; index < 100; ++index) {
+    const auto value = int64_t{index} << 10u;
+    EXPECT_TRUE(table.contains(value));
+    EXPECT_FALSE(table.contains(value + 1));
+
+    // Looking up a value from a precomputed slot (as done by the batched probe) yields the same result.
+    const auto slot_index = table.slot_index(value);
+    table.prefetch_slot(slot_index);
+    EXPECT_TRUE(table.contains(value, slot_index));
+    EXPECT_EQ(table.find(value, slot_index), table.find(value));
+
+    const auto [begin, end] = table.find(value);
+    ASSERT_EQ(std::distance(begin, end), int64_t{index} + 1);
+    EXPECT_TRUE(std::all_of(begin, end, [&](const auto& row_id) { return row_id.chunk_id == index; }));
+  }
+
+  const auto [begin, end] = table.find(int64_t{-1});
+  EXPECT_EQ(begin, end);
+}
+
 TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   const size_t radix_bit_count = 0;
   std::vector<std::vector<size_t>> histograms;
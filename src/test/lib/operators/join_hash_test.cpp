@@ -1,5 +1,6 @@
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
@@ -115,4 +116,50 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
   EXPECT_GT(JoinHash::calculate_radix_bits(std::numeric_limits<size_t>::max(), std::numeric_limits<size_t>::max()), 0);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillRadixBitCalculation) {
+  EXPECT_EQ(JoinHash::estimate_memory_consumption(0, 0), 0);
+  EXPECT_GT(JoinHash::estimate_memory_consumption(1'000, 10), JoinHash::estimate_memory_consumption(10, 1'000));
+
+  // At least two partitions are required to spill.
+  EXPECT_EQ(JoinHash::calculate_spill_radix_bits(1'001, 1'000), 1);
+  EXPECT_EQ(JoinHash::calculate_spill_radix_bits(4'000, 1'000), 2);
+  EXPECT_EQ(JoinHash::calculate_spill_radix_bits(4'001, 1'000), 3);
+  EXPECT_EQ(JoinHash::calculate_spill_radix_bits(std::numeric_limits<size_t>::max(), 1), 16);
+}
+
+TEST_F(OperatorsJoinHashTest, SpillToDisk) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto inputs = std::vector<std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>>{
+      {_table_tpch_orders, _table_tpch_lineitems}, {_table_tpch_lineitems_scanned, _table_tpch_orders_scanned},
+      {_table_with_nulls, _table_with_nulls}};
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                               JoinMode::AntiNullAsTrue, JoinMode::AntiNullAsFalse}) {
+    for (const auto& [left_input, right_input] : inputs) {
+      SCOPED_TRACE(std::string{"JoinMode: "} + std::string{magic_enum::enum_name(join_mode)});
+      const auto reference_join = std::make_shared<JoinHash>(left_input, right_input, join_mode, primary_predicate);
+      reference_join->execute();
+      const auto& reference_performance_data =
+          dynamic_cast<const JoinHash::PerformanceData&>(*reference_join->performance_data);
+      EXPECT_FALSE(reference_performance_data.spilled_bytes);
+
+      // Choose a memory budget that requires about four partitions, independent of which input is the build side.
+      const auto left_row_count = left_input->get_output()->row_count();
+      const auto right_row_count = right_input->get_output()->row_count();
+      const auto memory_budget = std::min(JoinHash::estimate_memory_consumption(left_row_count, right_row_count),
+                                          JoinHash::estimate_memory_consumption(right_row_count, left_row_count)) /
+                                 4;
+      Hyrise::get().settings_manager.get_setting(JoinHash::MEMORY_BUDGET_SETTING)->set(std::to_string(memory_budget));
+      const auto spilling_join = std::make_shared<JoinHash>(left_input, right_input, join_mode, primary_predicate);
+      spilling_join->execute();
+      Hyrise::get().settings_manager.get_setting(JoinHash::MEMORY_BUDGET_SETTING)->set("0");
+
+      const auto& performance_data = dynamic_cast<const JoinHash::PerformanceData&>(*spilling_join->performance_data);
+      EXPECT_GE(performance_data.radix_bits, 1);
+      EXPECT_TRUE(performance_data.spilled_bytes);
+      EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), reference_join->get_output());
+    }
+  }
+}
+
 }  // namespace hyrise
@@ -0,0 +1,130 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "operators/join_ie.hpp"
+#include "operators/join_verification.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class OperatorsJoinIETest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto dummy_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data);
+    dummy_input = std::make_shared<TableWrapper>(dummy_table);
+    dummy_input->never_clear_output();
+  }
+
+  static std::shared_ptr<TableWrapper> create_table_wrapper(const TableColumnDefinitions& column_definitions,
+                                                            std::vector<pmr_vector<int32_t>>&& values) {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    auto segments = Segments{};
+    for (auto& column_values : values) {
+      segments.emplace_back(std::make_shared<ValueSegment<int32_t>>(std::move(column_values)));
+    }
+    table->append_chunk(segments);
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<AbstractOperator> dummy_input;
+};
+
+TEST_F(OperatorsJoinIETest, DescriptionAndName) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto secondary_predicate =
+      OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThanEquals};
+
+  const auto join_operator = std::make_shared<JoinIE>(dummy_input, dummy_input, JoinMode::Inner, primary_predicate,
+                                                      std::vector<OperatorJoinPredicate>{secondary_predicate});
+
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine),
+            "JoinIE (Inner) Column #0 < Column #0 AND Column #1 >= Column #1");
+
+  dummy_input->execute();
+  EXPECT_EQ(join_operator->description(DescriptionMode::SingleLine), "JoinIE (Inner) a < a AND b >= b");
+  EXPECT_EQ(join_operator->name(), "JoinIE");
+}
+
+TEST_F(OperatorsJoinIETest, DeepCopy) {
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan},
+                                         {{ColumnID{0}, ColumnID{1}}, PredicateCondition::NotEquals}};
+  const auto join_operator =
+      std::make_shared<JoinIE>(dummy_input, dummy_input, JoinMode::Left, primary_predicate, secondary_predicates);
+  const auto join_operator_copy = std::dynamic_pointer_cast<JoinIE>(join_operator->deep_copy());
+
+  ASSERT_TRUE(join_operator_copy);
+  EXPECT_EQ(join_operator_copy->mode(), JoinMode::Left);
+  EXPECT_EQ(join_operator_copy->primary_predicate(), primary_predicate);
+  EXPECT_EQ(join_operator_copy->secondary_predicates(), secondary_predicates);
+  EXPECT_NE(join_operator_copy->left_input(), nullptr);
+  EXPECT_NE(join_operator_copy->right_input(), nullptr);
+}
+
+TEST_F(OperatorsJoinIETest, RequiresTwoInequalityPredicates) {
+  const auto inequality_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto equals_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::Equals};
+
+  EXPECT_THROW(std::make_shared<JoinIE>(dummy_input, dummy_input, JoinMode::Inner, inequality_predicate,
+                                        std::vector<OperatorJoinPredicate>{}),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<JoinIE>(dummy_input, dummy_input, JoinMode::Inner, inequality_predicate,
+                                        std::vector<OperatorJoinPredicate>{equals_predicate}),
+               std::logic_error);
+  EXPECT_THROW(std::make_shared<JoinIE>(dummy_input, dummy_input, JoinMode::Inner, equals_predicate,
+                                        std::vector<OperatorJoinPredicate>{inequality_predicate}),
+               std::logic_error);
+}
+
+TEST_F(OperatorsJoinIETest, IntervalJoinWithBlockPruning) {
+  // The left input holds 10'000 intervals [10 * i, 10 * i + 15), i.e., three blocks. The right input holds 200
+  // timestamps between 0 and 1393, which can only fall into intervals of the first block.
+  const auto interval_count = int32_t{10'000};
+  auto starts = pmr_vector<int32_t>(interval_count);
+  auto ends = pmr_vector<int32_t>(interval_count);
+  for (auto interval_id = int32_t{0}; interval_id < interval_count; ++interval_id) {
+    starts[interval_id] = 10 * interval_id;
+    ends[interval_id] = 10 * interval_id + 15;
+  }
+
+  const auto timestamp_count = int32_t{200};
+  auto timestamps = pmr_vector<int32_t>(timestamp_count);
+  for (auto timestamp_id = int32_t{0}; timestamp_id < timestamp_count; ++timestamp_id) {
+    timestamps[timestamp_id] = 7 * timestamp_id;
+  }
+
+  const auto intervals = create_table_wrapper({{"start", DataType::Int, false}, {"end", DataType::Int, false}},
+                                              {std::move(starts), std::move(ends)});
+  const auto events = create_table_wrapper({{"ts", DataType::Int, false}}, {std::move(timestamps)});
+
+  // start <= ts AND end > ts
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThanEquals};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThan}};
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi}) {
+    const auto join_ie =
+        std::make_shared<JoinIE>(intervals, events, join_mode, primary_predicate, secondary_predicates);
+    join_ie->execute();
+
+    const auto join_verification =
+        std::make_shared<JoinVerification>(intervals, events, join_mode, primary_predicate, secondary_predicates);
+    join_verification->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_ie->get_output(), join_verification->get_output());
+
+    const auto& performance_data = static_cast<const JoinIE::PerformanceData&>(*join_ie->performance_data);
+    EXPECT_EQ(performance_data.block_pairs_joined, 1);
+    EXPECT_EQ(performance_data.block_pairs_pruned, 2);
+  }
+}
+
+}  // namespace hyrise
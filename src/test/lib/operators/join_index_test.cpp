@@ -7,10 +7,14 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
@@ -274,4 +278,89 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, DataJoinUsingTableIndex) {
+  // The table has four chunks of two rows. The table index covers the first three chunks, the last one is joined using
+  // the nested loop fallback. The GetTable prunes the first chunk and the first column, so that the RowIDs and the
+  // ColumnID of the table index differ from the ones of the index side input.
+  const auto table = load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("int_int3", table);
+  table->create_partial_hash_index(ColumnID{1}, {ChunkID{0}, ChunkID{1}, ChunkID{2}});
+
+  const auto get_table = std::make_shared<GetTable>("int_int3", std::vector{ChunkID{0}}, std::vector{ColumnID{0}});
+  get_table->never_clear_output();
+  get_table->execute();
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+    const auto join = std::make_shared<JoinIndex>(_table_wrapper_e, get_table, mode, primary_predicate);
+    join->execute();
+
+    const auto join_verification =
+        std::make_shared<JoinVerification>(_table_wrapper_e, get_table, mode, primary_predicate);
+    join_verification->execute();
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+
+    const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join->performance_data);
+    EXPECT_EQ(performance_data.chunks_scanned_with_index, 2);
+    EXPECT_EQ(performance_data.chunks_scanned_without_index, 1);
+  }
+
+  // The index side is the left input.
+  const auto flipped_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinIndex>(get_table, _table_wrapper_e, JoinMode::Inner, flipped_predicate,
+                                                std::vector<OperatorJoinPredicate>{}, IndexSide::Left);
+  join->execute();
+
+  const auto join_verification =
+      std::make_shared<JoinVerification>(get_table, _table_wrapper_e, JoinMode::Inner, flipped_predicate);
+  join_verification->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+  EXPECT_EQ(join->get_output()->row_count(), 2);
+}
+
+TEST_F(OperatorsJoinIndexTest, ValidatedJoinUsingTableIndex) {
+  // Under MVCC, the index side is a Validate on top of a GetTable. The table has four chunks of two rows, the table
+  // index covers the first three chunks. The row with b = 10 is deleted, so Validate drops it.
+  const auto table = load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("int_int3", table);
+  table->create_partial_hash_index(ColumnID{1}, {ChunkID{0}, ChunkID{1}, ChunkID{2}});
+
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto delete_get_table = std::make_shared<GetTable>("int_int3");
+  const auto delete_scan = create_table_scan(delete_get_table, ColumnID{1}, PredicateCondition::Equals, 10);
+  const auto delete_op = std::make_shared<Delete>(delete_scan);
+  delete_op->set_transaction_context(delete_context);
+  execute_all({delete_get_table, delete_scan, delete_op});
+  ASSERT_FALSE(delete_op->execute_failed());
+  ASSERT_TRUE(delete_context->commit());
+
+  const auto probe_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, false}}, TableType::Data);
+  for (const auto value : {2, 10, 12, 18}) {
+    probe_table->append({value});
+  }
+  const auto probe_input = std::make_shared<TableWrapper>(probe_table);
+  probe_input->never_clear_output();
+
+  const auto get_table = std::make_shared<GetTable>("int_int3");
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  validate->never_clear_output();
+  execute_all({probe_input, get_table, validate});
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinIndex>(probe_input, validate, JoinMode::Inner, primary_predicate);
+  join->execute();
+
+  const auto join_verification =
+      std::make_shared<JoinVerification>(probe_input, validate, JoinMode::Inner, primary_predicate);
+  join_verification->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+  EXPECT_EQ(join->get_output()->row_count(), 3);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join->performance_data);
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 3);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 1);
+}
+
 }  // namespace hyrise
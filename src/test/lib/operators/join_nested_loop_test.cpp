@@ -1,8 +1,12 @@
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
 #include "operators/join_nested_loop.hpp"
+#include "operators/join_verification.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
 
 namespace hyrise {
 
@@ -56,4 +60,46 @@ TEST_F(OperatorsJoinNestedLoopTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinNestedLoopTest, MultipleJobsMatchVerification) {
+  // The chunks are large enough for a job to cover only some of the right chunks (see MIN_COMPARISONS_PER_JOB), so
+  // that the matches of a left row are spread across multiple jobs. Every seventh value is NULL.
+  const auto create_table_wrapper = [](const int32_t row_count, const ChunkOffset chunk_size, const int32_t modulo) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                               chunk_size);
+    for (auto row_id = int32_t{0}; row_id < row_count; ++row_id) {
+      table->append({row_id % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{(row_id * 31) % modulo}});
+    }
+    table->last_chunk()->set_immutable();
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto left_input = create_table_wrapper(400, ChunkOffset{200}, 97);
+  const auto right_input = create_table_wrapper(1'500, ChunkOffset{300}, 89);
+  ASSERT_LT(size_t{200} * 300, JoinNestedLoop::MIN_COMPARISONS_PER_JOB);
+  ASSERT_LT(JoinNestedLoop::MIN_COMPARISONS_PER_JOB, size_t{200} * 1'500);
+
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+      SCOPED_TRACE(std::string{magic_enum::enum_name(mode)} + " " +
+                   std::string{magic_enum::enum_name(predicate_condition)});
+      const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, predicate_condition};
+
+      const auto join = std::make_shared<JoinNestedLoop>(left_input, right_input, mode, primary_predicate);
+      join->execute();
+      const auto join_verification =
+          std::make_shared<JoinVerification>(left_input, right_input, mode, primary_predicate);
+      join_verification->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+    }
+  }
+}
+
 }  // namespace hyrise
@@ -3,6 +3,7 @@
 
 #include "base_test.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_ie.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
@@ -272,6 +273,26 @@ class JoinTestRunner : public BaseTestWithParam<JoinTestConfiguration> {
         variations.shrink_to_fit();
         return variations;
       }
+
+      if constexpr (std::is_same_v<JoinOperator, JoinIE>) {
+        // The JoinIE requires a second inequality predicate as first secondary predicate. If there is none, add
+        // inequality predicates on a non-nullable and on a nullable column.
+        if (!configuration.secondary_predicates.empty() &&
+            is_inequality_predicate_condition(configuration.secondary_predicates.front().predicate_condition)) {
+          return std::vector{configuration};
+        }
+
+        auto variations = std::vector<JoinTestConfiguration>{};
+        for (const auto& inequality_predicate :
+             {OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThanEquals},
+              OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::GreaterThan}}) {
+          auto variation = configuration;
+          variation.secondary_predicates.insert(variation.secondary_predicates.begin(), inequality_predicate);
+          variations.emplace_back(variation);
+        }
+        return variations;
+      }
+
       return std::vector{configuration};
     };
 
@@ -776,6 +797,7 @@ INSTANTIATE_TEST_SUITE_P(JoinHash, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinHash>()));
 INSTANTIATE_TEST_SUITE_P(JoinSortMerge, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinSortMerge>()));
+INSTANTIATE_TEST_SUITE_P(JoinIE, JoinTestRunner, testing::ValuesIn(JoinTestRunner::create_configurations<JoinIE>()));
 INSTANTIATE_TEST_SUITE_P(JoinIndex, JoinTestRunner,
                          testing::ValuesIn(JoinTestRunner::create_configurations<JoinIndex>()));
 
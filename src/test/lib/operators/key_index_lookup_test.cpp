@@ -0,0 +1,140 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/key_index_lookup.hpp"
+#include "operators/pqp_utils.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class KeyIndexLookupTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, false}, {"c", DataType::Int, false}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, pmr_string{"x"}, 10});
+    table->append({2, pmr_string{"y"}, 20});
+    table->append({3, pmr_string{"x"}, 30});
+    table->append({2, pmr_string{"x"}, 40});
+    Hyrise::get().storage_manager.add_table("t", table);
+
+    const auto key_constraint = TableKeyConstraint{{ColumnID{0}, ColumnID{1}}, KeyConstraintType::PRIMARY_KEY};
+    table->add_soft_key_constraint(key_constraint);
+    table->create_key_hash_index(key_constraint);
+
+    expected_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"c", DataType::Int, false}};
+  }
+
+  static size_t count_key_index_lookups(const std::shared_ptr<AbstractOperator>& pqp) {
+    auto count = size_t{0};
+    visit_pqp(pqp, [&](const auto& op) {
+      count += op->type() == OperatorType::KeyIndexLookup ? 1 : 0;
+      return PQPVisitation::VisitInputs;
+    });
+    return count;
+  }
+
+  std::shared_ptr<Table> table;
+  TableColumnDefinitions expected_definitions;
+};
+
+TEST_F(KeyIndexLookupTest, Lookup) {
+  const auto lookup = std::make_shared<KeyIndexLookup>("t", std::vector<ColumnID>{},
+                                                       std::vector<ColumnID>{ColumnID{1}, ColumnID{0}},
+                                                       expression_vector(value_("x"), value_(2)));
+  lookup->execute();
+
+  const auto& result = lookup->get_output();
+  EXPECT_EQ(result->type(), TableType::References);
+  EXPECT_EQ(result->column_definitions(), table->column_definitions());
+
+  const auto expected = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected->append({2, pmr_string{"x"}, 40});
+  EXPECT_TABLE_EQ_ORDERED(result, expected);
+}
+
+TEST_F(KeyIndexLookupTest, NoMatch) {
+  const auto lookup = std::make_shared<KeyIndexLookup>("t", std::vector<ColumnID>{},
+                                                       std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                       expression_vector(value_(3), value_("y")));
+  lookup->execute();
+  EXPECT_EQ(lookup->get_output()->row_count(), 0);
+  EXPECT_EQ(lookup->get_output()->column_count(), 3);
+}
+
+TEST_F(KeyIndexLookupTest, PrunedColumns) {
+  const auto lookup = std::make_shared<KeyIndexLookup>("t", std::vector<ColumnID>{ColumnID{1}},
+                                                       std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                       expression_vector(value_(1), value_("x")));
+  lookup->execute();
+
+  const auto expected = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected->append({1, 10});
+  EXPECT_TABLE_EQ_ORDERED(lookup->get_output(), expected);
+}
+
+TEST_F(KeyIndexLookupTest, CorrelatedParameters) {
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto lookup = std::make_shared<KeyIndexLookup>(
+      "t", std::vector<ColumnID>{ColumnID{1}}, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+      expression_vector(correlated_parameter_(ParameterID{0}, a), value_("x")));
+  lookup->set_parameters({{ParameterID{0}, AllTypeVariant{3}}});
+  lookup->execute();
+
+  const auto expected = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected->append({3, 30});
+  EXPECT_TABLE_EQ_ORDERED(lookup->get_output(), expected);
+
+  const auto copied_lookup = lookup->deep_copy();
+  copied_lookup->set_parameters({{ParameterID{0}, AllTypeVariant{1}}});
+  copied_lookup->execute();
+  EXPECT_EQ(copied_lookup->get_output()->row_count(), 1);
+}
+
+TEST_F(KeyIndexLookupTest, MissingIndex) {
+  const auto lookup = std::make_shared<KeyIndexLookup>("t", std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}},
+                                                       expression_vector(value_(1)));
+  EXPECT_THROW(lookup->execute(), std::logic_error);
+}
+
+TEST_F(KeyIndexLookupTest, InsertedRowsAndVisibility) {
+  const auto select_sql = std::string{"SELECT a, c FROM t WHERE c > 0 AND b = 'z' AND a = 4"};
+
+  auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto insert_pipeline = SQLPipelineBuilder{"INSERT INTO t VALUES (4, 'z', 50)"}
+                             .with_transaction_context(insert_context)
+                             .create_pipeline();
+  EXPECT_EQ(insert_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  // The uncommitted row is indexed, but only visible to the inserting transaction.
+  auto other_pipeline = SQLPipelineBuilder{select_sql}.create_pipeline();
+  const auto [other_status, other_result] = other_pipeline.get_result_table();
+  EXPECT_EQ(other_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(other_result->row_count(), 0);
+  EXPECT_EQ(count_key_index_lookups(other_pipeline.get_physical_plans().at(0)), 1);
+
+  auto own_pipeline = SQLPipelineBuilder{select_sql}.with_transaction_context(insert_context).create_pipeline();
+  EXPECT_EQ(own_pipeline.get_result_table().second->row_count(), 1);
+
+  EXPECT_TRUE(insert_context->commit());
+
+  auto committed_pipeline = SQLPipelineBuilder{select_sql}.create_pipeline();
+  const auto expected = std::make_shared<Table>(expected_definitions, TableType::Data);
+  expected->append({4, 50});
+  EXPECT_TABLE_EQ_ORDERED(committed_pipeline.get_result_table().second, expected);
+}
+
+TEST_F(KeyIndexLookupTest, NoLookupForPartialKey) {
+  auto pipeline = SQLPipelineBuilder{"SELECT * FROM t WHERE a = 2"}.create_pipeline();
+  EXPECT_EQ(pipeline.get_result_table().second->row_count(), 2);
+  EXPECT_EQ(count_key_index_lookups(pipeline.get_physical_plans().at(0)), 0);
+}
+
+}  // namespace hyrise
@@ -119,6 +119,14 @@ TEST_F(OperatorsLimitTest, Limit10ReferenceSegment) {
   test_limit_10();
 }
 
+TEST_F(OperatorsLimitTest, ConstantRowCount) {
+  EXPECT_EQ(Limit(_table_wrapper, to_expression(int64_t{4})).constant_row_count(), size_t{4});
+  EXPECT_EQ(Limit(_table_wrapper, value_(int32_t{0})).constant_row_count(), size_t{0});
+  EXPECT_FALSE(Limit(_table_wrapper, to_expression(int64_t{-1})).constant_row_count());
+  EXPECT_FALSE(Limit(_table_wrapper, add_(1, 2)).constant_row_count());
+  EXPECT_FALSE(Limit(_table_wrapper, placeholder_(ParameterID{0})).constant_row_count());
+}
+
 TEST_F(OperatorsLimitTest, ForwardSortedByFlag) {
   auto limit = std::make_shared<Limit>(_table_wrapper, to_expression(int64_t{4}));
   limit->execute();
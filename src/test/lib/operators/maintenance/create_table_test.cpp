@@ -44,7 +44,7 @@ TEST_F(CreateTableTest, NameAndDescription) {
   const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   create_table->set_transaction_context(context);
   create_table->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
   dummy_table_wrapper->clear_output();
 
   EXPECT_EQ(create_table->description(DescriptionMode::MultiLine),
@@ -65,7 +65,7 @@ TEST_F(CreateTableTest, NameAndDescriptionWithConstraints) {
   const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   create_table->set_transaction_context(context);
   create_table->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
   dummy_table_wrapper->clear_output();
 
   // Case (ii): CreateTable operator has to retrieve the columns' information from the created and stored table.
@@ -78,7 +78,7 @@ TEST_F(CreateTableTest, Execute) {
   create_table->set_transaction_context(context);
 
   create_table->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_TRUE(create_table->executed());
   EXPECT_FALSE(create_table->get_output());
@@ -98,7 +98,7 @@ TEST_F(CreateTableTest, SoftKeyConstraints) {
   const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
   create_table->set_transaction_context(context);
   create_table->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_TRUE(create_table->executed());
   EXPECT_FALSE(create_table->get_output());
@@ -115,7 +115,7 @@ TEST_F(CreateTableTest, TableAlreadyExists) {
   create_table->set_transaction_context(context);
 
   create_table->execute();  // Table name "t" is taken now
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   const auto create_different_table = std::make_shared<CreateTable>("t2", false, dummy_table_wrapper);
   const auto create_same_table = std::make_shared<CreateTable>("t", false, dummy_table_wrapper);
@@ -126,7 +126,7 @@ TEST_F(CreateTableTest, TableAlreadyExists) {
   create_same_table->set_transaction_context(context_3);
 
   EXPECT_NO_THROW(create_different_table->execute());
-  context_2->commit();
+  EXPECT_TRUE(context_2->commit());
 
   EXPECT_THROW(create_same_table->execute(), std::logic_error);
   context_3->rollback(RollbackReason::Conflict);
@@ -138,7 +138,7 @@ TEST_F(CreateTableTest, ExecuteWithIfNotExists) {
   ct_if_not_exists_1->set_transaction_context(context);
 
   ct_if_not_exists_1->execute();
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   EXPECT_TRUE(Hyrise::get().storage_manager.has_table("t"));
 
@@ -152,7 +152,7 @@ TEST_F(CreateTableTest, ExecuteWithIfNotExists) {
   ct_if_not_exists_2->set_transaction_context(context_2);
 
   EXPECT_NO_THROW(ct_if_not_exists_2->execute());
-  context_2->commit();
+  EXPECT_TRUE(context_2->commit());
 }
 
 TEST_F(CreateTableTest, CreateTableAsSelect) {
@@ -171,7 +171,7 @@ TEST_F(CreateTableTest, CreateTableAsSelect) {
   const auto create_table_as = std::make_shared<CreateTable>("test_2", false, validate);
   create_table_as->set_transaction_context(context);
   EXPECT_NO_THROW(create_table_as->execute());
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   const auto created_table = Hyrise::get().storage_manager.get_table("test_2");
   EXPECT_TABLE_EQ_ORDERED(created_table, table);
@@ -204,7 +204,7 @@ TEST_F(CreateTableTest, CreateTableAsSelectWithProjection) {
   create_table_as->set_transaction_context(context);
   EXPECT_NO_THROW(create_table_as->execute());
 
-  context->commit();
+  EXPECT_TRUE(context->commit());
 
   const auto created_table = Hyrise::get().storage_manager.get_table("test_2");
 
@@ -245,7 +245,7 @@ TEST_F(CreateTableTest, CreateTableWithDifferentTransactionContexts) {
   create_table_as_2->set_transaction_context(context_1);
   EXPECT_NO_THROW(create_table_as_2->execute());
 
-  context_1->commit();
+  EXPECT_TRUE(context_1->commit());
 
   const auto table_3 = Hyrise::get().storage_manager.get_table("test_3");
   EXPECT_EQ(table_3->row_count(), 0);
@@ -259,7 +259,7 @@ TEST_F(CreateTableTest, CreateTableWithDifferentTransactionContexts) {
   const auto validate_3 = std::make_shared<Validate>(get_table_3);
   validate_3->set_transaction_context(context_3);
   validate_3->execute();
-  context_3->commit();
+  EXPECT_TRUE(context_3->commit());
 
   EXPECT_EQ(validate_3->get_output()->row_count(), 0);
 }
@@ -0,0 +1,224 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/morsel_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class MorselPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 10; ++value) {
+      const auto b_value = value % 4 == 0 ? AllTypeVariant{} : AllTypeVariant{value * 2};
+      _table->append({value, b_value});
+    }
+
+    _a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+    _b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+  }
+
+  // TableScan(a >= 2) -> TableScan(b < 16) -> Projection(a, a + b), ordered bottom-up
+  std::vector<std::shared_ptr<const AbstractOperator>> create_chain(
+      const std::shared_ptr<const AbstractOperator>& input_operator) const {
+    const auto scan_a = std::make_shared<TableScan>(input_operator, greater_than_equals_(_a, 2));
+    const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_(_b, 16));
+    const auto projection = std::make_shared<Projection>(scan_b, expression_vector(_a, add_(_a, _b)));
+    return {scan_a, scan_b, projection};
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<AbstractExpression> _a, _b;
+};
+
+TEST_F(MorselPipelineTest, Description) {
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_chain(_table_wrapper));
+  EXPECT_EQ(pipeline->type(), OperatorType::MorselPipeline);
+  EXPECT_EQ(pipeline->description(DescriptionMode::SingleLine),
+            "MorselPipeline TableScan -> TableScan -> Projection");
+  EXPECT_EQ(pipeline->operators().size(), 3);
+}
+
+TEST_F(MorselPipelineTest, IsPipelineable) {
+  const auto chain = create_chain(_table_wrapper);
+  EXPECT_TRUE(MorselPipeline::is_pipelineable(*chain[0]));
+  EXPECT_TRUE(MorselPipeline::is_pipelineable(*chain[2]));
+  EXPECT_TRUE(MorselPipeline::is_pipelineable(Validate{_table_wrapper}));
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(*_table_wrapper));
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(Limit{_table_wrapper, value_(int64_t{2})}));
+
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 5));
+  table_scan->excluded_chunk_ids = {ChunkID{1}};
+  EXPECT_FALSE(MorselPipeline::is_pipelineable(*table_scan));
+}
+
+TEST_F(MorselPipelineTest, ExecuteChain) {
+  const auto chain = create_chain(_table_wrapper);
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, chain);
+  pipeline->execute();
+
+  // The templates are not executed.
+  for (const auto& op : chain) {
+    EXPECT_FALSE(op->executed());
+  }
+
+  const auto expected_chain = create_chain(_table_wrapper);
+  for (const auto& op : expected_chain) {
+    std::const_pointer_cast<AbstractOperator>(op)->execute();
+  }
+
+  const auto& output = pipeline->get_output();
+  EXPECT_TABLE_EQ_ORDERED(output, expected_chain.back()->get_output());
+  EXPECT_EQ(output->type(), TableType::References);
+  EXPECT_LE(output->chunk_count(), _table->chunk_count());
+
+  // The output references the input table, not the per-morsel intermediate tables.
+  const auto reference_segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(reference_segment);
+  EXPECT_EQ(reference_segment->referenced_table(), _table);
+}
+
+TEST_F(MorselPipelineTest, ExecuteOnReferenceInput) {
+  const auto input_scan = std::make_shared<TableScan>(_table_wrapper, not_equals_(_a, 4));
+  input_scan->never_clear_output();
+  input_scan->execute();
+
+  const auto pipeline = std::make_shared<MorselPipeline>(input_scan, create_chain(input_scan));
+  pipeline->execute();
+
+  const auto expected_chain = create_chain(input_scan);
+  for (const auto& op : expected_chain) {
+    std::const_pointer_cast<AbstractOperator>(op)->execute();
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), expected_chain.back()->get_output());
+}
+
+TEST_F(MorselPipelineTest, RowLimit) {
+  // The morsels (chunks) hold one, two, two, and zero rows that satisfy both predicates.
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_chain(_table_wrapper));
+  pipeline->set_row_limit(3);
+  pipeline->execute();
+
+  const auto& output = pipeline->get_output();
+  EXPECT_EQ(output->chunk_count(), 2);
+  EXPECT_EQ(output->row_count(), 3);
+}
+
+TEST_F(MorselPipelineTest, EmptyInput) {
+  const auto empty_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  const auto table_wrapper = std::make_shared<TableWrapper>(empty_table);
+  table_wrapper->execute();
+
+  const auto pipeline = std::make_shared<MorselPipeline>(table_wrapper, create_chain(table_wrapper));
+  pipeline->execute();
+
+  const auto& output = pipeline->get_output();
+  EXPECT_EQ(output->row_count(), 0);
+  EXPECT_EQ(output->column_count(), 2);
+  EXPECT_EQ(output->column_data_type(ColumnID{1}), DataType::Int);
+}
+
+TEST_F(MorselPipelineTest, Validate) {
+  // Row 5 was deleted before the snapshot, row 7 was inserted after it.
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      chunk->mvcc_data()->set_begin_cid(chunk_offset, CommitID{0});
+    }
+  }
+  _table->get_chunk(ChunkID{1})->mvcc_data()->set_end_cid(ChunkOffset{2}, CommitID{1});
+  _table->get_chunk(ChunkID{1})->increase_invalid_row_count(ChunkOffset{1});
+  _table->get_chunk(ChunkID{2})->mvcc_data()->set_begin_cid(ChunkOffset{1}, CommitID{5});
+
+  const auto transaction_context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+
+  const auto validate = std::make_shared<Validate>(_table_wrapper);
+  const auto table_scan = std::make_shared<TableScan>(validate, greater_than_(_a, 3));
+  const auto pipeline = std::make_shared<MorselPipeline>(
+      _table_wrapper, std::vector<std::shared_ptr<const AbstractOperator>>{validate, table_scan});
+  pipeline->set_transaction_context(transaction_context);
+  pipeline->execute();
+
+  const auto expected_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_table->append({4, AllTypeVariant{}});
+  expected_table->append({6, 12});
+  expected_table->append({8, AllTypeVariant{}});
+  expected_table->append({9, 18});
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), expected_table);
+}
+
+TEST_F(MorselPipelineTest, DeepCopy) {
+  const auto pipeline = std::make_shared<MorselPipeline>(_table_wrapper, create_chain(_table_wrapper));
+  pipeline->execute();
+
+  const auto copied_pipeline = std::static_pointer_cast<MorselPipeline>(pipeline->deep_copy());
+  EXPECT_EQ(copied_pipeline->operators().size(), 3);
+  copied_pipeline->mutable_left_input()->execute();
+  copied_pipeline->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(copied_pipeline->get_output(), pipeline->get_output());
+}
+
+TEST_F(MorselPipelineTest, CreatePipelines) {
+  const auto chain = create_chain(_table_wrapper);
+  const auto limit = std::make_shared<Limit>(chain.back(), value_(int64_t{2}));
+
+  const auto pqp = MorselPipeline::create_pipelines(limit);
+  ASSERT_EQ(pqp->type(), OperatorType::Limit);
+
+  const auto pipeline = std::dynamic_pointer_cast<const MorselPipeline>(pqp->left_input());
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->operators().size(), 3);
+  EXPECT_EQ(pipeline->left_input()->type(), OperatorType::TableWrapper);
+  EXPECT_NE(pipeline->left_input(), _table_wrapper);
+
+  pqp->mutable_left_input()->mutable_left_input()->execute();
+  pqp->mutable_left_input()->execute();
+  pqp->execute();
+  EXPECT_EQ(pqp->get_output()->row_count(), 2);
+}
+
+TEST_F(MorselPipelineTest, CreatePipelinesWithSharedIntermediateResult) {
+  // The first scan is also consumed by the UnionAll, so its result must still be materialized.
+  const auto chain = create_chain(_table_wrapper);
+  const auto union_all = std::make_shared<UnionAll>(chain.back(), chain.front());
+
+  const auto pqp = MorselPipeline::create_pipelines(union_all);
+  const auto pipeline = std::dynamic_pointer_cast<const MorselPipeline>(pqp->left_input());
+  ASSERT_TRUE(pipeline);
+  EXPECT_EQ(pipeline->operators().size(), 2);
+  EXPECT_EQ(pipeline->left_input(), pqp->right_input());
+  EXPECT_EQ(pqp->right_input()->type(), OperatorType::TableScan);
+}
+
+TEST_F(MorselPipelineTest, CreatePipelinesWithoutChain) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(_a, 2));
+  const auto limit = std::make_shared<Limit>(table_scan, value_(int64_t{2}));
+
+  const auto pqp = MorselPipeline::create_pipelines(limit);
+  EXPECT_EQ(pqp->left_input()->type(), OperatorType::TableScan);
+}
+
+}  // namespace hyrise
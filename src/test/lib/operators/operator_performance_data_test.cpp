@@ -375,7 +375,7 @@ TEST_F(OperatorPerformanceDataTest, OperatorPerformanceDataHasOutputMarkerSet) {
   }
 
   // Committing to avoid error "Has registered operators but has neither been committed nor rolled back."
-  transaction_context->commit();
+  EXPECT_TRUE(transaction_context->commit());
 }
 
 TEST_F(OperatorPerformanceDataTest, JoinHashPerformanceToOutputStream) {
@@ -0,0 +1,66 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "operators/operator_row_limit.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class OperatorRowLimitTest : public BaseTest {};
+
+TEST_F(OperatorRowLimitTest, NoRowLimit) {
+  auto row_limit = OperatorRowLimit{std::nullopt, ChunkID{3}};
+  row_limit.add_chunk(ChunkID{0}, 100);
+  row_limit.add_chunk(ChunkID{1}, 100);
+
+  EXPECT_FALSE(row_limit.is_cancelled(ChunkID{2}));
+  EXPECT_EQ(row_limit.end_chunk_id(), ChunkID{3});
+}
+
+TEST_F(OperatorRowLimitTest, CancelAfterCompletedPrefix) {
+  auto row_limit = OperatorRowLimit{size_t{10}, ChunkID{5}};
+
+  // Chunk 2 alone has enough rows, but chunks 0 and 1 are not yet completed.
+  row_limit.add_chunk(ChunkID{2}, 20);
+  EXPECT_FALSE(row_limit.is_cancelled(ChunkID{3}));
+
+  row_limit.add_chunk(ChunkID{0}, 3);
+  EXPECT_FALSE(row_limit.is_cancelled(ChunkID{3}));
+
+  row_limit.add_chunk(ChunkID{1}, 5);
+  EXPECT_FALSE(row_limit.is_cancelled(ChunkID{2}));
+  EXPECT_TRUE(row_limit.is_cancelled(ChunkID{3}));
+  EXPECT_TRUE(row_limit.is_cancelled(ChunkID{4}));
+  EXPECT_EQ(row_limit.end_chunk_id(), ChunkID{3});
+
+  // Chunks that were processed before they were cancelled do not change the result.
+  row_limit.add_chunk(ChunkID{4}, 1);
+  EXPECT_EQ(row_limit.end_chunk_id(), ChunkID{3});
+}
+
+TEST_F(OperatorRowLimitTest, NotEnoughRows) {
+  auto row_limit = OperatorRowLimit{size_t{10}, ChunkID{2}};
+  row_limit.add_chunk(ChunkID{1}, 4);
+  row_limit.add_chunk(ChunkID{0}, 5);
+  EXPECT_EQ(row_limit.end_chunk_id(), ChunkID{2});
+}
+
+TEST_F(OperatorRowLimitTest, ZeroRowLimit) {
+  const auto row_limit = OperatorRowLimit{size_t{0}, ChunkID{2}};
+  EXPECT_TRUE(row_limit.is_cancelled(ChunkID{0}));
+  EXPECT_EQ(row_limit.end_chunk_id(), ChunkID{0});
+}
+
+TEST_F(OperatorRowLimitTest, PrefixChunkCount) {
+  const auto table = load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{3});
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  EXPECT_EQ(OperatorRowLimit::prefix_chunk_count(*table, std::nullopt), ChunkID{3});
+  EXPECT_EQ(OperatorRowLimit::prefix_chunk_count(*table, size_t{0}), ChunkID{0});
+  EXPECT_EQ(OperatorRowLimit::prefix_chunk_count(*table, size_t{3}), ChunkID{1});
+  EXPECT_EQ(OperatorRowLimit::prefix_chunk_count(*table, size_t{4}), ChunkID{2});
+  EXPECT_EQ(OperatorRowLimit::prefix_chunk_count(*table, size_t{100}), ChunkID{3});
+}
+
+}  // namespace hyrise
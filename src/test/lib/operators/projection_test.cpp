@@ -60,6 +60,15 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, RowLimit) {
+  // Only the first chunk (with two rows) is projected.
+  const auto projection = std::make_shared<Projection>(table_wrapper_a, expression_vector(a_a, add_(a_a, a_b)));
+  projection->set_row_limit(2);
+  projection->execute();
+  EXPECT_EQ(projection->get_output()->chunk_count(), 1);
+  EXPECT_EQ(projection->get_output()->row_count(), 2);
+}
+
 TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
 
@@ -72,7 +81,7 @@ TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
 
-  transaction_context->commit();
+  EXPECT_TRUE(transaction_context->commit());
 
   const auto projection = std::make_shared<Projection>(table_wrapper_a, expression_vector(a_a, a_b));
 
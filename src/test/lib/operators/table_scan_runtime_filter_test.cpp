@@ -0,0 +1,265 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/pqp_utils.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_scan/runtime_filter.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class TableScanRuntimeFilterTest : public BaseTest {
+ public:
+  // Creates a table with a single nullable int column and one chunk per entry in `chunk_values`. NULL values are given
+  // as std::nullopt.
+  static std::shared_ptr<Table> create_table(const std::vector<std::vector<std::optional<int32_t>>>& chunk_values,
+                                             const std::optional<EncodingType> encoding_type = std::nullopt) {
+    const auto table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    for (const auto& values : chunk_values) {
+      auto column_values = pmr_vector<int32_t>{};
+      auto null_values = pmr_vector<bool>{};
+      for (const auto& value : values) {
+        column_values.emplace_back(value.value_or(0));
+        null_values.emplace_back(!value);
+      }
+      table->append_chunk(
+          Segments{std::make_shared<ValueSegment<int32_t>>(std::move(column_values), std::move(null_values))});
+      table->last_chunk()->finalize();
+    }
+
+    if (encoding_type) {
+      ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{*encoding_type});
+    }
+    return table;
+  }
+
+  static std::vector<ChunkOffset> filter_all_rows(const RuntimeFilter& runtime_filter, const Chunk& chunk) {
+    const auto matches = std::make_shared<RowIDPosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+      matches->emplace_back(ChunkID{0}, chunk_offset);
+    }
+
+    runtime_filter.filter(chunk, ColumnID{0}, matches);
+
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    for (const auto& match : *matches) {
+      chunk_offsets.emplace_back(match.chunk_offset);
+    }
+    return chunk_offsets;
+  }
+};
+
+TEST_F(TableScanRuntimeFilterTest, FilterRows) {
+  const auto reducer_table = create_table({{3, std::nullopt, 7}, {5}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+  EXPECT_EQ(runtime_filter.data_type(), DataType::Int);
+  EXPECT_EQ(runtime_filter.value_count(), size_t{3});
+
+  const auto table = create_table({{1, 3, std::nullopt, 5, 7, 8, 20, 3}});
+  const auto chunk_offsets = filter_all_rows(runtime_filter, *table->get_chunk(ChunkID{0}));
+
+  // All values of the reducer pass the filter. Values outside of [3, 7] and NULL values are removed. As the Bloom
+  // filter has false positives, 4 and 6 could pass as well, but they are not part of the table.
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{ChunkOffset{1}, ChunkOffset{3}, ChunkOffset{4}, ChunkOffset{7}}));
+}
+
+TEST_F(TableScanRuntimeFilterTest, FilterRowsDictionaryEncoded) {
+  const auto reducer_table = create_table({{10, 12, 14}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+
+  const auto table = create_table({{14, 9, 15, std::nullopt, 10}}, EncodingType::Dictionary);
+  const auto chunk_offsets = filter_all_rows(runtime_filter, *table->get_chunk(ChunkID{0}));
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{4}}));
+}
+
+TEST_F(TableScanRuntimeFilterTest, FilterRowsReferenceSegment) {
+  const auto reducer_table = create_table({{3, std::nullopt, 7}, {5}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+
+  // The reference segment references both chunks of the data table, a NULL value, and a NULL row.
+  const auto data_table = create_table({{1, 3, std::nullopt}, {5, 7, 8}});
+  const auto pos_list = std::make_shared<RowIDPosList>(
+      RowIDPosList{RowID{ChunkID{1}, ChunkOffset{2}}, RowID{ChunkID{0}, ChunkOffset{1}}, NULL_ROW_ID,
+                   RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{1}, ChunkOffset{1}},
+                   RowID{ChunkID{0}, ChunkOffset{0}}});
+  const auto chunk = Chunk{Segments{std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, pos_list)}};
+
+  const auto chunk_offsets = filter_all_rows(runtime_filter, chunk);
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{ChunkOffset{1}, ChunkOffset{4}}));
+}
+
+TEST_F(TableScanRuntimeFilterTest, PruneChunks) {
+  const auto reducer_table = create_table({{10, 20}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+
+  // Chunks with pruning statistics.
+  const auto table = create_table({{1, 5, 9}, {5, 15}, {21, 30}, {std::nullopt}}, EncodingType::Dictionary);
+  ASSERT_TRUE(table->get_chunk(ChunkID{0})->pruning_statistics());
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{0}), ColumnID{0}));
+  EXPECT_FALSE(runtime_filter.can_prune(*table->get_chunk(ChunkID{1}), ColumnID{0}));
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{2}), ColumnID{0}));
+
+  // Without pruning statistics, the dictionaries of the segments are used.
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->set_pruning_statistics(std::nullopt);
+  }
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{0}), ColumnID{0}));
+  EXPECT_FALSE(runtime_filter.can_prune(*table->get_chunk(ChunkID{1}), ColumnID{0}));
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{2}), ColumnID{0}));
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{3}), ColumnID{0}));
+
+  // Unencoded segments without pruning statistics cannot be pruned.
+  const auto unencoded_table = create_table({{1, 5, 9}});
+  EXPECT_FALSE(runtime_filter.can_prune(*unencoded_table->get_chunk(ChunkID{0}), ColumnID{0}));
+}
+
+TEST_F(TableScanRuntimeFilterTest, PruneReferenceChunks) {
+  const auto reducer_table = create_table({{10, 20}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+  const auto data_table = create_table({{1, 5, 9}, {5, 15}, {21, 30}}, EncodingType::Dictionary);
+
+  const auto create_reference_chunk = [&](RowIDPosList&& pos_list) {
+    return Chunk{Segments{std::make_shared<ReferenceSegment>(data_table, ColumnID{0},
+                                                             std::make_shared<RowIDPosList>(std::move(pos_list)))}};
+  };
+
+  // Chunks that reference a single chunk are pruned based on the referenced chunk.
+  auto first_pos_list = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{0}, ChunkOffset{2}}};
+  first_pos_list.guarantee_single_chunk();
+  EXPECT_TRUE(runtime_filter.can_prune(create_reference_chunk(std::move(first_pos_list)), ColumnID{0}));
+
+  auto second_pos_list = RowIDPosList{RowID{ChunkID{1}, ChunkOffset{0}}};
+  second_pos_list.guarantee_single_chunk();
+  EXPECT_FALSE(runtime_filter.can_prune(create_reference_chunk(std::move(second_pos_list)), ColumnID{0}));
+
+  // Chunks that reference multiple chunks are not pruned, even though none of the referenced chunks can match.
+  auto multi_chunk_pos_list = RowIDPosList{RowID{ChunkID{0}, ChunkOffset{0}}, RowID{ChunkID{2}, ChunkOffset{1}}};
+  EXPECT_FALSE(runtime_filter.can_prune(create_reference_chunk(std::move(multi_chunk_pos_list)), ColumnID{0}));
+}
+
+TEST_F(TableScanRuntimeFilterTest, EmptyReducer) {
+  const auto reducer_table = create_table({{std::nullopt}});
+  const auto runtime_filter = RuntimeFilter{*reducer_table, ColumnID{0}};
+  EXPECT_EQ(runtime_filter.value_count(), size_t{0});
+
+  const auto table = create_table({{1, 2, 3}});
+  EXPECT_TRUE(runtime_filter.can_prune(*table->get_chunk(ChunkID{0}), ColumnID{0}));
+  EXPECT_TRUE(filter_all_rows(runtime_filter, *table->get_chunk(ChunkID{0})).empty());
+}
+
+TEST_F(TableScanRuntimeFilterTest, TableScanAppliesRuntimeFilter) {
+  // The reducer holds a contiguous range of values, so that the Bloom filter cannot produce false positives for values
+  // within [min, max].
+  const auto reducer = std::make_shared<TableWrapper>(create_table({{10, 11, 12, 13}, {14, 15, std::nullopt}}));
+  reducer->never_clear_output();
+  const auto input = std::make_shared<TableWrapper>(
+      create_table({{1, 12, 16, 14}, {2, 3, 4}, {std::nullopt, 15, 20, 10}}, EncodingType::Dictionary));
+  input->never_clear_output();
+  execute_all({reducer, input});
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto table_scan =
+      std::make_shared<TableScan>(input, greater_than_(column, 1), reducer, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  table_scan->execute();
+
+  EXPECT_EQ(table_scan->runtime_filter_column_ids(), (ColumnIDPair{ColumnID{0}, ColumnID{0}}));
+  EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), create_table({{12, 14, 15, 10}}));
+
+  const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*table_scan->performance_data);
+  EXPECT_TRUE(performance_data.has_runtime_filter);
+  EXPECT_EQ(performance_data.num_chunks_pruned_by_runtime_filter.load(), size_t{1});
+  EXPECT_EQ(performance_data.num_rows_filtered_by_runtime_filter.load(), size_t{2});
+
+  // The runtime filter is kept when copying the TableScan.
+  const auto copied_table_scan = std::static_pointer_cast<TableScan>(table_scan->deep_copy());
+  EXPECT_EQ(copied_table_scan->runtime_filter_column_ids(), table_scan->runtime_filter_column_ids());
+  EXPECT_TRUE(copied_table_scan->right_input());
+}
+
+TEST_F(TableScanRuntimeFilterTest, TableScanAppliesRuntimeFilterOnReferenceTable) {
+  // As for a validated table, the input of the filtering TableScan is a reference table. The filter is applied by an
+  // IS NOT NULL scan, as done by the LQPTranslator for semi join reductions without a suitable predicate.
+  const auto reducer = std::make_shared<TableWrapper>(create_table({{10, 11, 12, 13}, {14, 15, std::nullopt}}));
+  reducer->never_clear_output();
+  const auto data_input = std::make_shared<TableWrapper>(
+      create_table({{1, 12, 16, 14}, {2, 3, 4}, {std::nullopt, 15, 20, 10}}, EncodingType::Dictionary));
+  data_input->never_clear_output();
+
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto input = std::make_shared<TableScan>(data_input, greater_than_(column, 1));
+  input->never_clear_output();
+  execute_all({reducer, data_input, input});
+  ASSERT_EQ(input->get_output()->type(), TableType::References);
+
+  const auto table_scan =
+      std::make_shared<TableScan>(input, is_not_null_(column), reducer, ColumnIDPair{ColumnID{0}, ColumnID{0}});
+  table_scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), create_table({{12, 14, 15, 10}}));
+
+  // The second chunk only references values in [2, 4] and is pruned based on the referenced chunk.
+  const auto& performance_data = dynamic_cast<TableScan::PerformanceData&>(*table_scan->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_pruned_by_runtime_filter.load(), size_t{1});
+  EXPECT_EQ(performance_data.num_rows_filtered_by_runtime_filter.load(), size_t{2});
+}
+
+TEST_F(TableScanRuntimeFilterTest, SQLWithMvcc) {
+  // With MVCC, the stored tables are read through a Validate, so the runtime filter is applied to a reference table.
+  const auto create_mvcc_table = [](const std::string& column_name, const int32_t row_count) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{column_name, DataType::Int, false}},
+                                               TableType::Data, ChunkOffset{1'000}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      table->append({value});
+    }
+    return table;
+  };
+
+  // Based on the statistics, about half of the rows of table_a find a join partner. This is not selective enough for a
+  // semi join, but for a runtime filter (see SemiJoinReductionRule).
+  Hyrise::get().storage_manager.add_table("table_a", create_mvcc_table("a", 10'000));
+  Hyrise::get().storage_manager.add_table("table_b", create_mvcc_table("b", 5'000));
+
+  auto delete_pipeline = SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 100 OR a = 7000"}.create_pipeline();
+  EXPECT_EQ(delete_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT a FROM table_a, table_b WHERE a = b"}.create_pipeline();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  ASSERT_TRUE(table);
+  EXPECT_EQ(table->row_count(), 4'999);
+
+  auto runtime_filter_scans = std::vector<std::shared_ptr<const TableScan>>{};
+  visit_pqp(sql_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    const auto table_scan = std::dynamic_pointer_cast<const TableScan>(op);
+    if (table_scan && table_scan->runtime_filter_column_ids()) {
+      runtime_filter_scans.emplace_back(table_scan);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+  ASSERT_EQ(runtime_filter_scans.size(), 1);
+  EXPECT_EQ(runtime_filter_scans.front()->left_input()->type(), OperatorType::Validate);
+
+  // The immutable chunks with values above 4'999 are pruned. The last chunk is still mutable and has no pruning
+  // statistics, so its rows are filtered.
+  const auto& performance_data =
+      dynamic_cast<const TableScan::PerformanceData&>(*runtime_filter_scans.front()->performance_data);
+  EXPECT_EQ(performance_data.num_chunks_pruned_by_runtime_filter.load(), size_t{4});
+  EXPECT_EQ(performance_data.num_rows_filtered_by_runtime_filter.load(), size_t{1'000});
+}
+
+}  // namespace hyrise
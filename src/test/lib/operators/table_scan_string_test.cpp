@@ -313,6 +313,14 @@ TEST_P(OperatorsTableScanStringTest, ScanNotLikeAllRowsOnDict) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanNotLikeStartingOnDictSegment) {
+  std::shared_ptr<Table> expected_result =
+      load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", ChunkOffset{1});
+  auto scan = create_table_scan(_tw_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
 TEST_F(OperatorsTableScanStringTest, ScanNotLikeUnderscoreWildcard) {
   std::shared_ptr<Table> expected_result =
       load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", ChunkOffset{1});
@@ -283,6 +283,21 @@ TEST_P(OperatorsTableScanTest, EmptyResultScan) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, RowLimit) {
+  // The first chunk holds three matches, the second one holds one.
+  auto scan_1 = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 10);
+  scan_1->set_row_limit(2);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->get_output()->chunk_count(), 1);
+  EXPECT_EQ(scan_1->get_output()->row_count(), 3);
+
+  auto scan_2 = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 10);
+  scan_2->set_row_limit(4);
+  scan_2->execute();
+  EXPECT_EQ(scan_2->get_output()->chunk_count(), 2);
+  EXPECT_EQ(scan_2->get_output()->row_count(), 4);
+}
+
 TEST_P(OperatorsTableScanTest, SingleScan) {
   const auto expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", ChunkOffset{1});
 
@@ -42,6 +42,21 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, RowLimit) {
+  // The chunks of table a hold two rows and one row, those of table b hold two rows each.
+  auto union_all_1 = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all_1->set_row_limit(2);
+  union_all_1->execute();
+  EXPECT_EQ(union_all_1->get_output()->chunk_count(), 1);
+  EXPECT_EQ(union_all_1->get_output()->row_count(), 2);
+
+  auto union_all_2 = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all_2->set_row_limit(4);
+  union_all_2->execute();
+  EXPECT_EQ(union_all_2->get_output()->chunk_count(), 3);
+  EXPECT_EQ(union_all_2->get_output()->row_count(), 5);
+}
+
 TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_union.tbl", ChunkOffset{2});
 
@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace hyrise {
@@ -301,12 +302,100 @@ TEST_F(UnionPositionsTest, MultipleShuffledPosList) {
 
   auto table_wrapper_left_op = std::make_shared<TableWrapper>(table_left);
   auto table_wrapper_right_op = std::make_shared<TableWrapper>(table_right);
-  auto set_union_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+  execute_all({table_wrapper_left_op, table_wrapper_right_op});
 
-  execute_all({table_wrapper_left_op, table_wrapper_right_op, set_union_op});
+  // Both algorithms keep duplicate rows of the inputs (with std::set_union semantics).
+  for (const auto algorithm : {UnionPositions::Algorithm::SortMerge, UnionPositions::Algorithm::Hash}) {
+    auto set_union_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op, algorithm);
+    set_union_op->execute();
 
-  EXPECT_TABLE_EQ_UNORDERED(set_union_op->get_output(),
-                            load_table("resources/test_data/tbl/union_positions_multiple_shuffled_pos_list.tbl"));
+    EXPECT_TABLE_EQ_UNORDERED(set_union_op->get_output(),
+                              load_table("resources/test_data/tbl/union_positions_multiple_shuffled_pos_list.tbl"));
+  }
+}
+
+TEST_F(UnionPositionsTest, HashSelfUnionOverlappingRanges) {
+  auto get_table_op = std::make_shared<GetTable>("10_ints");
+  auto table_scan_a_op = std::make_shared<TableScan>(get_table_op, greater_than_(_int_column_0_non_nullable, 20));
+  auto table_scan_b_op = std::make_shared<TableScan>(get_table_op, less_than_(_int_column_0_non_nullable, 100));
+  auto union_unique_op =
+      std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op, UnionPositions::Algorithm::Hash);
+
+  execute_all({get_table_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  EXPECT_TABLE_EQ_UNORDERED(union_unique_op->get_output(), _table_10_ints);
+}
+
+TEST_F(UnionPositionsTest, HashMultipleReferencedTables) {
+  auto get_table_a_op = std::make_shared<GetTable>("int_float4");
+  auto get_table_b_op = std::make_shared<GetTable>("int_int");
+  auto join =
+      std::make_shared<JoinNestedLoop>(get_table_a_op, get_table_b_op, JoinMode::Inner,
+                                       OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+
+  auto table_scan_a_op =
+      std::make_shared<TableScan>(join, greater_than_equals_(pqp_column_(ColumnID{3}, DataType::Int, false, ""), 2));
+  auto table_scan_b_op = std::make_shared<TableScan>(join, less_than_(_float_column_1_non_nullable, 457.0));
+  auto union_unique_op =
+      std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op, UnionPositions::Algorithm::Hash);
+
+  execute_all({get_table_a_op, get_table_b_op, join, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  EXPECT_TABLE_EQ_UNORDERED(union_unique_op->get_output(),
+                            load_table("resources/test_data/tbl/int_float4_int_int_union_positions.tbl"));
+}
+
+TEST_F(UnionPositionsTest, AlgorithmChoice) {
+  // The union of two large, shuffled inputs is computed by multiple hash jobs. The union of the (sorted) outputs of
+  // table scans is computed by sorting and merging.
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto row_count = static_cast<int32_t>(UnionPositions::MIN_ROWS_PER_JOB * 4);
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1'000});
+  for (auto value = int32_t{0}; value < row_count; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->set_immutable();
+
+  // The left input references all rows in reverse order, the right input every third row in reverse order.
+  const auto create_reversed_reference_table = [&](const auto step) {
+    const auto pos_list = std::make_shared<RowIDPosList>();
+    for (auto row_idx = row_count - 1; row_idx >= 0; row_idx -= step) {
+      pos_list->emplace_back(ChunkID{static_cast<ChunkID::base_type>(row_idx / 1'000)},
+                             ChunkOffset{static_cast<ChunkOffset::base_type>(row_idx % 1'000)});
+    }
+    const auto reference_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+    reference_table->append_chunk(Segments{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto shuffled_left = create_reversed_reference_table(1);
+  const auto shuffled_right = create_reversed_reference_table(3);
+  const auto hash_union = std::make_shared<UnionPositions>(shuffled_left, shuffled_right);
+  hash_union->execute();
+
+  const auto& hash_performance_data =
+      static_cast<const UnionPositions::PerformanceData&>(*hash_union->performance_data);
+  EXPECT_EQ(hash_performance_data.algorithm, UnionPositions::Algorithm::Hash);
+  if (Hyrise::get().topology.num_cpus() > 1) {
+    EXPECT_GT(hash_performance_data.job_count, size_t{1});
+  }
+  EXPECT_TABLE_EQ_UNORDERED(hash_union->get_output(), table);
+
+  auto get_table_op = std::make_shared<GetTable>("10_ints");
+  auto table_scan_a_op = std::make_shared<TableScan>(get_table_op, greater_than_(_int_column_0_non_nullable, 20));
+  auto table_scan_b_op = std::make_shared<TableScan>(get_table_op, less_than_(_int_column_0_non_nullable, 100));
+  auto sort_merge_union = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+  execute_all({get_table_op, table_scan_a_op, table_scan_b_op, sort_merge_union});
+
+  const auto& sort_merge_performance_data =
+      static_cast<const UnionPositions::PerformanceData&>(*sort_merge_union->performance_data);
+  EXPECT_EQ(sort_merge_performance_data.algorithm, UnionPositions::Algorithm::SortMerge);
 }
 
 TEST_F(UnionPositionsTest, DifferentTables) {
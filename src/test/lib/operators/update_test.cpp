@@ -8,8 +8,10 @@
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -48,7 +50,7 @@ class OperatorsUpdateTest : public BaseTest {
     const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
     update->set_transaction_context(transaction_context);
     update->execute();
-    transaction_context->commit();
+    EXPECT_TRUE(transaction_context->commit());
 
     // Get validated table which should have the same row twice.
     const auto post_update_transaction_context =
@@ -84,4 +86,65 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, SharesUnchangedSegmentsOfEntireChunks) {
+  // Updates both rows of the first chunk and the first row of the second chunk.
+  helper(greater_than_(column_a, 100), expression_vector(column_a, 7.5f),
+         "resources/test_data/tbl/int_float2_updated_0.tbl");
+
+  // For the entirely updated first chunk, a new chunk is appended that shares the segment of the unchanged column.
+  // The updated row of the second chunk is copied into a new mutable chunk after it.
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  ASSERT_EQ(table->chunk_count(), 4u);
+  EXPECT_EQ(table->get_chunk(ChunkID{3})->size(), 1u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{3})->is_mutable());
+
+  const auto updated_chunk = table->get_chunk(ChunkID{0});
+  const auto shared_chunk = table->get_chunk(ChunkID{2});
+  EXPECT_EQ(shared_chunk->size(), 2u);
+  EXPECT_FALSE(shared_chunk->is_mutable());
+  EXPECT_EQ(shared_chunk->get_segment(ColumnID{0}), updated_chunk->get_segment(ColumnID{0}));
+  EXPECT_NE(shared_chunk->get_segment(ColumnID{1}), updated_chunk->get_segment(ColumnID{1}));
+  EXPECT_EQ((*shared_chunk->get_segment(ColumnID{1}))[ChunkOffset{1}], AllTypeVariant{7.5f});
+
+  // The rows of the first chunk are invalidated as a whole.
+  const auto commit_id = *shared_chunk->mvcc_data()->max_begin_cid;
+  EXPECT_EQ(updated_chunk->mvcc_data()->max_end_cid(), commit_id);
+  EXPECT_EQ(updated_chunk->mvcc_data()->get_end_cid(ChunkOffset{1}), commit_id);
+  EXPECT_EQ(updated_chunk->invalid_row_count(), 2u);
+}
+
+TEST_F(OperatorsUpdateTest, FillsPartiallyFilledChunkBeforeSharingSegments) {
+  // Insert a row so that the last chunk of the table is mutable and only partially filled.
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  const auto row_table = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  row_table->append({12, 351.7f});
+  const auto table_wrapper = std::make_shared<TableWrapper>(row_table);
+  table_wrapper->execute();
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>(table_to_update_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  EXPECT_TRUE(transaction_context->commit());
+
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->size(), 1u);
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+
+  // Updates both rows of the first chunk and the first row of the second chunk.
+  helper(greater_than_(column_a, 100), expression_vector(column_a, 7.5f),
+         "resources/test_data/tbl/int_float2_updated_0_inserted.tbl");
+
+  // The updated row of the second chunk fills the partially filled chunk. Only then, the chunk that shares the segment
+  // of the unchanged column is appended. No partially filled, mutable chunk is left behind in the middle of the table.
+  ASSERT_EQ(table->chunk_count(), 4u);
+  const auto filled_chunk = table->get_chunk(ChunkID{2});
+  EXPECT_EQ(filled_chunk->size(), 2u);
+  EXPECT_EQ((*filled_chunk->get_segment(ColumnID{1}))[ChunkOffset{1}], AllTypeVariant{7.5f});
+
+  const auto shared_chunk = table->get_chunk(ChunkID{3});
+  EXPECT_EQ(shared_chunk->size(), 2u);
+  EXPECT_FALSE(shared_chunk->is_mutable());
+  EXPECT_EQ(shared_chunk->get_segment(ColumnID{0}), table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+}
+
 }  // namespace hyrise
@@ -92,6 +92,24 @@ TEST_F(OperatorsValidateTest, SimpleValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, RowLimit) {
+  auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+
+  // The first chunk holds two visible rows, the second one holds one.
+  auto validate_1 = std::make_shared<Validate>(_table_wrapper);
+  validate_1->set_transaction_context(context);
+  validate_1->set_row_limit(2);
+  validate_1->execute();
+  EXPECT_EQ(validate_1->get_output()->chunk_count(), 1);
+  EXPECT_EQ(validate_1->get_output()->row_count(), 2);
+
+  auto validate_2 = std::make_shared<Validate>(_table_wrapper);
+  validate_2->set_transaction_context(context);
+  validate_2->set_row_limit(3);
+  validate_2->execute();
+  EXPECT_EQ(validate_2->get_output()->row_count(), 3);
+}
+
 TEST_F(OperatorsValidateTest, ScanValidate) {
   auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
 
@@ -119,7 +137,7 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   validate1->execute();
 
   EXPECT_EQ(validate1->get_output()->row_count(), 8);
-  t1_context->commit();
+  EXPECT_TRUE(t1_context->commit());
 
   auto t2_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
 
@@ -136,7 +154,7 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   validate2->execute();
 
   EXPECT_EQ(validate2->get_output()->row_count(), 7);
-  t2_context->commit();
+  EXPECT_TRUE(t2_context->commit());
 }
 
 TEST_F(OperatorsValidateTest, ChunkEntirelyVisibleThrowsOnRefChunk) {
@@ -288,4 +306,92 @@ TEST_F(OperatorsValidateTest, ForwardSortedByFlag) {
   }
 }
 
+TEST_F(OperatorsValidateTest, VisibilityBitmapMatchesRowVisibility) {
+  // Cover more than one block of 64 rows and a partial block.
+  const auto row_count = uint32_t{150};
+  const auto our_tid = TransactionID{7};
+  const auto snapshot_commit_id = CommitID{5};
+
+  auto mvcc_data = MvccData{row_count, CommitID{0}};
+  for (auto index = uint32_t{0}; index < row_count; ++index) {
+    const auto chunk_offset = ChunkOffset{index};
+    mvcc_data.set_begin_cid(chunk_offset, index % 3 == 0 ? MvccData::MAX_COMMIT_ID : CommitID{index % 9});
+    mvcc_data.set_end_cid(chunk_offset, index % 4 == 0 ? CommitID{index % 8} : MvccData::MAX_COMMIT_ID);
+    mvcc_data.set_tid(chunk_offset, index % 5 == 0 ? our_tid : TransactionID{index % 2});
+  }
+
+  const auto visibility = mvcc_data.compute_visibility(our_tid, snapshot_commit_id, ChunkOffset{row_count}, true);
+  const auto visibility_without_tids =
+      mvcc_data.compute_visibility(TransactionID{100}, snapshot_commit_id, ChunkOffset{row_count}, false);
+  ASSERT_EQ(visibility.size(), 3);
+  ASSERT_EQ(visibility_without_tids.size(), 3);
+
+  for (auto index = uint32_t{0}; index < row_count; ++index) {
+    const auto chunk_offset = ChunkOffset{index};
+    const auto row_tid = mvcc_data.get_tid(chunk_offset);
+    const auto begin_cid = mvcc_data.get_begin_cid(chunk_offset);
+    const auto end_cid = mvcc_data.get_end_cid(chunk_offset);
+    const auto is_set = [&](const auto& bitmap) {
+      return static_cast<bool>((bitmap[index / 64] >> (index % 64)) & 1);
+    };
+
+    EXPECT_EQ(is_set(visibility), Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid));
+    EXPECT_EQ(is_set(visibility_without_tids),
+              Validate::is_row_visible(TransactionID{100}, snapshot_commit_id, row_tid, begin_cid, end_cid));
+  }
+
+  // Bits of rows beyond row_count are not set.
+  EXPECT_EQ(visibility[2] >> (row_count % 64), 0);
+}
+
+TEST_F(OperatorsValidateTest, CachedVisibility) {
+  auto mvcc_data = MvccData{4, CommitID{0}};
+  mvcc_data.set_begin_cid(ChunkOffset{1}, CommitID{3});
+  mvcc_data.set_begin_cid(ChunkOffset{3}, MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.max_commit_id(), CommitID{3});
+
+  EXPECT_FALSE(mvcc_data.cached_visibility(CommitID{4}, ChunkOffset{3}));
+  const auto visibility = mvcc_data.visibility(CommitID{4}, ChunkOffset{3});
+  EXPECT_EQ(*visibility, MvccData::VisibilityBitmap{0b111});
+
+  // Newer snapshots and older snapshots that see the same commits reuse the cached visibility.
+  EXPECT_EQ(mvcc_data.cached_visibility(CommitID{10}, ChunkOffset{3}), visibility);
+  EXPECT_EQ(mvcc_data.visibility(CommitID{3}, ChunkOffset{3}), visibility);
+  EXPECT_FALSE(mvcc_data.cached_visibility(CommitID{2}, ChunkOffset{3}));
+
+  // Rows that were appended afterwards are not covered.
+  EXPECT_FALSE(mvcc_data.cached_visibility(CommitID{4}, ChunkOffset{4}));
+
+  // A row that is deleted by a commit newer than the cached snapshot invalidates the cached visibility.
+  mvcc_data.set_end_cid(ChunkOffset{0}, CommitID{6});
+  EXPECT_FALSE(mvcc_data.cached_visibility(CommitID{10}, ChunkOffset{3}));
+  EXPECT_EQ(*mvcc_data.visibility(CommitID{10}, ChunkOffset{3}), MvccData::VisibilityBitmap{0b110});
+  EXPECT_TRUE(mvcc_data.cached_visibility(CommitID{12}, ChunkOffset{3}));
+  EXPECT_EQ(*mvcc_data.visibility(CommitID{5}, ChunkOffset{3}), MvccData::VisibilityBitmap{0b111});
+}
+
+TEST_F(OperatorsValidateTest, ValidateUsesCachedVisibility) {
+  // Validate data and reference chunks of chunks that are not entirely visible.
+  const auto read_only_context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(read_only_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3);
+
+  const auto mvcc_data = _test_table->get_chunk(ChunkID{1})->mvcc_data();
+  const auto visibility = mvcc_data->cached_visibility(CommitID{3}, ChunkOffset{2});
+  ASSERT_TRUE(visibility);
+
+  // A newer snapshot reuses the visibility.
+  const auto newer_context = std::make_shared<TransactionContext>(TransactionID{2}, CommitID{8}, AutoCommit::No);
+  auto a = PQPColumnExpression::from_table(*_test_table, "a");
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_equals_(a, 0));
+  table_scan->execute();
+  validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(newer_context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 3);
+  EXPECT_EQ(mvcc_data->cached_visibility(CommitID{8}, ChunkOffset{2}), visibility);
+}
+
 }  // namespace hyrise
@@ -0,0 +1,183 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+/**
+ * DpHyp shares most of its plan construction with DpCcp (see DpCcpTest). These tests cover what is different: the use
+ * of hyperedges for connecting subgraphs, the bounded search, and the parallel evaluation. EnumerateHyperCcp is tested
+ * separately.
+ */
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class DpHypTest : public BaseTest {
+ public:
+  void SetUp() override {
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 50, 20, 10)});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(40, 100, 20, 10)});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 20, 10)});
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+  }
+
+  static std::shared_ptr<AbstractCostEstimator> create_cost_estimator(const JoinGraph& join_graph) {
+    const auto cost_estimator = std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>());
+    cost_estimator->guarantee_bottom_up_construction();
+    cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph);
+    return cost_estimator;
+  }
+
+  // Creates `vertex_count` vertices with different sizes and value ranges. If `clique` is set, all vertices are joined
+  // with each other. Otherwise, they form a star around the first vertex.
+  static JoinGraph create_join_graph(const size_t vertex_count, const bool clique) {
+    auto vertices = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+    auto columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+    for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+      const auto row_count = 10 * (vertex_idx + 1);
+      const auto max_value = static_cast<int32_t>(20 + 10 * ((vertex_idx * 7) % vertex_count));
+      const auto node = create_mock_node_with_statistics(
+          MockNode::ColumnDefinitions{{DataType::Int, "a"}}, row_count,
+          {GenericHistogram<int32_t>::with_single_bin(1, max_value, static_cast<float>(row_count), 10)});
+      vertices.emplace_back(node);
+      columns.emplace_back(node->get_column("a"));
+    }
+
+    auto edges = std::vector<JoinGraphEdge>{};
+    for (auto first_vertex_idx = size_t{0}; first_vertex_idx < vertex_count; ++first_vertex_idx) {
+      for (auto second_vertex_idx = first_vertex_idx + 1; second_vertex_idx < vertex_count; ++second_vertex_idx) {
+        if (!clique && first_vertex_idx != 0) {
+          break;
+        }
+
+        auto vertex_set = JoinGraphVertexSet{vertex_count};
+        vertex_set.set(first_vertex_idx);
+        vertex_set.set(second_vertex_idx);
+        edges.emplace_back(vertex_set,
+                           expression_vector(equals_(columns[first_vertex_idx], columns[second_vertex_idx])));
+      }
+    }
+
+    return JoinGraph{vertices, edges};
+  }
+
+  static size_t count_nodes(const std::shared_ptr<AbstractLQPNode>& lqp, const LQPNodeType type) {
+    auto node_count = size_t{0};
+    visit_lqp(lqp, [&](const auto& node) {
+      if (node->type == type) {
+        ++node_count;
+      }
+      return LQPVisitation::VisitInputs;
+    });
+    return node_count;
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a;
+};
+
+TEST_F(DpHypTest, JoinOrdering) {
+  // Same JoinGraph and result as in DpCcpTest::JoinOrdering.
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  const auto actual_lqp = DpHyp{}(join_graph, create_cost_estimator(join_graph));  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, expression_vector(equals_(a_a, c_a)),
+      node_c,
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        node_a,
+        node_b)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DpHypTest, HyperEdgeConnectsSubgraphs) {
+  // C is only connected via the hyperedge "a + b = c". DpCcp does not find a plan for this JoinGraph.
+  const auto hyper_edge_predicate = equals_(add_(a_a, b_a), c_a);
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b111}, expression_vector(hyper_edge_predicate)};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_b_c}));
+
+  EXPECT_THROW(DpCcp{}(join_graph, create_cost_estimator(join_graph)), std::logic_error);  // NOLINT
+
+  const auto actual_lqp = DpHyp{}(join_graph, create_cost_estimator(join_graph));  // NOLINT
+
+  // The hyperedge predicate cannot be executed by a join operator and is placed on top of a cross join.
+  ASSERT_EQ(actual_lqp->type, LQPNodeType::Predicate);
+  EXPECT_EQ(*static_cast<const PredicateNode&>(*actual_lqp).predicate(), *hyper_edge_predicate);
+
+  const auto cross_join_node = std::dynamic_pointer_cast<JoinNode>(actual_lqp->left_input());
+  ASSERT_TRUE(cross_join_node);
+  EXPECT_EQ(cross_join_node->join_mode, JoinMode::Cross);
+  EXPECT_TRUE(cross_join_node->left_input() == node_c || cross_join_node->right_input() == node_c);
+  EXPECT_EQ(count_nodes(actual_lqp, LQPNodeType::Join), 2);
+}
+
+TEST_F(DpHypTest, BudgetedSearch) {
+  // With a budget too small for an exhaustive search, DpHyp collapses partial plans (IDP). The result joins all
+  // vertices and is at most as good as the optimal plan.
+  const auto join_graph = create_join_graph(8, false);
+
+  const auto optimal_cost_estimator = create_cost_estimator(join_graph);
+  const auto optimal_lqp = DpHyp{}(join_graph, optimal_cost_estimator);  // NOLINT
+
+  const auto budgeted_cost_estimator = create_cost_estimator(join_graph);
+  const auto budgeted_lqp = DpHyp{20}(join_graph, budgeted_cost_estimator);  // NOLINT
+
+  for (const auto& lqp : {optimal_lqp, budgeted_lqp}) {
+    EXPECT_EQ(count_nodes(lqp, LQPNodeType::Mock), 8);
+    EXPECT_EQ(count_nodes(lqp, LQPNodeType::Join), 7);
+    EXPECT_EQ(count_nodes(lqp, LQPNodeType::Predicate), 0);
+  }
+
+  const auto cost_estimator = create_cost_estimator(join_graph);
+  EXPECT_LE(cost_estimator->estimate_plan_cost(optimal_lqp), cost_estimator->estimate_plan_cost(budgeted_lqp));
+}
+
+TEST_F(DpHypTest, ParallelSearch) {
+  // The clique has enough CsgCmpPairs per vertex set size to be split into several jobs.
+  const auto join_graph = create_join_graph(8, true);
+
+  const auto sequential_lqp = DpHyp{}(join_graph, create_cost_estimator(join_graph));  // NOLINT
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto parallel_lqp = DpHyp{}(join_graph, create_cost_estimator(join_graph));  // NOLINT
+
+  EXPECT_EQ(count_nodes(parallel_lqp, LQPNodeType::Mock), 8);
+  EXPECT_EQ(count_nodes(parallel_lqp, LQPNodeType::Join), 7);
+
+  const auto cost_estimator = create_cost_estimator(join_graph);
+  EXPECT_FLOAT_EQ(cost_estimator->estimate_plan_cost(parallel_lqp), cost_estimator->estimate_plan_cost(sequential_lqp));
+}
+
+}  // namespace hyrise
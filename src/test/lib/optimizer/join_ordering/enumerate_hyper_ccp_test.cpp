@@ -0,0 +1,120 @@
+#include <set>
+
+#include "base_test.hpp"
+
+#include "optimizer/join_ordering/enumerate_ccp.hpp"
+#include "optimizer/join_ordering/enumerate_hyper_ccp.hpp"
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace hyrise;  // NOLINT
+
+bool equals(const std::pair<boost::dynamic_bitset<>, boost::dynamic_bitset<>>& lhs,
+            const std::pair<unsigned long, unsigned long>& rhs) {  // NOLINT - doesn't like unsigned long
+  Assert(lhs.first.size() == lhs.second.size() && lhs.first.size() <= sizeof(unsigned long) * 8,  // NOLINT
+         "Bitset has too many bits for comparison");
+  return lhs.first.to_ulong() == rhs.first && lhs.second.to_ulong() == rhs.second;
+}
+
+std::vector<JoinGraphVertexSet> to_vertex_sets(const size_t vertex_count,
+                                               const std::vector<std::pair<size_t, size_t>>& edges) {
+  auto vertex_sets = std::vector<JoinGraphVertexSet>{};
+  for (const auto& [first_vertex_idx, second_vertex_idx] : edges) {
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    vertex_set.set(first_vertex_idx);
+    vertex_set.set(second_vertex_idx);
+    vertex_sets.emplace_back(vertex_set);
+  }
+  return vertex_sets;
+}
+
+}  // namespace
+
+namespace hyrise {
+
+class EnumerateHyperCcpTest : public BaseTest {};
+
+TEST_F(EnumerateHyperCcpTest, SimpleGraphsAsEnumerateCcp) {
+  // Without hyperedges, the same CsgCmpPairs as by EnumerateCcp are enumerated.
+  const auto graphs = std::vector<std::pair<size_t, std::vector<std::pair<size_t, size_t>>>>{
+      {4, {{0, 1}, {1, 2}, {2, 3}}},
+      {3, {{0, 1}, {1, 2}, {2, 0}}},
+      {4, {{0, 1}, {0, 2}, {0, 3}}},
+      {4, {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {2, 3}, {1, 3}}},
+      {5, {{0, 2}, {0, 1}, {1, 3}, {2, 1}}}};
+
+  for (const auto& [vertex_count, edges] : graphs) {
+    const auto expected_pairs = EnumerateCcp{vertex_count, edges}();  // NOLINT - {}()
+    const auto pairs = EnumerateHyperCcp{vertex_count, to_vertex_sets(vertex_count, edges)}();  // NOLINT - {}()
+    ASSERT_TRUE(pairs);
+
+    EXPECT_EQ(std::set<CsgCmpPair>(pairs->begin(), pairs->end()),
+              std::set<CsgCmpPair>(expected_pairs.begin(), expected_pairs.end()));
+    EXPECT_EQ(pairs->size(), expected_pairs.size());
+  }
+}
+
+TEST_F(EnumerateHyperCcpTest, HyperEdge) {
+  // Vertex 2 is only connected via the hyperedge {0, 1, 2}.
+  const auto edges = std::vector<JoinGraphVertexSet>{JoinGraphVertexSet{3, 0b011}, JoinGraphVertexSet{3, 0b111}};
+
+  const auto pairs = EnumerateHyperCcp{3, edges}();  // NOLINT - {}()
+  ASSERT_TRUE(pairs);
+  ASSERT_EQ(pairs->size(), 2u);
+
+  EXPECT_TRUE(equals(pairs->at(0), std::make_pair(0b001ul, 0b010ul)));
+  EXPECT_TRUE(equals(pairs->at(1), std::make_pair(0b011ul, 0b100ul)));
+}
+
+TEST_F(EnumerateHyperCcpTest, HyperEdgeBetweenSubgraphs) {
+  // {0, 1} and {2, 3} are only connected via the hyperedge {0, 1, 2, 3}, so they can only be joined as a whole.
+  const auto edges = std::vector<JoinGraphVertexSet>{JoinGraphVertexSet{4, 0b0011}, JoinGraphVertexSet{4, 0b1100},
+                                                     JoinGraphVertexSet{4, 0b1111}};
+
+  const auto pairs = EnumerateHyperCcp{4, edges}();  // NOLINT - {}()
+  ASSERT_TRUE(pairs);
+  ASSERT_EQ(pairs->size(), 3u);
+
+  EXPECT_TRUE(equals(pairs->at(0), std::make_pair(0b0100ul, 0b1000ul)));
+  EXPECT_TRUE(equals(pairs->at(1), std::make_pair(0b0001ul, 0b0010ul)));
+  EXPECT_TRUE(equals(pairs->at(2), std::make_pair(0b0011ul, 0b1100ul)));
+}
+
+TEST_F(EnumerateHyperCcpTest, DisconnectedHyperEdge) {
+  // Neither {1, 2} nor any other pair of vertices is connected, so the hyperedge cannot be used.
+  const auto edges = std::vector<JoinGraphVertexSet>{JoinGraphVertexSet{3, 0b111}};
+
+  const auto pairs = EnumerateHyperCcp{3, edges}();  // NOLINT - {}()
+  ASSERT_TRUE(pairs);
+  EXPECT_TRUE(pairs->empty());
+}
+
+TEST_F(EnumerateHyperCcpTest, Budget) {
+  // The star with four vertices has 12 CsgCmpPairs (see EnumerateCcpTest).
+  const auto edges = to_vertex_sets(4, {{0, 1}, {0, 2}, {0, 3}});
+
+  EXPECT_TRUE(EnumerateHyperCcp(4, edges, 12)());
+  EXPECT_FALSE(EnumerateHyperCcp(4, edges, 11)());
+}
+
+TEST_F(EnumerateHyperCcpTest, MaxVertexSetSize) {
+  const auto edges = to_vertex_sets(4, {{0, 1}, {0, 2}, {0, 3}});
+
+  const auto binary_pairs = EnumerateHyperCcp(4, edges, std::numeric_limits<size_t>::max(), 2)();
+  ASSERT_TRUE(binary_pairs);
+  EXPECT_EQ(binary_pairs->size(), 3u);
+
+  const auto ternary_pairs = EnumerateHyperCcp(4, edges, std::numeric_limits<size_t>::max(), 3)();
+  ASSERT_TRUE(ternary_pairs);
+  ASSERT_EQ(ternary_pairs->size(), 9u);
+  for (const auto& [csg, cmp] : *ternary_pairs) {
+    EXPECT_LE((csg | cmp).count(), 3u);
+  }
+
+  // Pairs exceeding the size limit do not count towards the budget.
+  EXPECT_TRUE(EnumerateHyperCcp(4, edges, 9, 3)());
+}
+
+}  // namespace hyrise
@@ -0,0 +1,182 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "lib/optimizer/strategy/strategy_base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/index_join_rule.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace hyrise {
+
+using namespace expression_functional;  // NOLINT(build/namespaces)
+
+class IndexJoinRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // Two chunks of two rows. The table index on column b covers the first chunk only, the second chunk is probed
+    // using the fallback of the JoinIndex.
+    table = load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{2});
+    Hyrise::get().storage_manager.add_table("a", table);
+    table->create_partial_hash_index(ColumnID{1}, {ChunkID{0}});
+
+    rule = std::make_shared<IndexJoinRule>();
+
+    stored_table_node = StoredTableNode::make("a");
+    a = stored_table_node->get_column("a");
+    b = stored_table_node->get_column("b");
+  }
+
+  void generate_mock_statistics(float row_count) {
+    const auto table_statistics = table->table_statistics();
+    table_statistics->row_count = row_count;
+
+    for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+      table_statistics->column_statistics.at(column_id)->set_statistics_object(
+          GenericHistogram<int32_t>::with_single_bin(0, 20'000, row_count, 10'000));
+    }
+  }
+
+  static std::shared_ptr<MockNode> create_probe_node(size_t row_count) {
+    return create_mock_node_with_statistics(
+        {{DataType::Int, "x"}}, row_count,
+        {GenericHistogram<int32_t>::with_single_bin(0, 20'000, static_cast<float>(row_count), 100)});
+  }
+
+  std::shared_ptr<IndexJoinRule> rule;
+  std::shared_ptr<StoredTableNode> stored_table_node;
+  std::shared_ptr<Table> table;
+  std::shared_ptr<LQPColumnExpression> a, b;
+};
+
+TEST_F(IndexJoinRuleTest, IndexJoinWithIndexOnRightInput) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Semi}) {
+    const auto join_node = JoinNode::make(join_mode, equals_(x, b), probe_node, stored_table_node);
+    StrategyBaseTest::apply_rule(rule, join_node);
+    ASSERT_TRUE(join_node->index_side);
+    EXPECT_EQ(*join_node->index_side, LQPInputSide::Right);
+  }
+}
+
+TEST_F(IndexJoinRuleTest, IndexJoinWithIndexOnLeftInput) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+
+  // The operands of the predicate are not in the order of the inputs.
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, b), stored_table_node, probe_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  ASSERT_TRUE(join_node->index_side);
+  EXPECT_EQ(*join_node->index_side, LQPInputSide::Left);
+
+  // Semi joins only emit tuples of the left input, so only the right input can be used as index side.
+  const auto semi_join_node = JoinNode::make(JoinMode::Semi, equals_(b, x), stored_table_node, probe_node);
+  StrategyBaseTest::apply_rule(rule, semi_join_node);
+  EXPECT_FALSE(semi_join_node->index_side);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinWithoutIndex) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, a), probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_FALSE(join_node->index_side);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinForUnsupportedPredicates) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+
+  const auto non_equals_join_node = JoinNode::make(JoinMode::Inner, less_than_(x, b), probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, non_equals_join_node);
+  EXPECT_FALSE(non_equals_join_node->index_side);
+
+  const auto multi_predicate_join_node = JoinNode::make(
+      JoinMode::Inner, expression_vector(equals_(x, b), equals_(x, a)), probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, multi_predicate_join_node);
+  EXPECT_FALSE(multi_predicate_join_node->index_side);
+
+  const auto anti_join_node = JoinNode::make(JoinMode::AntiNullAsTrue, equals_(x, b), probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, anti_join_node);
+  EXPECT_FALSE(anti_join_node->index_side);
+}
+
+TEST_F(IndexJoinRuleTest, NoIndexJoinForLargeInputs) {
+  // The indexed table is too small.
+  generate_mock_statistics(1'000);
+  const auto small_probe_node = create_probe_node(5);
+  const auto small_x = small_probe_node->get_column("x");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(small_x, b), small_probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  EXPECT_FALSE(join_node->index_side);
+
+  // The probe input is too large compared to the indexed table.
+  generate_mock_statistics(1'000'000);
+  const auto large_probe_node = create_probe_node(100'000);
+  const auto large_x = large_probe_node->get_column("x");
+
+  const auto other_join_node =
+      JoinNode::make(JoinMode::Inner, equals_(large_x, b), large_probe_node, stored_table_node);
+  StrategyBaseTest::apply_rule(rule, other_join_node);
+  EXPECT_FALSE(other_join_node->index_side);
+}
+
+TEST_F(IndexJoinRuleTest, IndexJoinWithValidatedIndexInput) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+  const auto validate_node = ValidateNode::make(stored_table_node);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(x, b), probe_node, validate_node);
+  StrategyBaseTest::apply_rule(rule, join_node);
+  ASSERT_TRUE(join_node->index_side);
+  EXPECT_EQ(*join_node->index_side, LQPInputSide::Right);
+
+  // The JoinIndex does not support Semi joins with a reference table on the index side.
+  const auto semi_join_node = JoinNode::make(JoinMode::Semi, equals_(x, b), probe_node, validate_node);
+  StrategyBaseTest::apply_rule(rule, semi_join_node);
+  EXPECT_FALSE(semi_join_node->index_side);
+}
+
+TEST_F(IndexJoinRuleTest, IndexJoinRemovesSemiJoinReductionOfIndexInput) {
+  generate_mock_statistics(1'000'000);
+  const auto probe_node = create_probe_node(100);
+  const auto x = probe_node->get_column("x");
+  const auto validate_node = ValidateNode::make(stored_table_node);
+
+  // clang-format off
+  const auto semi_join_reduction =
+  JoinNode::make(JoinMode::Semi, equals_(b, x),
+    validate_node,
+    probe_node);
+
+  const auto join_node =
+  JoinNode::make(JoinMode::Inner, equals_(x, b),
+    probe_node,
+    semi_join_reduction);
+  // clang-format on
+
+  semi_join_reduction->mark_as_semi_reduction(join_node);
+
+  StrategyBaseTest::apply_rule(rule, join_node);
+  ASSERT_TRUE(join_node->index_side);
+  EXPECT_EQ(*join_node->index_side, LQPInputSide::Right);
+  EXPECT_EQ(join_node->right_input(), validate_node);
+}
+
+}  // namespace hyrise
@@ -14,14 +14,18 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/key_hash/key_hash_index.hpp"
 
 namespace hyrise {
 
@@ -121,17 +125,50 @@ TEST_F(IndexScanRuleTest, NoIndexScanWithHighSelectivity) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
 }
 
-TEST_F(IndexScanRuleTest, NoIndexScanIfNotGroupKey) {
+TEST_F(IndexScanRuleTest, IndexScanWithAdaptiveRadixTreeIndex) {
   table->create_chunk_index<AdaptiveRadixTreeIndex>({ColumnID{2}});
 
   generate_mock_statistics(1'000'000);
 
-  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 10));
+  auto predicate_node_0 = PredicateNode::make(between_inclusive_(c, 19'900, 19'950));
   predicate_node_0->set_left_input(stored_table_node);
 
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
   auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanWithBTreeIndex) {
+  table->create_chunk_index<BTreeIndex>({ColumnID{2}});
+
+  generate_mock_statistics(1'000'000);
+
+  auto predicate_node_0 = PredicateNode::make(less_than_(c, 100));
+  predicate_node_0->set_left_input(stored_table_node);
+
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexScanOnSortedChunks) {
+  // All values of column b are 10, so the chunk is sorted by it.
+  table->create_chunk_index<GroupKeyIndex>({ColumnID{1}});
+
+  generate_mock_statistics(1'000'000);
+
+  auto predicate_node_0 = PredicateNode::make(equals_(b, 25));
+  predicate_node_0->set_left_input(stored_table_node);
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  // The TableScan uses a binary search on sorted segments, which is on par with the index lookup.
+  table->get_chunk(ChunkID{0})->set_individually_sorted_by(SortColumnDefinition{ColumnID{1}});
+
+  auto predicate_node_1 = PredicateNode::make(equals_(b, 25));
+  predicate_node_1->set_left_input(stored_table_node);
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
 TEST_F(IndexScanRuleTest, IndexScanWithIndex) {
@@ -177,4 +214,50 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, KeyIndexLookupForKeyPredicates) {
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY};
+  table->add_soft_key_constraint(key_constraint);
+  table->create_key_hash_index(key_constraint);
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(greater_than_(b, 5),
+    PredicateNode::make(equals_(1, c),
+      ValidateNode::make(
+        PredicateNode::make(equals_(a, 2),
+          stored_table_node))));
+
+  const auto key_index_lookup_node = PredicateNode::make(and_(equals_(a, 2), equals_(1, c)), stored_table_node);
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(b, 5),
+    ValidateNode::make(
+      key_index_lookup_node));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  const auto& actual_key_index_lookup_node = static_cast<PredicateNode&>(*actual_lqp->left_input()->left_input());
+  EXPECT_EQ(actual_key_index_lookup_node.scan_type, ScanType::KeyIndexLookup);
+  EXPECT_EQ(static_cast<PredicateNode&>(*actual_lqp).scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, NoKeyIndexLookupForPartialKey) {
+  const auto key_constraint = TableKeyConstraint{{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY};
+  table->add_soft_key_constraint(key_constraint);
+  table->create_key_hash_index(key_constraint);
+
+  // The predicate on c is above a node with two outputs. Thus, the predicates cannot be combined without affecting the
+  // other output.
+  const auto predicate_node_a = PredicateNode::make(equals_(a, 2), stored_table_node);
+  const auto predicate_node_c = PredicateNode::make(equals_(c, 1), predicate_node_a);
+  const auto input_lqp = UnionNode::make(SetOperationMode::All, predicate_node_c, predicate_node_a);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_EQ(actual_lqp->left_input(), predicate_node_c);
+  EXPECT_EQ(predicate_node_c->left_input(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->scan_type, ScanType::TableScan);
+  EXPECT_EQ(predicate_node_c->scan_type, ScanType::TableScan);
+}
+
 }  // namespace hyrise
@@ -33,10 +33,16 @@ class SemiJoinReductionRuleTest : public StrategyBaseTest {
       _node_c = create_mock_node_with_statistics({{DataType::Int, "a"}}, 40, {histogram_column_a});
       _c_a = _node_c->get_column("a");
     }
+
+    {
+      const auto histogram_column_a = GenericHistogram<int32_t>::with_single_bin(1, 25, 20, 20);
+      _node_d = create_mock_node_with_statistics({{DataType::Int, "a"}}, 20, {histogram_column_a});
+      _d_a = _node_d->get_column("a");
+    }
   }
 
-  std::shared_ptr<MockNode> _node_a, _node_b, _node_c;
-  std::shared_ptr<LQPColumnExpression> _a_a, _a_b, _b_a, _b_b, _c_a;
+  std::shared_ptr<MockNode> _node_a, _node_b, _node_c, _node_d;
+  std::shared_ptr<LQPColumnExpression> _a_a, _a_b, _b_a, _b_b, _c_a, _d_a;
   std::shared_ptr<SemiJoinReductionRule> _rule{std::make_shared<SemiJoinReductionRule>()};
 };
 
@@ -72,6 +78,37 @@ TEST_F(SemiJoinReductionRuleTest, CreateSimpleReduction) {
   EXPECT_EQ(join_node->get_or_find_reduced_join_node(), std::static_pointer_cast<JoinNode>(actual_lqp));
 }
 
+TEST_F(SemiJoinReductionRuleTest, CreateRuntimeFilterReduction) {
+  // The _a_a side of the inner join has values from 1-50, the _d_a side has values from 1-25. About half of the tuples
+  // of _node_a are expected to find a join partner. This is not enough for a semi join, but for a runtime filter.
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(_a_a, _d_a),
+    _node_a,
+    _node_d);
+
+  const auto expected_reduction =
+  JoinNode::make(JoinMode::Semi, equals_(_a_a, _d_a),
+    _node_a,
+    _node_d);
+
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Inner, equals_(_a_a, _d_a),
+    expected_reduction,
+    _node_d);
+  // clang-format on
+  expected_reduction->mark_as_semi_reduction(expected_lqp);
+  expected_reduction->use_runtime_filter = true;
+
+  auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  const auto join_node = std::static_pointer_cast<JoinNode>(actual_lqp->left_input());
+  EXPECT_TRUE(join_node->is_semi_reduction());
+  EXPECT_TRUE(join_node->use_runtime_filter);
+}
+
 TEST_F(SemiJoinReductionRuleTest, CreateSimpleReductionRightSide) {
   // Same as CreateSimpleReduction, but with reversed sides
 
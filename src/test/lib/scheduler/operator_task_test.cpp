@@ -12,9 +12,11 @@
 #include "operators/aggregate_hash.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/limit.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
@@ -115,6 +117,46 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   }
 }
 
+TEST_F(OperatorTaskTest, PushDownRowLimit) {
+  const auto table = load_table("resources/test_data/tbl/int_int3.tbl", ChunkOffset{3});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_(a, 3));
+  table_scan->never_clear_output();
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(a));
+  const auto limit = std::make_shared<Limit>(projection, value_(int64_t{3}));
+
+  const auto& [tasks, _] = OperatorTask::make_tasks_from_operator(limit);
+  EXPECT_EQ(projection->row_limit(), size_t{3});
+  EXPECT_EQ(table_scan->row_limit(), size_t{3});
+  EXPECT_FALSE(table_wrapper->row_limit());
+  EXPECT_FALSE(limit->row_limit());
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+
+  // The first chunk has two matches, the second one three. The third chunk is not scanned.
+  EXPECT_EQ(table_scan->get_output()->chunk_count(), 2);
+  EXPECT_EQ(table_scan->get_output()->row_count(), 5);
+
+  const auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                       TableType::Data);
+  expected_result->append({4});
+  expected_result->append({13});
+  expected_result->append({6});
+  EXPECT_TABLE_EQ_ORDERED(limit->get_output(), expected_result);
+}
+
+TEST_F(OperatorTaskTest, NoRowLimitForOperatorsWithMultipleConsumers) {
+  const auto gt = std::make_shared<GetTable>("table_a");
+  const auto a = PQPColumnExpression::from_table(*_test_table_a, "a");
+  const auto table_scan = std::make_shared<TableScan>(gt, greater_than_(a, 3));
+  const auto limit = std::make_shared<Limit>(table_scan, value_(int64_t{1}));
+  const auto union_all = std::make_shared<UnionAll>(limit, table_scan);
+
+  OperatorTask::make_tasks_from_operator(union_all);
+  EXPECT_FALSE(table_scan->row_limit());
+}
+
 TEST_F(OperatorTaskTest, UncorrelatedSubqueries) {
   // Uncorrelated subqueries in the predicates of TableScan and Projection operators should be wrapped in tasks
   // together with the rest of the PQP. Thus, the subqueries are scheduled accordingly and not created and executed
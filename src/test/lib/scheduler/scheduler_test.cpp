@@ -299,6 +299,36 @@ TEST_F(SchedulerTest, TaskToNodeAssignment) {
   EXPECT_EQ(node_queue_scheduler->workers()[1]->num_finished_tasks(), 1);
 }
 
+TEST_F(SchedulerTest, TaskToPreferredNodeAssignment) {
+  if (std::thread::hardware_concurrency() < 2) {
+    GTEST_SKIP();
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(2, 1);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  const auto task_1 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+  const auto task_2 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+  const auto task_3 = std::make_shared<JobTask>([&]() {}, SchedulePriority::Default, false);
+
+  task_1->set_preferred_node_id(NodeID{1});
+  task_2->set_preferred_node_id(NodeID{1});
+  EXPECT_EQ(task_1->preferred_node_id(), NodeID{1});
+  EXPECT_EQ(task_3->preferred_node_id(), CURRENT_NODE_ID);
+
+  // Tasks scheduled without an explicit node are scheduled on their preferred node. An explicitly passed node takes
+  // precedence.
+  task_1->schedule();
+  task_2->schedule(NodeID{0});
+  task_3->schedule(NodeID{0});
+
+  node_queue_scheduler->wait_for_all_tasks();
+
+  EXPECT_EQ(node_queue_scheduler->workers()[0]->num_finished_tasks(), 2);
+  EXPECT_EQ(node_queue_scheduler->workers()[1]->num_finished_tasks(), 1);
+}
+
 TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().topology.use_default_topology(1);
   Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
@@ -329,6 +359,10 @@ TEST_F(SchedulerTest, DetermineQueueIDForTask) {
 
   EXPECT_EQ(node_queue_scheduler->determine_queue_id(NodeID{1}), NodeID{1});
 
+  // Preferred nodes that do not exist in the current topology (e.g., stemming from a chunk placement with a different
+  // topology) are ignored.
+  EXPECT_EQ(node_queue_scheduler->determine_queue_id(NodeID{2}), NodeID{0});
+
   // For the case of no load on node ID 0 (which is the case here), tasks are always scheduled on this node.
   EXPECT_EQ(node_queue_scheduler->determine_queue_id(CURRENT_NODE_ID), NodeID{0});
 
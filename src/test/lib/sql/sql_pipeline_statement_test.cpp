@@ -9,7 +9,9 @@
 
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "memory/arena_memory_resource.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
@@ -430,6 +432,27 @@ TEST_F(SQLPipelineStatementTest, GetQueryPlanWithCustomTransactionContext) {
   EXPECT_EQ(plan->transaction_context(), context);
 }
 
+TEST_F(SQLPipelineStatementTest, GetQueryPlanWithMemoryResource) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  const auto& plan = statement->get_physical_plan();
+
+  // All operators of the plan share the statement's arena.
+  const auto* const memory_resource = plan->memory_resource();
+  EXPECT_TRUE(dynamic_cast<const ArenaMemoryResource*>(memory_resource));
+  visit_pqp(plan, [&](const auto& op) {
+    EXPECT_EQ(op->memory_resource(), memory_resource);
+    return PQPVisitation::VisitInputs;
+  });
+
+  // Copies of the plan, e.g., from the plan cache, do not use the arena.
+  EXPECT_EQ(plan->deep_copy()->memory_resource(), boost::container::pmr::get_default_resource());
+
+  const auto [pipeline_status, table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTasks) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline();
   auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
@@ -1,6 +1,8 @@
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -10,6 +12,8 @@
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "operators/abstract_join_operator.hpp"
+#include "operators/join_index.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
@@ -401,6 +405,36 @@ TEST_F(SQLPipelineTest, GetResultTableWithScheduler) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineTest, GetResultTableWithPipelinedExecution) {
+  const auto sql = "SELECT a, b + 1 AS c FROM table_a WHERE a > 1000 AND b < 458";
+  auto expected_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+  const auto [expected_status, expected_table] = expected_pipeline.get_result_table();
+  EXPECT_EQ(expected_status, SQLPipelineStatus::Success);
+
+  auto sql_pipeline = SQLPipelineBuilder{sql}
+                          .with_pipelined_execution(UsePipelinedExecution::Yes)
+                          .with_pqp_cache(_pqp_cache)
+                          .create_pipeline();
+  const auto& [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(table, expected_table);
+
+  const auto count_pipelines = [](const auto& pqp) {
+    auto pipeline_count = size_t{0};
+    visit_pqp(pqp, [&](const auto& op) {
+      pipeline_count += op->type() == OperatorType::MorselPipeline ? 1 : 0;
+      return PQPVisitation::VisitInputs;
+    });
+    return pipeline_count;
+  };
+
+  // The executed plan contains pipelines, the cached one does not.
+  EXPECT_GT(count_pipelines(sql_pipeline.get_physical_plans().at(0)), 0);
+  const auto cached_plan = _pqp_cache->try_get(sql);
+  ASSERT_TRUE(cached_plan);
+  EXPECT_EQ(count_pipelines(*cached_plan), 0);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   auto sql = "SELECT a + not_a_column FROM table_a";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
@@ -695,4 +729,47 @@ TEST_F(SQLPipelineTest, GetResultTableNoReexecuteOnConflict) {
   EXPECT_EQ(_table_a->row_count(), 5);
 }
 
+TEST_F(SQLPipelineTest, IndexJoinOnValidatedTable) {
+  // Under MVCC, the stored tables are read through a Validate. The IndexJoinRule still chooses the index join if the
+  // table index covers all immutable chunks of the large table.
+  const auto indexed_table = std::make_shared<Table>(TableColumnDefinitions{{"v", DataType::Int, false}},
+                                                     TableType::Data, ChunkOffset{1'000}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 20'000; ++value) {
+    indexed_table->append({value});
+  }
+  auto indexed_chunk_ids = std::vector<ChunkID>(19);
+  std::iota(indexed_chunk_ids.begin(), indexed_chunk_ids.end(), ChunkID{0});
+  indexed_table->create_partial_hash_index(ColumnID{0}, indexed_chunk_ids);
+  Hyrise::get().storage_manager.add_table("indexed", indexed_table);
+
+  const auto probe_table = std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int, false}},
+                                                   TableType::Data, std::nullopt, UseMvcc::Yes);
+  for (const auto value : {5, 1'500, 19'999, 30'000}) {
+    probe_table->append({value});
+  }
+  Hyrise::get().storage_manager.add_table("probe", probe_table);
+
+  auto delete_pipeline = SQLPipelineBuilder{"DELETE FROM indexed WHERE v = 1500"}.create_pipeline();
+  EXPECT_EQ(delete_pipeline.get_result_table().first, SQLPipelineStatus::Success);
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT x, v FROM probe, indexed WHERE x = v"}.create_pipeline();
+  const auto [pipeline_status, table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  ASSERT_TRUE(table);
+  EXPECT_EQ(table->row_count(), 2);
+
+  auto index_joins = std::vector<std::shared_ptr<const JoinIndex>>{};
+  visit_pqp(sql_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    if (const auto join_index = std::dynamic_pointer_cast<const JoinIndex>(op)) {
+      index_joins.emplace_back(join_index);
+    }
+    return PQPVisitation::VisitInputs;
+  });
+  ASSERT_EQ(index_joins.size(), 1);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*index_joins.front()->performance_data);
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 19);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 1);
+}
+
 }  // namespace hyrise
@@ -0,0 +1,70 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_grouped_positions.hpp"
+#include "storage/pos_lists/entire_chunk_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace hyrise {
+
+class ChunkGroupedPositionsTest : public BaseTest {};
+
+TEST_F(ChunkGroupedPositionsTest, GroupsPositionsByChunkID) {
+  const auto pos_list = std::make_shared<RowIDPosList>(std::initializer_list<RowID>{
+      RowID{ChunkID{2}, ChunkOffset{3}}, RowID{ChunkID{0}, ChunkOffset{2}}, NULL_ROW_ID,
+      RowID{ChunkID{2}, ChunkOffset{2}}, RowID{ChunkID{0}, ChunkOffset{4}}, RowID{ChunkID{2}, ChunkOffset{0}}});
+
+  const auto grouped_positions = group_positions_by_chunk_id(pos_list, 3);
+
+  // Chunk 1 is not referenced and does not get a run. The ChunkOffsets of chunk 2 are sorted.
+  EXPECT_EQ(grouped_positions.chunk_ids, (std::vector<ChunkID>{ChunkID{0}, ChunkID{2}}));
+  EXPECT_EQ(grouped_positions.run_ends, (std::vector<ChunkOffset>{ChunkOffset{2}, ChunkOffset{5}}));
+  EXPECT_EQ(grouped_positions.run_begin(0), ChunkOffset{0});
+  EXPECT_EQ(grouped_positions.run_begin(1), ChunkOffset{2});
+  EXPECT_EQ(grouped_positions.chunk_offsets, (std::vector<ChunkOffset>{ChunkOffset{2}, ChunkOffset{4}, ChunkOffset{0},
+                                                                       ChunkOffset{2}, ChunkOffset{3}}));
+  EXPECT_EQ(grouped_positions.original_positions, (std::vector<ChunkOffset>{ChunkOffset{1}, ChunkOffset{4},
+                                                                            ChunkOffset{5}, ChunkOffset{3},
+                                                                            ChunkOffset{0}}));
+  EXPECT_EQ(grouped_positions.null_positions, (std::vector<ChunkOffset>{ChunkOffset{2}}));
+}
+
+TEST_F(ChunkGroupedPositionsTest, EntireChunkPosList) {
+  const auto pos_list = std::make_shared<EntireChunkPosList>(ChunkID{1}, ChunkOffset{3});
+
+  const auto grouped_positions = group_positions_by_chunk_id(pos_list, 2);
+
+  EXPECT_EQ(grouped_positions.chunk_ids, (std::vector<ChunkID>{ChunkID{1}}));
+  EXPECT_EQ(grouped_positions.run_ends, (std::vector<ChunkOffset>{ChunkOffset{3}}));
+  EXPECT_EQ(grouped_positions.chunk_offsets,
+            (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}}));
+  EXPECT_EQ(grouped_positions.original_positions,
+            (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}}));
+  EXPECT_TRUE(grouped_positions.null_positions.empty());
+}
+
+TEST_F(ChunkGroupedPositionsTest, EmptyPosList) {
+  const auto grouped_positions = group_positions_by_chunk_id(std::make_shared<RowIDPosList>(), 2);
+
+  EXPECT_TRUE(grouped_positions.chunk_ids.empty());
+  EXPECT_TRUE(grouped_positions.run_ends.empty());
+  EXPECT_TRUE(grouped_positions.chunk_offsets.empty());
+  EXPECT_TRUE(grouped_positions.original_positions.empty());
+  EXPECT_TRUE(grouped_positions.null_positions.empty());
+}
+
+TEST_F(ChunkGroupedPositionsTest, MemoryUsage) {
+  const auto pos_list = std::make_shared<RowIDPosList>(
+      std::initializer_list<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{0}}});
+
+  const auto grouped_positions = group_positions_by_chunk_id(pos_list, 1);
+
+  // One ChunkID and one run end for the single run, a ChunkOffset and an original position for each position.
+  EXPECT_GE(grouped_positions.memory_usage(),
+            sizeof(ChunkGroupedPositions) + sizeof(ChunkID) + 5 * sizeof(ChunkOffset));
+  EXPECT_LT(grouped_positions.memory_usage(), sizeof(ChunkGroupedPositions) + pos_list->size() * sizeof(RowID) * 4);
+}
+
+}  // namespace hyrise
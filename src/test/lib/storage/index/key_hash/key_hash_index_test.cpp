@@ -0,0 +1,109 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "storage/index/key_hash/key_hash_index.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class KeyHashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Float, false}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table->append({1, pmr_string{"x"}, 1.0f});
+    table->append({2, pmr_string{"y"}, 2.0f});
+    table->append({3, NULL_VALUE, 3.0f});
+    table->append({1, pmr_string{"y"}, 4.0f});
+    table->append({2, pmr_string{"y"}, 5.0f});
+
+    key_constraint = std::make_unique<TableKeyConstraint>(std::set<ColumnID>{ColumnID{1}, ColumnID{0}},
+                                                          KeyConstraintType::UNIQUE);
+  }
+
+  std::shared_ptr<Table> table;
+  std::unique_ptr<TableKeyConstraint> key_constraint;
+};
+
+TEST_F(KeyHashIndexTest, ColumnIDs) {
+  const auto index = KeyHashIndex{*table, *key_constraint};
+  EXPECT_EQ(index.column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+}
+
+TEST_F(KeyHashIndexTest, Lookup) {
+  const auto index = KeyHashIndex{*table, *key_constraint};
+
+  EXPECT_EQ(index.lookup(*table, {1, pmr_string{"x"}}), RowIDPosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_EQ(index.lookup(*table, {1, pmr_string{"y"}}), RowIDPosList({RowID{ChunkID{1}, ChunkOffset{1}}}));
+  EXPECT_EQ(index.lookup(*table, {2, pmr_string{"y"}}),
+            RowIDPosList({RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{2}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index.lookup(*table, {3, pmr_string{"x"}}).empty());
+
+  // Values are losslessly casted to the column's data type.
+  EXPECT_EQ(index.lookup(*table, {int64_t{1}, pmr_string{"x"}}), RowIDPosList({RowID{ChunkID{0}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index.lookup(*table, {1.5f, pmr_string{"x"}}).empty());
+}
+
+TEST_F(KeyHashIndexTest, NullValues) {
+  const auto index = KeyHashIndex{*table, *key_constraint};
+
+  // Rows with NULL key values are not indexed and NULL never matches.
+  EXPECT_TRUE(index.lookup(*table, {3, NULL_VALUE}).empty());
+  EXPECT_TRUE(index.lookup(*table, {NULL_VALUE, pmr_string{"x"}}).empty());
+}
+
+TEST_F(KeyHashIndexTest, InsertRows) {
+  auto index = KeyHashIndex{*table, *key_constraint};
+
+  // The last chunk is mutable and has space for another row, which is only found after it was inserted.
+  table->append({4, pmr_string{"z"}, 6.0f});
+  EXPECT_TRUE(index.lookup(*table, {4, pmr_string{"z"}}).empty());
+
+  index.insert(*table->get_chunk(ChunkID{2}), ChunkID{2}, ChunkOffset{1}, ChunkOffset{2});
+  EXPECT_EQ(index.lookup(*table, {4, pmr_string{"z"}}), RowIDPosList({RowID{ChunkID{2}, ChunkOffset{1}}}));
+  EXPECT_GT(index.estimate_memory_usage(), 0);
+}
+
+TEST_F(KeyHashIndexTest, HasDuplicates) {
+  const auto index = KeyHashIndex{*table, *key_constraint};
+
+  EXPECT_FALSE(index.has_duplicates(*table, ChunkID{0}, ChunkOffset{0}, ChunkOffset{1}, TransactionID{0}));
+  EXPECT_TRUE(index.has_duplicates(*table, ChunkID{0}, ChunkOffset{0}, ChunkOffset{2}, TransactionID{0}));
+  EXPECT_TRUE(index.has_duplicates(*table, ChunkID{2}, ChunkOffset{0}, ChunkOffset{1}, TransactionID{0}));
+
+  // NULL keys never conflict.
+  EXPECT_FALSE(index.has_duplicates(*table, ChunkID{1}, ChunkOffset{0}, ChunkOffset{1}, TransactionID{0}));
+
+  // Rows that the checking transaction is about to delete do not conflict, rows locked by others do.
+  const auto& mvcc_data = table->get_chunk(ChunkID{2})->mvcc_data();
+  mvcc_data->set_begin_cid(ChunkOffset{0}, CommitID{0});
+  mvcc_data->set_tid(ChunkOffset{0}, TransactionID{5});
+  EXPECT_TRUE(index.has_duplicates(*table, ChunkID{0}, ChunkOffset{1}, ChunkOffset{2}, TransactionID{4}));
+  EXPECT_FALSE(index.has_duplicates(*table, ChunkID{0}, ChunkOffset{1}, ChunkOffset{2}, TransactionID{5}));
+
+  // Deleted rows do not conflict.
+  mvcc_data->set_end_cid(ChunkOffset{0}, CommitID{1});
+  mvcc_data->set_tid(ChunkOffset{0}, TransactionID{0});
+  EXPECT_FALSE(index.has_duplicates(*table, ChunkID{0}, ChunkOffset{1}, ChunkOffset{2}, TransactionID{4}));
+}
+
+TEST_F(KeyHashIndexTest, CreateOnTable) {
+  EXPECT_THROW(table->create_key_hash_index(*key_constraint), std::logic_error);
+
+  // The existing rows are validated. The key (2, 'y') is only unique once one of its rows is deleted.
+  table->add_soft_key_constraint(*key_constraint);
+  EXPECT_THROW(table->create_key_hash_index(*key_constraint), std::logic_error);
+  EXPECT_TRUE(table->key_hash_indexes().empty());
+
+  table->get_chunk(ChunkID{2})->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{1});
+  table->create_key_hash_index(*key_constraint);
+  ASSERT_EQ(table->key_hash_indexes().size(), 1);
+  EXPECT_EQ(table->key_hash_indexes().front()->column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+
+  // Only one index per key constraint.
+  EXPECT_THROW(table->create_key_hash_index(*key_constraint), std::logic_error);
+}
+
+}  // namespace hyrise
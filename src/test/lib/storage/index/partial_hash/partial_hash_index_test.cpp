@@ -193,6 +193,22 @@ TEST_F(PartialHashIndexTest, RangeEqualsWithIteratorNotExistingValue) {
   index->range_equals_with_iterators(access_range_equals_non_existing_value_with_iterators, "blub");
 }
 
+TEST_F(PartialHashIndexTest, RangeEqualsBatched) {
+  const auto values = std::vector<pmr_string>{"blub", "delta", "inbox", "delta"};
+  auto matches = std::vector<std::pair<size_t, std::vector<RowID>>>{};
+  index->range_equals_batched(
+      [&](const size_t value_idx, const std::vector<RowID>& row_ids) { matches.emplace_back(value_idx, row_ids); },
+      values);
+
+  const auto delta_row_ids = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{3}},
+                                                RowID{ChunkID{1}, ChunkOffset{1}}};
+  const auto inbox_row_ids = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{7}}, RowID{ChunkID{1}, ChunkOffset{7}}};
+  ASSERT_EQ(matches.size(), 3);
+  EXPECT_EQ(matches[0], std::make_pair(size_t{1}, delta_row_ids));
+  EXPECT_EQ(matches[1], std::make_pair(size_t{2}, inbox_row_ids));
+  EXPECT_EQ(matches[2], std::make_pair(size_t{3}, delta_row_ids));
+}
+
 TEST_F(PartialHashIndexTest, RangeNotEqualsWithIteratorExistingValue) {
   auto size = size_t{0};
   std::multiset<RowID> expected_when_value_exists = {
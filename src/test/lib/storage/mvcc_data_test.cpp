@@ -0,0 +1,90 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "storage/mvcc_data.hpp"
+#include "types.hpp"
+
+namespace hyrise {
+
+class StorageMvccDataTest : public BaseTest {
+ protected:
+  // Two full pages and a partial one.
+  static constexpr auto ROW_COUNT = size_t{2 * MvccData::PAGE_SIZE + 10};
+  static constexpr auto FULL_MEMORY_USAGE = ROW_COUNT * (2 * sizeof(CommitID) + sizeof(TransactionID));
+};
+
+TEST_F(StorageMvccDataTest, LazilyAllocatedDefaults) {
+  const auto mvcc_data = MvccData{ROW_COUNT, CommitID{3}};
+
+  ASSERT_TRUE(mvcc_data.uniform_begin_cid());
+  EXPECT_EQ(*mvcc_data.uniform_begin_cid(), CommitID{3});
+  EXPECT_EQ(mvcc_data.memory_savings(), FULL_MEMORY_USAGE);
+  EXPECT_EQ(mvcc_data.max_end_cid(), CommitID{0});
+
+  const auto last_offset = ChunkOffset{static_cast<ChunkOffset::base_type>(ROW_COUNT - 1)};
+  for (const auto offset : {ChunkOffset{0}, ChunkOffset{MvccData::PAGE_SIZE}, last_offset}) {
+    EXPECT_EQ(mvcc_data.get_begin_cid(offset), CommitID{3});
+    EXPECT_EQ(mvcc_data.get_end_cid(offset), MvccData::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_data.get_tid(offset), INVALID_TRANSACTION_ID);
+  }
+}
+
+TEST_F(StorageMvccDataTest, AllocatesOnFirstDeviatingWrite) {
+  auto mvcc_data = MvccData{ROW_COUNT, CommitID{3}};
+
+  // Writing the default values does not allocate anything.
+  mvcc_data.set_begin_cid(ChunkOffset{1}, CommitID{3});
+  mvcc_data.set_end_cid(ChunkOffset{1}, MvccData::MAX_COMMIT_ID);
+  mvcc_data.set_tid(ChunkOffset{1}, INVALID_TRANSACTION_ID);
+  EXPECT_FALSE(mvcc_data.compare_exchange_tid(ChunkOffset{1}, TransactionID{5}, TransactionID{6}));
+  EXPECT_EQ(mvcc_data.memory_savings(), FULL_MEMORY_USAGE);
+
+  // Deleting a row allocates the end CIDs and TIDs of its page only.
+  const auto memory_usage = mvcc_data.memory_usage();
+  const auto offset = ChunkOffset{MvccData::PAGE_SIZE + 1};
+  EXPECT_TRUE(mvcc_data.compare_exchange_tid(offset, INVALID_TRANSACTION_ID, TransactionID{5}));
+  mvcc_data.set_end_cid(offset, CommitID{4});
+
+  const auto page_memory_usage = MvccData::PAGE_SIZE * (sizeof(CommitID) + sizeof(TransactionID));
+  EXPECT_EQ(mvcc_data.memory_usage(), memory_usage + page_memory_usage);
+  EXPECT_EQ(mvcc_data.memory_savings(), FULL_MEMORY_USAGE - page_memory_usage);
+  EXPECT_EQ(mvcc_data.get_tid(offset), TransactionID{5});
+  EXPECT_EQ(mvcc_data.get_end_cid(offset), CommitID{4});
+  EXPECT_EQ(mvcc_data.get_end_cid(ChunkOffset{MvccData::PAGE_SIZE}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.get_end_cid(ChunkOffset{0}), MvccData::MAX_COMMIT_ID);
+  EXPECT_EQ(mvcc_data.max_end_cid(), CommitID{4});
+
+  // The last page only holds the remaining rows.
+  mvcc_data.set_tid(ChunkOffset{2 * MvccData::PAGE_SIZE}, TransactionID{6});
+  EXPECT_EQ(mvcc_data.memory_savings(),
+            FULL_MEMORY_USAGE - page_memory_usage - (ROW_COUNT % MvccData::PAGE_SIZE) * sizeof(TransactionID));
+
+  // Changing a begin CID allocates the begin CIDs of all rows.
+  mvcc_data.set_begin_cid(ChunkOffset{2}, CommitID{7});
+  EXPECT_FALSE(mvcc_data.uniform_begin_cid());
+  EXPECT_EQ(mvcc_data.get_begin_cid(ChunkOffset{2}), CommitID{7});
+  EXPECT_EQ(mvcc_data.get_begin_cid(ChunkOffset{3}), CommitID{3});
+  EXPECT_EQ(mvcc_data.max_commit_id(), CommitID{7});
+}
+
+TEST_F(StorageMvccDataTest, VisibilityWithoutAllocatedPages) {
+  auto mvcc_data = MvccData{ROW_COUNT, CommitID{3}};
+
+  // All rows are visible for newer snapshots and invisible for older ones.
+  const auto visible = mvcc_data.compute_visibility(TransactionID{1}, CommitID{3}, ChunkOffset{ROW_COUNT}, true);
+  ASSERT_EQ(visible.size(), (ROW_COUNT + 63) / 64);
+  EXPECT_EQ(visible.front(), ~uint64_t{0});
+  EXPECT_EQ(visible.back(), (uint64_t{1} << (ROW_COUNT % 64)) - 1);
+
+  const auto invisible = mvcc_data.compute_visibility(TransactionID{1}, CommitID{2}, ChunkOffset{ROW_COUNT}, false);
+  EXPECT_EQ(invisible, MvccData::VisibilityBitmap(visible.size(), 0));
+
+  // A deleted row in the second page.
+  mvcc_data.set_end_cid(ChunkOffset{MvccData::PAGE_SIZE + 1}, CommitID{4});
+  const auto visibility = mvcc_data.compute_visibility(TransactionID{1}, CommitID{5}, ChunkOffset{ROW_COUNT}, false);
+  EXPECT_EQ(visibility[MvccData::PAGE_SIZE / 64], ~uint64_t{2});
+  EXPECT_EQ(visibility.front(), ~uint64_t{0});
+}
+
+}  // namespace hyrise
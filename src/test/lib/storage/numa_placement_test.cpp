@@ -0,0 +1,74 @@
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "storage/numa_placement.hpp"
+#include "storage/table.hpp"
+
+namespace hyrise {
+
+class NumaPlacementTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{1});
+    expected_table = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{1});
+  }
+
+  std::shared_ptr<Table> table, expected_table;
+};
+
+TEST_F(NumaPlacementTest, NodeForChunk) {
+  // Interleaved: 0 1 2 0 1 2 0
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{0}, ChunkID{7}, 3, NumaPlacementPolicy::Interleaved), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{2}, ChunkID{7}, 3, NumaPlacementPolicy::Interleaved), NodeID{2});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{6}, ChunkID{7}, 3, NumaPlacementPolicy::Interleaved), NodeID{0});
+
+  // Partitioned: 0 0 0 1 1 1 2
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{0}, ChunkID{7}, 3, NumaPlacementPolicy::Partitioned), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{2}, ChunkID{7}, 3, NumaPlacementPolicy::Partitioned), NodeID{0});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{3}, ChunkID{7}, 3, NumaPlacementPolicy::Partitioned), NodeID{1});
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{6}, ChunkID{7}, 3, NumaPlacementPolicy::Partitioned), NodeID{2});
+
+  // More nodes than chunks.
+  EXPECT_EQ(numa_node_for_chunk(ChunkID{1}, ChunkID{2}, 4, NumaPlacementPolicy::Partitioned), NodeID{1});
+}
+
+TEST_F(NumaPlacementTest, SingleNode) {
+  Hyrise::get().topology.use_non_numa_topology();
+  place_chunks_on_numa_nodes(table);
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    EXPECT_FALSE(table->get_chunk(chunk_id)->numa_node_id());
+  }
+}
+
+TEST_F(NumaPlacementTest, PlaceChunks) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 1);
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  if (node_count < 2) {
+    GTEST_SKIP();
+  }
+
+  for (const auto policy : {NumaPlacementPolicy::Interleaved, NumaPlacementPolicy::Partitioned}) {
+    place_chunks_on_numa_nodes(table, policy);
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable()) {
+        EXPECT_FALSE(chunk->numa_node_id());
+        continue;
+      }
+
+      ASSERT_TRUE(chunk->numa_node_id());
+      EXPECT_EQ(*chunk->numa_node_id(), numa_node_for_chunk(chunk_id, chunk_count, node_count, policy));
+    }
+
+    // Migrating the chunks does not change the data.
+    EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  }
+}
+
+}  // namespace hyrise
@@ -50,7 +50,7 @@ TEST_F(EntireChunkPosListTest, AddAfterMatchedAllTest) {
   auto insert = std::make_shared<Insert>(table_name, get_table_to_add);
   insert->set_transaction_context(insert_context);
   insert->execute();
-  insert_context->commit();
+  EXPECT_TRUE(insert_context->commit());
 
   // Extra Lines have been added to the table:
   EXPECT_EQ(table->chunk_count(), 1);
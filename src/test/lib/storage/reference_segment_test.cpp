@@ -15,6 +15,8 @@
 #include "operators/table_scan.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/reference_segment/reference_segment_iterable.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -106,6 +108,40 @@ TEST_F(ReferenceSegmentTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_segment[ChunkOffset{3}], segment[ChunkOffset{2}]);
 }
 
+TEST_F(ReferenceSegmentTest, IteratesLargePosListFromChunks) {
+  // PosLists with many positions that reference multiple chunks are dereferenced in batches, grouped by chunk. The
+  // positions reference the dictionary-encoded chunks 0 and 1 and the unencoded chunk 2 in a shuffled order.
+  const auto position_count = ChunkOffset{static_cast<ChunkOffset::base_type>(
+      2 * ReferenceSegmentIterable<int32_t, EraseReferencedSegmentType::No>::MIN_POSITIONS_FOR_BATCHED_DEREFERENCING)};
+  const auto row_count = _test_table_dict->row_count();
+
+  auto pos_list = std::make_shared<RowIDPosList>();
+  for (auto position = ChunkOffset{0}; position < position_count; ++position) {
+    if (position % 10 == 0) {
+      pos_list->emplace_back(NULL_ROW_ID);
+      continue;
+    }
+
+    const auto row = (position * 7) % row_count;
+    pos_list->emplace_back(ChunkID{static_cast<ChunkID::base_type>(row / 5)},
+                           ChunkOffset{static_cast<ChunkOffset::base_type>(row % 5)});
+  }
+  const auto ref_segment = ReferenceSegment(_test_table_dict, ColumnID{1}, pos_list);
+
+  auto position = ChunkOffset{0};
+  segment_iterate<int32_t>(ref_segment, [&](const auto& segment_position) {
+    EXPECT_EQ(segment_position.chunk_offset(), position);
+    if (position % 10 == 0) {
+      EXPECT_TRUE(segment_position.is_null());
+    } else {
+      ASSERT_FALSE(segment_position.is_null());
+      EXPECT_EQ(segment_position.value(), 100 + 2 * static_cast<int32_t>((position * 7) % row_count));
+    }
+    ++position;
+  });
+  EXPECT_EQ(position, position_count);
+}
+
 TEST_F(ReferenceSegmentTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
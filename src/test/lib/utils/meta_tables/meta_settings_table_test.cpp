@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include "../mock_setting.hpp"
+#include "hyrise.hpp"
 #include "operators/table_wrapper.hpp"
 #include "utils/meta_tables/meta_settings_table.hpp"
 
@@ -40,6 +41,19 @@ class MetaSettingsTest : public BaseTest {
                    const std::vector<AllTypeVariant>& update_values) const {
     return table->_update(selected_values, update_values);
   }
+
+  // Hyrise registers some settings by itself (e.g., for the JoinOrderingRule), which are listed as well.
+  void append_builtin_settings(const std::shared_ptr<Table>& table) const {
+    const auto& settings_manager = Hyrise::get().settings_manager;
+    for (const auto& setting_name : settings_manager.setting_names()) {
+      if (setting_name == mock_setting->name) {
+        continue;
+      }
+
+      const auto setting = settings_manager.get_setting(setting_name);
+      table->append({pmr_string{setting_name}, pmr_string{setting->get()}, pmr_string{setting->description()}});
+    }
+  }
 };
 
 TEST_F(MetaSettingsTest, IsUpdateable) {
@@ -50,6 +64,7 @@ TEST_F(MetaSettingsTest, IsUpdateable) {
 
 TEST_F(MetaSettingsTest, TableGeneration) {
   expected_table->append({pmr_string{"mock_setting"}, pmr_string{"mock_value"}, pmr_string{"mock_description"}});
+  append_builtin_settings(expected_table);
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(expected_table));
   table_wrapper->execute();
 
@@ -61,6 +76,7 @@ TEST_F(MetaSettingsTest, Update) {
   updateTable(meta_settings_table, mock_manipulation_values->get_row(0), mock_manipulation_values->get_row(0));
 
   expected_table->append({pmr_string{"mock_setting"}, pmr_string{"bar"}, pmr_string{"mock_description"}});
+  append_builtin_settings(expected_table);
   auto table_wrapper = std::make_shared<TableWrapper>(std::move(expected_table));
   table_wrapper->execute();
 
@@ -10,7 +10,7 @@ const std::string& MockSetting::description() const {
   return description;
 }
 
-const std::string& MockSetting::get() {
+std::string MockSetting::get() {
   _get_calls++;
   return _value;
 }
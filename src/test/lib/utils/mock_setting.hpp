@@ -14,7 +14,7 @@ class MockSetting : public AbstractSetting {
 
   const std::string& description() const final;
 
-  const std::string& get() final;
+  std::string get() final;
 
   void set(const std::string& value) final;
 
@@ -0,0 +1,61 @@
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/join_hash.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "utils/settings/unsigned_integer_setting.hpp"
+
+namespace hyrise {
+
+class UnsignedIntegerSettingTest : public BaseTest {};
+
+TEST_F(UnsignedIntegerSettingTest, GetAndSet) {
+  const auto setting = std::make_shared<UnsignedIntegerSetting>("test_setting", "test_description", 42);
+  EXPECT_EQ(setting->description(), "test_description");
+  EXPECT_EQ(setting->get(), "42");
+  EXPECT_EQ(setting->value(), 42);
+
+  setting->set("17");
+  EXPECT_EQ(setting->get(), "17");
+  EXPECT_EQ(setting->value(), 17);
+}
+
+TEST_F(UnsignedIntegerSettingTest, InvalidValues) {
+  const auto setting = std::make_shared<UnsignedIntegerSetting>("test_setting", "test_description", 42);
+
+  for (const auto& value : {"", "-1", "abc", "12abc", " 12", "1.5", "99999999999999999999999"}) {
+    EXPECT_THROW(setting->set(value), InvalidInputException);
+  }
+
+  EXPECT_EQ(setting->get(), "42");
+  EXPECT_EQ(setting->value(), 42);
+}
+
+TEST_F(UnsignedIntegerSettingTest, BuiltinSettings) {
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  ASSERT_TRUE(settings_manager.has_setting(JoinOrderingRule::DP_VERTEX_THRESHOLD_SETTING));
+  ASSERT_TRUE(settings_manager.has_setting(JoinOrderingRule::MAX_CSG_CMP_PAIRS_SETTING));
+
+  const auto setting = settings_manager.get_setting(JoinOrderingRule::DP_VERTEX_THRESHOLD_SETTING);
+  EXPECT_EQ(setting->get(), std::to_string(JoinOrderingRule::DEFAULT_DP_VERTEX_THRESHOLD));
+
+  // Settings are reset along with Hyrise.
+  setting->set("4");
+  Hyrise::reset();
+  EXPECT_EQ(Hyrise::get().settings_manager.get_setting(JoinOrderingRule::DP_VERTEX_THRESHOLD_SETTING)->get(),
+            std::to_string(JoinOrderingRule::DEFAULT_DP_VERTEX_THRESHOLD));
+}
+
+TEST_F(UnsignedIntegerSettingTest, ValueOrDefault) {
+  EXPECT_TRUE(Hyrise::get().settings_manager.has_setting(JoinHash::MEMORY_BUDGET_SETTING));
+  EXPECT_EQ(UnsignedIntegerSetting::value_or_default(JoinHash::MEMORY_BUDGET_SETTING, 17),
+            JoinHash::DEFAULT_MEMORY_BUDGET);
+
+  Hyrise::get().settings_manager.get_setting(JoinHash::MEMORY_BUDGET_SETTING)->set("1024");
+  EXPECT_EQ(UnsignedIntegerSetting::value_or_default(JoinHash::MEMORY_BUDGET_SETTING, 17), 1024);
+
+  // Unregistered settings fall back to the default value.
+  EXPECT_EQ(UnsignedIntegerSetting::value_or_default("unknown_setting", 17), 17);
+}
+
+}  // namespace hyrise
@@ -93,8 +93,7 @@ class MvccDeletePluginSystemTest : public BaseTest {
     if (update->execute_failed()) {
       // Collided with the plugin rewriting a chunk
       transaction_context->rollback(RollbackReason::Conflict);
-    } else {
-      transaction_context->commit();
+    } else if (transaction_context->commit()) {
       _counter++;
     }
   }
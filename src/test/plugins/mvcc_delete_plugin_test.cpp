@@ -55,7 +55,7 @@ class MvccDeletePluginTest : public BaseTest {
     update_table->set_transaction_context(transaction_context);
     update_table->execute();
 
-    transaction_context->commit();
+    EXPECT_TRUE(transaction_context->commit());
   }
 
   static bool _try_logical_delete(const std::string& table_name, ChunkID chunk_id) {